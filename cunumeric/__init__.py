@@ -31,6 +31,7 @@ import numpy as _np
 from cunumeric import linalg, random, fft, ma
 from cunumeric.array import maybe_convert_to_np_ndarray, ndarray
 from cunumeric.bits import packbits, unpackbits
+from cunumeric.fused import fuse
 from cunumeric.module import *
 from cunumeric._ufunc import *
 from cunumeric.logic import *
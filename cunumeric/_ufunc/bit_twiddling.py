@@ -14,7 +14,7 @@
 #
 from __future__ import annotations
 
-from cunumeric.config import BinaryOpCode, UnaryOpCode
+from cunumeric.config import BinaryOpCode, ScanCode, UnaryOpCode
 
 from .ufunc import create_binary_ufunc, create_unary_ufunc, integer_dtypes
 
@@ -23,6 +23,7 @@ bitwise_and = create_binary_ufunc(
     "bitwise_and",
     BinaryOpCode.BITWISE_AND,
     ["?"] + integer_dtypes,
+    scan_code=ScanCode.BITWISE_AND,
 )
 
 bitwise_or = create_binary_ufunc(
@@ -30,6 +31,7 @@ bitwise_or = create_binary_ufunc(
     "bitwise_or",
     BinaryOpCode.BITWISE_OR,
     ["?"] + integer_dtypes,
+    scan_code=ScanCode.BITWISE_OR,
 )
 
 bitwise_xor = create_binary_ufunc(
@@ -37,6 +39,7 @@ bitwise_xor = create_binary_ufunc(
     "bitwise_xor",
     BinaryOpCode.BITWISE_XOR,
     ["?"] + integer_dtypes,
+    scan_code=ScanCode.BITWISE_XOR,
 )
 
 invert = create_unary_ufunc(
@@ -14,7 +14,7 @@
 #
 from __future__ import annotations
 
-from cunumeric.config import BinaryOpCode, UnaryOpCode, UnaryRedCode
+from cunumeric.config import BinaryOpCode, ScanCode, UnaryOpCode, UnaryRedCode
 
 from .ufunc import (
     all_dtypes,
@@ -73,6 +73,7 @@ logical_and = create_binary_ufunc(
     "logical_and",
     BinaryOpCode.LOGICAL_AND,
     relation_types_of(all_dtypes),
+    scan_code=ScanCode.LOGICAL_AND,
 )
 
 logical_or = create_binary_ufunc(
@@ -80,6 +81,7 @@ logical_or = create_binary_ufunc(
     "logical_or",
     BinaryOpCode.LOGICAL_OR,
     relation_types_of(all_dtypes),
+    scan_code=ScanCode.LOGICAL_OR,
 )
 
 logical_xor = create_binary_ufunc(
@@ -87,6 +89,7 @@ logical_xor = create_binary_ufunc(
     "logical_xor",
     BinaryOpCode.LOGICAL_XOR,
     relation_types_of(all_dtypes),
+    scan_code=ScanCode.LOGICAL_XOR,
 )
 
 logical_not = create_unary_ufunc(
@@ -107,6 +110,7 @@ maximum = create_binary_ufunc(
     BinaryOpCode.MAXIMUM,
     all_dtypes,
     red_code=UnaryRedCode.MAX,
+    scan_code=ScanCode.MAX,
 )
 
 fmax = maximum
@@ -117,6 +121,7 @@ minimum = create_binary_ufunc(
     BinaryOpCode.MINIMUM,
     all_dtypes,
     red_code=UnaryRedCode.MIN,
+    scan_code=ScanCode.MIN,
 )
 
 fmin = minimum
@@ -14,7 +14,7 @@
 #
 from __future__ import annotations
 
-from cunumeric.config import BinaryOpCode, UnaryOpCode, UnaryRedCode
+from cunumeric.config import BinaryOpCode, ScanCode, UnaryOpCode, UnaryRedCode
 
 from .ufunc import (
     all_but_boolean,
@@ -33,6 +33,7 @@ add = create_binary_ufunc(
     BinaryOpCode.ADD,
     all_dtypes,
     red_code=UnaryRedCode.SUM,
+    scan_code=ScanCode.SUM,
 )
 
 subtract = create_binary_ufunc(
@@ -48,6 +49,7 @@ multiply = create_binary_ufunc(
     BinaryOpCode.MULTIPLY,
     all_dtypes,
     red_code=UnaryRedCode.PROD,
+    scan_code=ScanCode.PROD,
 )
 
 true_divide = create_binary_ufunc(
@@ -74,6 +76,7 @@ logaddexp = create_binary_ufunc(
     "logaddexp",
     BinaryOpCode.LOGADDEXP,
     float_dtypes,
+    scan_code=ScanCode.LOGADDEXP,
 )
 
 logaddexp2 = create_binary_ufunc(
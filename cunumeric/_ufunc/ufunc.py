@@ -18,6 +18,9 @@ from typing import TYPE_CHECKING, Any, Dict, Optional, Sequence, Union
 
 import numpy as np
 from legate.core.utils import OrderedSet
+from numpy.core.multiarray import (  # type: ignore [attr-defined]
+    normalize_axis_index,
+)
 
 from ..array import (
     add_boilerplate,
@@ -25,7 +28,8 @@ from ..array import (
     convert_to_cunumeric_ndarray,
     ndarray,
 )
-from ..config import BinaryOpCode, UnaryOpCode, UnaryRedCode
+from ..config import BinaryOpCode, ScanCode, UnaryOpCode, UnaryRedCode
+from ..fused import is_fused_expr, trace_ufunc_call
 from ..types import NdShape
 
 if TYPE_CHECKING:
@@ -409,6 +413,12 @@ class unary_ufunc(ufunc):
         dtype: Union[np.dtype[Any], None] = None,
         **kwargs: Any,
     ) -> ndarray:
+        # Record the operation if we're tracing a fused expression
+        if is_fused_expr(args):
+            return trace_ufunc_call(  # type: ignore [return-value]
+                self._op_code, args, self.nin, out, where, dtype, kwargs
+            )
+
         (x,), (out,), out_shape, where = self._prepare_operands(
             *args, out=out, where=where
         )
@@ -537,6 +547,7 @@ class binary_ufunc(ufunc):
         types: dict[tuple[str, str], str],
         red_code: Union[UnaryRedCode, None] = None,
         use_common_type: bool = True,
+        scan_code: Union[ScanCode, None] = None,
     ) -> None:
         super().__init__(name, doc)
 
@@ -552,6 +563,7 @@ class binary_ufunc(ufunc):
         ] = {}
         self._red_code = red_code
         self._use_common_type = use_common_type
+        self._scan_code = scan_code
 
     @staticmethod
     def _find_common_type(
@@ -653,6 +665,12 @@ class binary_ufunc(ufunc):
         dtype: Union[np.dtype[Any], None] = None,
         **kwargs: Any,
     ) -> ndarray:
+        # Record the operation if we're tracing a fused expression
+        if is_fused_expr(args):
+            return trace_ufunc_call(  # type: ignore [return-value]
+                self._op_code, args, self.nin, out, where, dtype, kwargs
+            )
+
         arrs, (out,), out_shape, where = self._prepare_operands(
             *args, out=out, where=where
         )
@@ -769,6 +787,225 @@ class binary_ufunc(ufunc):
             where=where,
         )
 
+    def _resolve_accumulate_dtype(self, dtype: np.dtype[Any]) -> np.dtype[Any]:
+        # The loop for the dtype itself is used whenever there is one, even
+        # if its output type differs, as for logical operators, which run on
+        # booleans. Otherwise the running values are fed back as first
+        # operands, so the dtype must be cast to the input type of a loop
+        # whose output type is the same.
+        key = (dtype.char, dtype.char)
+        if key in self._types:
+            return np.dtype(self._types[key])
+        for (ty1, ty2), res in self._types.items():
+            if ty1 == ty2 == res and np.can_cast(dtype, ty1):
+                return np.dtype(ty1)
+        raise TypeError(
+            f"No matching signature of ufunc {self._name} is found "
+            "for the given casting"
+        )
+
+    @add_boilerplate("array")
+    def accumulate(
+        self,
+        array: ndarray,
+        axis: int = 0,
+        dtype: Union[np.dtype[Any], None] = None,
+        out: Union[ndarray, None] = None,
+    ) -> ndarray:
+        """
+        accumulate(array, axis=0, dtype=None, out=None)
+
+        Accumulate the result of applying the operator to all elements.
+
+        For example, add.accumulate() is equivalent to cumsum() and
+        maximum.accumulate() computes running maxima.
+
+        Parameters
+        ----------
+        array : array_like
+            The array to act on.
+        axis : int, optional
+            The axis along which to apply the accumulation; default is zero.
+        dtype : data-type code, optional
+            The data-type used to represent the intermediate results. Defaults
+            to the data-type of the output array if such is provided, or the
+            data-type of the input array if no output array is provided.
+        out : ndarray, None, or tuple of ndarray and None, optional
+            A location into which the result is stored. If not provided or
+            None, a freshly-allocated array is returned. For consistency with
+            ``ufunc.__call__``, if given as a keyword, this may be wrapped in a
+            1-element tuple.
+
+        Returns
+        -------
+        r : ndarray
+            The accumulated values. If `out` was supplied, `r` is a reference
+            to `out`.
+
+        See Also
+        --------
+        numpy.ufunc.accumulate
+        """
+        if self._scan_code is None:
+            raise NotImplementedError(
+                f"accumulation for {self} is not yet implemented"
+            )
+        if array.ndim == 0:
+            raise TypeError("cannot accumulate on a scalar")
+
+        # Sums and products follow cumsum and cumprod, which promote
+        # integers to the platform integer
+        if self._scan_code not in (ScanCode.SUM, ScanCode.PROD):
+            if dtype is None:
+                dtype = array.dtype if out is None else out.dtype
+            dtype = self._resolve_accumulate_dtype(np.dtype(dtype))
+            if dtype.kind == "c" and self._scan_code in (
+                ScanCode.MAX,
+                ScanCode.MIN,
+            ):
+                raise NotImplementedError(
+                    f"accumulation for {self} does not support complex values"
+                )
+
+        return ndarray._perform_scan(
+            self._scan_code, array, axis=axis, dtype=dtype, out=out
+        )
+
+    @add_boilerplate("array", "indices")
+    def reduceat(
+        self,
+        array: ndarray,
+        indices: ndarray,
+        axis: int = 0,
+        dtype: Union[np.dtype[Any], None] = None,
+        out: Union[ndarray, None] = None,
+    ) -> ndarray:
+        """
+        reduceat(array, indices, axis=0, dtype=None, out=None)
+
+        Performs a (local) reduce with specified slices over a single axis.
+
+        For i in ``range(len(indices))``, `reduceat` computes
+        ``ufunc.reduce(array[indices[i]:indices[i+1]])``, which becomes the
+        i-th generalized "row" parallel to `axis` in the final result. If
+        ``indices[i] >= indices[i + 1]``, the i-th generalized "row" is
+        simply ``array[indices[i]]``. The last segment runs to the end of
+        the axis.
+
+        Parameters
+        ----------
+        array : array_like
+            The array to act on.
+        indices : array_like
+            Paired indices, comma separated (not colon), specifying slices to
+            reduce.
+        axis : int, optional
+            The axis along which to apply the reduceat.
+        dtype : data-type code, optional
+            The type used to represent the intermediate results. Defaults to
+            the data type of the output array if this is provided, or the data
+            type of the input array if no output array is provided, except
+            that sums and products of booleans and integers smaller than the
+            default integer are computed in the default (unsigned) integer.
+        out : ndarray, optional
+            A location into which the result is stored. If not provided or
+            None, a freshly-allocated array is returned.
+
+        Returns
+        -------
+        r : ndarray
+            The reduced values. If `out` was supplied, `r` is a reference to
+            `out`.
+
+        See Also
+        --------
+        numpy.ufunc.reduceat
+        """
+        if self._red_code is None:
+            raise NotImplementedError(
+                f"segmented reduction for {self} is not yet implemented"
+            )
+        if array.ndim == 0:
+            raise TypeError("cannot reduceat on a scalar")
+        if indices.ndim != 1:
+            raise ValueError("indices must be a 1-D array")
+        if not np.can_cast(indices.dtype, np.int64):
+            raise TypeError(
+                f"Cannot cast array data from {indices.dtype} to "
+                f"{np.dtype(np.int64)} according to the rule 'safe'"
+            )
+        axis = normalize_axis_index(axis, array.ndim)
+
+        extent = array.shape[axis]
+        if indices.size > 0:
+            for bound in (int(indices.min()), int(indices.max())):
+                if bound < 0 or bound >= extent:
+                    raise IndexError(
+                        f"index {bound} out-of-bounds in "
+                        f"{self._name}.reduceat [0, {extent})"
+                    )
+
+        # Same as for reductions, the dtype determines both the accumulation
+        # dtype and the output dtype. As in NumPy, sums and products of
+        # booleans and small integers are accumulated in the default integer
+        if dtype is None:
+            if out is not None:
+                dtype = out.dtype
+            elif self._red_code in (
+                UnaryRedCode.SUM,
+                UnaryRedCode.PROD,
+            ) and array.dtype.kind in ("b", "i", "u"):
+                dtype = np.uint if array.dtype.kind == "u" else np.int_
+            else:
+                dtype = array.dtype
+        dtype = np.dtype(dtype)
+        if (
+            self._red_code in (UnaryRedCode.MAX, UnaryRedCode.MIN)
+            and dtype.kind == "c"
+        ):
+            raise NotImplementedError(
+                "max/min not supported for complex-type arrays"
+            )
+
+        out_shape: NdShape = (
+            *array.shape[:axis],
+            indices.size,
+            *array.shape[axis + 1 :],
+        )
+        if out is None:
+            out = ndarray(
+                shape=out_shape, dtype=dtype, inputs=(array, indices)
+            )
+        elif out.shape != out_shape:
+            raise ValueError(
+                f"the output shapes do not match: expected {out_shape} "
+                f"but got {out.shape}"
+            )
+
+        src = array._astype(dtype, temporary=True)
+        offsets = indices._astype(np.dtype(np.int64), temporary=True)
+        if out.dtype == dtype:
+            result = out
+        else:
+            result = ndarray(
+                shape=out_shape, dtype=dtype, inputs=(src, offsets)
+            )
+
+        if result.size > 0:
+            # Segments only form ranges of pieces along the axis if the
+            # offsets are sorted
+            monotonic = offsets.size < 2 or bool(
+                (offsets[1:] >= offsets[:-1]).all()
+            )
+            result._thunk.segmented_reduction(
+                self._red_code, src._thunk, offsets._thunk, axis, monotonic
+            )
+
+        if result is not out:
+            out._thunk.convert(result._thunk)
+
+        return out
+
 
 def _parse_unary_ufunc_type(ty: str) -> tuple[str, str]:
     if len(ty) == 1:
@@ -813,6 +1050,7 @@ def create_binary_ufunc(
     types: Sequence[str],
     red_code: Union[UnaryRedCode, None] = None,
     use_common_type: bool = True,
+    scan_code: Union[ScanCode, None] = None,
 ) -> binary_ufunc:
     doc = _BINARY_DOCSTRING_TEMPLATE.format(summary, name)
     types_dict = dict(_parse_binary_ufunc_type(ty) for ty in types)
@@ -823,4 +1061,5 @@ def create_binary_ufunc(
         types_dict,
         red_code=red_code,
         use_common_type=use_common_type,
+        scan_code=scan_code,
     )
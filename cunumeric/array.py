@@ -3247,18 +3247,30 @@ class ndarray:
                 "cunumeric.var only supports int types for `axis` currently"
             )
 
-        # this could be computed as a single pass through the array
-        # by computing both <x^2> and <x> and then computing <x^2> - <x>^2.
-        # this would takee the difference of two large numbers and is unstable
-        # the mean needs to be computed first and the variance computed
-        # directly as <(x-mu)^2>, which then requires two passes through the
-        # data to first compute the mean and then compute the variance
+        # computing both <x^2> and <x> in a single pass and then taking
+        # <x^2> - <x>^2 would be unstable, as it takes the difference of two
+        # large numbers. Instead, for floating point types the reduction
+        # carries the count, the mean and the sum of squared deviations of
+        # the values seen so far and merges them with Chan's formula, which
+        # gets the variance in a single pass without the cancellation
         # see https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance
-        # TODO(https://github.com/nv-legate/cunumeric/issues/590)
-
         dtype = self._summation_dtype(dtype)
-        # calculate the mean, but keep the dimensions so that the
-        # mean can be broadcast against the original array
+        if dtype in (np.dtype(np.float32), np.dtype(np.float64)):
+            return self._perform_unary_reduction(
+                UnaryRedCode.WELFORD,
+                self,
+                axis=axis,
+                dtype=dtype,
+                out=out,
+                keepdims=keepdims,
+                where=where,
+                args=(ddof,),
+            )
+
+        # Otherwise the mean needs to be computed first and the variance
+        # computed directly as <(x-mu)^2> in a second pass. Keep the
+        # dimensions of the mean so that it can be broadcast against the
+        # original array
         mu = self.mean(axis=axis, dtype=dtype, keepdims=True, where=where)
 
         where_array = broadcast_where(where, self.shape)
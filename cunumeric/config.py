@@ -145,6 +145,7 @@ class _CunumericSharedLib:
     CUNUMERIC_CONVERT_NAN_SUM: int
     CUNUMERIC_CONVOLVE: int
     CUNUMERIC_DIAG: int
+    CUNUMERIC_DIFF: int
     CUNUMERIC_DOT: int
     CUNUMERIC_EYE: int
     CUNUMERIC_FFT: int
@@ -158,8 +159,16 @@ class _CunumericSharedLib:
     CUNUMERIC_FFT_Z2Z: int
     CUNUMERIC_FILL: int
     CUNUMERIC_FLIP: int
+    CUNUMERIC_FUSED_BINARY: int
+    CUNUMERIC_FUSED_CONSTANT: int
+    CUNUMERIC_FUSED_INPUT: int
+    CUNUMERIC_FUSED_OP: int
+    CUNUMERIC_FUSED_UNARY: int
     CUNUMERIC_GEMM: int
+    CUNUMERIC_GRADIENT: int
     CUNUMERIC_HISTOGRAM: int
+    CUNUMERIC_ISIN: int
+    CUNUMERIC_LEXSORT: int
     CUNUMERIC_LOAD_CUDALIBS: int
     CUNUMERIC_MATMUL: int
     CUNUMERIC_MATVECMUL: int
@@ -168,8 +177,12 @@ class _CunumericSharedLib:
     CUNUMERIC_MAX_TASKS: int
     CUNUMERIC_NONZERO: int
     CUNUMERIC_PACKBITS: int
+    CUNUMERIC_PARTITION: int
     CUNUMERIC_POTRF: int
     CUNUMERIC_PUTMASK: int
+    CUNUMERIC_QUANTILE_SKETCH: int
+    CUNUMERIC_QUANTILE_SKETCH_REDUCE: int
+    CUNUMERIC_RADIX_SELECT: int
     CUNUMERIC_RAND: int
     CUNUMERIC_READ: int
     CUNUMERIC_RED_ALL: int
@@ -190,17 +203,32 @@ class _CunumericSharedLib:
     CUNUMERIC_RED_SUM: int
     CUNUMERIC_RED_SUM_SQUARES: int
     CUNUMERIC_RED_VARIANCE: int
+    CUNUMERIC_RED_WELFORD: int
     CUNUMERIC_REPEAT: int
+    CUNUMERIC_SCALAR_STATS: int
     CUNUMERIC_SCALAR_UNARY_RED: int
+    CUNUMERIC_SCAN_BITWISE_AND: int
+    CUNUMERIC_SCAN_BITWISE_OR: int
+    CUNUMERIC_SCAN_BITWISE_XOR: int
     CUNUMERIC_SCAN_GLOBAL: int
     CUNUMERIC_SCAN_LOCAL: int
+    CUNUMERIC_SCAN_LOGADDEXP: int
+    CUNUMERIC_SCAN_LOGICAL_AND: int
+    CUNUMERIC_SCAN_LOGICAL_OR: int
+    CUNUMERIC_SCAN_LOGICAL_XOR: int
+    CUNUMERIC_SCAN_MAX: int
+    CUNUMERIC_SCAN_MIN: int
     CUNUMERIC_SCAN_PROD: int
     CUNUMERIC_SCAN_SUM: int
     CUNUMERIC_SEARCHSORTED: int
+    CUNUMERIC_SEARCHSORTED_MERGE: int
+    CUNUMERIC_SEGMENTED_RED: int
+    CUNUMERIC_SEGMENTED_RED_GLOBAL: int
     CUNUMERIC_SOLVE: int
     CUNUMERIC_SORT: int
     CUNUMERIC_SYRK: int
     CUNUMERIC_TILE: int
+    CUNUMERIC_TOPK: int
     CUNUMERIC_TRANSPOSE_COPY_2D: int
     CUNUMERIC_TRILU: int
     CUNUMERIC_TRSM: int
@@ -210,6 +238,7 @@ class _CunumericSharedLib:
     CUNUMERIC_UNARY_OP: int
     CUNUMERIC_UNARY_RED: int
     CUNUMERIC_UNIQUE: int
+    CUNUMERIC_UNIQUE_INVERSE: int
     CUNUMERIC_UNIQUE_REDUCE: int
     CUNUMERIC_UNLOAD_CUDALIBS: int
     CUNUMERIC_UNPACKBITS: int
@@ -234,6 +263,7 @@ class _CunumericSharedLib:
     CUNUMERIC_UOP_FLOOR: int
     CUNUMERIC_UOP_FREXP: int
     CUNUMERIC_UOP_GETARG: int
+    CUNUMERIC_UOP_GETVAR: int
     CUNUMERIC_UOP_IMAG: int
     CUNUMERIC_UOP_INVERT: int
     CUNUMERIC_UOP_ISFINITE: int
@@ -281,6 +311,12 @@ class _CunumericSharedLib:
     ) -> None:
         ...
 
+    @abstractmethod
+    def cunumeric_register_welford_op(
+        self, type_uid: int, elem_type_code: int
+    ) -> None:
+        ...
+
 
 # Load the cuNumeric library first so we have a shard object that
 # we can use to initialize all these configuration enumerations
@@ -344,37 +380,52 @@ class CuNumericOpCode(IntEnum):
     CONVERT = _cunumeric.CUNUMERIC_CONVERT
     CONVOLVE = _cunumeric.CUNUMERIC_CONVOLVE
     DIAG = _cunumeric.CUNUMERIC_DIAG
+    DIFF = _cunumeric.CUNUMERIC_DIFF
     DOT = _cunumeric.CUNUMERIC_DOT
     EYE = _cunumeric.CUNUMERIC_EYE
     FFT = _cunumeric.CUNUMERIC_FFT
     FILL = _cunumeric.CUNUMERIC_FILL
     FLIP = _cunumeric.CUNUMERIC_FLIP
+    FUSED_OP = _cunumeric.CUNUMERIC_FUSED_OP
     GEMM = _cunumeric.CUNUMERIC_GEMM
+    GRADIENT = _cunumeric.CUNUMERIC_GRADIENT
     HISTOGRAM = _cunumeric.CUNUMERIC_HISTOGRAM
+    ISIN = _cunumeric.CUNUMERIC_ISIN
+    LEXSORT = _cunumeric.CUNUMERIC_LEXSORT
     LOAD_CUDALIBS = _cunumeric.CUNUMERIC_LOAD_CUDALIBS
     MATMUL = _cunumeric.CUNUMERIC_MATMUL
     MATVECMUL = _cunumeric.CUNUMERIC_MATVECMUL
     NONZERO = _cunumeric.CUNUMERIC_NONZERO
     PACKBITS = _cunumeric.CUNUMERIC_PACKBITS
+    PARTITION = _cunumeric.CUNUMERIC_PARTITION
     POTRF = _cunumeric.CUNUMERIC_POTRF
     PUTMASK = _cunumeric.CUNUMERIC_PUTMASK
+    QUANTILE_SKETCH = _cunumeric.CUNUMERIC_QUANTILE_SKETCH
+    QUANTILE_SKETCH_REDUCE = _cunumeric.CUNUMERIC_QUANTILE_SKETCH_REDUCE
+    RADIX_SELECT = _cunumeric.CUNUMERIC_RADIX_SELECT
     RAND = _cunumeric.CUNUMERIC_RAND
     READ = _cunumeric.CUNUMERIC_READ
     REPEAT = _cunumeric.CUNUMERIC_REPEAT
+    SCALAR_STATS = _cunumeric.CUNUMERIC_SCALAR_STATS
     SCALAR_UNARY_RED = _cunumeric.CUNUMERIC_SCALAR_UNARY_RED
     SCAN_GLOBAL = _cunumeric.CUNUMERIC_SCAN_GLOBAL
     SCAN_LOCAL = _cunumeric.CUNUMERIC_SCAN_LOCAL
     SEARCHSORTED = _cunumeric.CUNUMERIC_SEARCHSORTED
+    SEARCHSORTED_MERGE = _cunumeric.CUNUMERIC_SEARCHSORTED_MERGE
+    SEGMENTED_RED = _cunumeric.CUNUMERIC_SEGMENTED_RED
+    SEGMENTED_RED_GLOBAL = _cunumeric.CUNUMERIC_SEGMENTED_RED_GLOBAL
     SOLVE = _cunumeric.CUNUMERIC_SOLVE
     SORT = _cunumeric.CUNUMERIC_SORT
     SYRK = _cunumeric.CUNUMERIC_SYRK
     TILE = _cunumeric.CUNUMERIC_TILE
+    TOPK = _cunumeric.CUNUMERIC_TOPK
     TRANSPOSE_COPY_2D = _cunumeric.CUNUMERIC_TRANSPOSE_COPY_2D
     TRILU = _cunumeric.CUNUMERIC_TRILU
     TRSM = _cunumeric.CUNUMERIC_TRSM
     UNARY_OP = _cunumeric.CUNUMERIC_UNARY_OP
     UNARY_RED = _cunumeric.CUNUMERIC_UNARY_RED
     UNIQUE = _cunumeric.CUNUMERIC_UNIQUE
+    UNIQUE_INVERSE = _cunumeric.CUNUMERIC_UNIQUE_INVERSE
     UNIQUE_REDUCE = _cunumeric.CUNUMERIC_UNIQUE_REDUCE
     UNLOAD_CUDALIBS = _cunumeric.CUNUMERIC_UNLOAD_CUDALIBS
     UNPACKBITS = _cunumeric.CUNUMERIC_UNPACKBITS
@@ -409,6 +460,7 @@ class UnaryOpCode(IntEnum):
     FLOOR = _cunumeric.CUNUMERIC_UOP_FLOOR
     FREXP = _cunumeric.CUNUMERIC_UOP_FREXP
     GETARG = _cunumeric.CUNUMERIC_UOP_GETARG
+    GETVAR = _cunumeric.CUNUMERIC_UOP_GETVAR
     IMAG = _cunumeric.CUNUMERIC_UOP_IMAG
     INVERT = _cunumeric.CUNUMERIC_UOP_INVERT
     ISFINITE = _cunumeric.CUNUMERIC_UOP_ISFINITE
@@ -458,6 +510,7 @@ class UnaryRedCode(IntEnum):
     SUM = _cunumeric.CUNUMERIC_RED_SUM
     SUM_SQUARES = _cunumeric.CUNUMERIC_RED_SUM_SQUARES
     VARIANCE = _cunumeric.CUNUMERIC_RED_VARIANCE
+    WELFORD = _cunumeric.CUNUMERIC_RED_WELFORD
 
 
 # Match these to CuNumericBinaryOpCode in cunumeric_c.h
@@ -528,10 +581,28 @@ class CuNumericTunable(IntEnum):
 # Match these to CuNumericScanCode in cunumeric_c.h
 @unique
 class ScanCode(IntEnum):
+    BITWISE_AND = _cunumeric.CUNUMERIC_SCAN_BITWISE_AND
+    BITWISE_OR = _cunumeric.CUNUMERIC_SCAN_BITWISE_OR
+    BITWISE_XOR = _cunumeric.CUNUMERIC_SCAN_BITWISE_XOR
+    LOGADDEXP = _cunumeric.CUNUMERIC_SCAN_LOGADDEXP
+    LOGICAL_AND = _cunumeric.CUNUMERIC_SCAN_LOGICAL_AND
+    LOGICAL_OR = _cunumeric.CUNUMERIC_SCAN_LOGICAL_OR
+    LOGICAL_XOR = _cunumeric.CUNUMERIC_SCAN_LOGICAL_XOR
+    MAX = _cunumeric.CUNUMERIC_SCAN_MAX
+    MIN = _cunumeric.CUNUMERIC_SCAN_MIN
     PROD = _cunumeric.CUNUMERIC_SCAN_PROD
     SUM = _cunumeric.CUNUMERIC_SCAN_SUM
 
 
+# Match these to CuNumericFusedInstrKind in cunumeric_c.h
+@unique
+class FusedInstrKind(IntEnum):
+    INPUT = _cunumeric.CUNUMERIC_FUSED_INPUT
+    CONSTANT = _cunumeric.CUNUMERIC_FUSED_CONSTANT
+    UNARY = _cunumeric.CUNUMERIC_FUSED_UNARY
+    BINARY = _cunumeric.CUNUMERIC_FUSED_BINARY
+
+
 # Match these to CuNumericConvertCode in cunumeric_c.h
 @unique
 class ConvertCode(IntEnum):
@@ -26,6 +26,7 @@ from typing import (
     Any,
     Callable,
     Dict,
+    Iterable,
     Optional,
     Sequence,
     TypeVar,
@@ -55,7 +56,8 @@ from .config import (
 )
 from .linalg.cholesky import cholesky
 from .linalg.solve import solve
-from .sort import sort
+from .settings import settings
+from .sort import lexsort, partition, searchsorted, sort, topk
 from .thunk import NumPyThunk
 from .utils import is_advanced_indexing
 
@@ -161,6 +163,7 @@ _UNARY_RED_TO_REDUCTION_OPS: Dict[int, int] = {
     UnaryRedCode.SUM: ReductionOp.ADD,
     UnaryRedCode.SUM_SQUARES: ReductionOp.ADD,
     UnaryRedCode.VARIANCE: ReductionOp.ADD,
+    UnaryRedCode.WELFORD: ReductionOp.ADD,
     UnaryRedCode.PROD: ReductionOp.MUL,
     UnaryRedCode.MAX: ReductionOp.MAX,
     UnaryRedCode.MIN: ReductionOp.MIN,
@@ -213,6 +216,7 @@ _UNARY_RED_IDENTITIES: Dict[UnaryRedCode, Callable[[Any], Any]] = {
     UnaryRedCode.SUM: lambda _: 0,
     UnaryRedCode.SUM_SQUARES: lambda _: 0,
     UnaryRedCode.VARIANCE: lambda _: 0,
+    UnaryRedCode.WELFORD: lambda _: (0, 0, 0),
     UnaryRedCode.PROD: lambda _: 1,
     UnaryRedCode.MIN: min_identity,
     UnaryRedCode.MAX: max_identity,
@@ -236,6 +240,10 @@ _UNARY_RED_IDENTITIES: Dict[UnaryRedCode, Callable[[Any], Any]] = {
     UnaryRedCode.NANSUM: lambda _: 0,
 }
 
+# Highest order of differences computed in one pass. Every order needs its
+# own shifted partition of the input, so higher orders take several passes.
+_MAX_DIFF_ORDER = 8
+
 
 @unique
 class BlasOperation(IntEnum):
@@ -1406,6 +1414,108 @@ class DeferredArray(NumPyThunk):
 
         task.execute()
 
+    # Returns the offsets of the tiles shifted by the given numbers of
+    # elements along the axis
+    def _axis_stencils(
+        self, axis: int, shifts: Iterable[int]
+    ) -> list[tuple[int, ...]]:
+        return [
+            tuple(shift if dim == axis else 0 for dim in range(self.ndim))
+            for shift in shifts
+        ]
+
+    @auto_convert("rhs")
+    def diff(self, rhs: Any, n: int, axis: int) -> None:
+        while n > _MAX_DIFF_ORDER:
+            shape = list(rhs.shape)
+            shape[axis] -= _MAX_DIFF_ORDER
+            temp = self.runtime.create_empty_thunk(
+                tuple(shape), self.base.type, inputs=[rhs]
+            )
+            temp._diff(rhs, _MAX_DIFF_ORDER, axis)
+            rhs = temp
+            n -= _MAX_DIFF_ORDER
+        self._diff(rhs, n, axis)
+
+    # The n-th order difference at an element reads the n elements after it
+    # along the axis. The input is viewed with the shape of the output and
+    # aligned with it, and the elements past the end of each tile are read
+    # through the tiles of the whole input shifted by one to n elements,
+    # which are colocated with the aligned tile as in convolve.
+    def _diff(self, rhs: Any, n: int, axis: int) -> None:
+        input = rhs.base
+        aligned = input.slice(axis, slice(0, self.shape[axis]))
+        output = self.base
+
+        task = self.context.create_auto_task(CuNumericOpCode.DIFF)
+
+        stencils = self._axis_stencils(axis, range(1, n + 1))
+        p_out = task.declare_partition(output)
+        p_input = task.declare_partition(aligned)
+        p_stencils = []
+        for _ in stencils:
+            p_stencils.append(task.declare_partition(input, complete=False))
+
+        task.add_output(output, partition=p_out)
+        task.add_input(aligned, partition=p_input)
+        for p_stencil in p_stencils:
+            task.add_input(input, partition=p_stencil)
+        task.add_scalar_arg(n, ty.int32)
+        task.add_scalar_arg(axis, ty.int32)
+
+        task.add_constraint(p_out == p_input)
+        for stencil, p_stencil in zip(stencils, p_stencils):
+            task.add_constraint(p_input + stencil <= p_stencil)  # type: ignore
+
+        task.execute()
+
+    # The gradient at an element reads up to edge_order elements on either
+    # side of it along the axis, through shifted tiles as in diff. The
+    # coordinates along the axis are broadcast when the spacing is not
+    # uniform.
+    @auto_convert("rhs", "coords")
+    def gradient(
+        self,
+        rhs: Any,
+        axis: int,
+        edge_order: int,
+        spacing: float,
+        coords: Optional[Any],
+    ) -> None:
+        input = rhs.base
+        output = self.base
+
+        task = self.context.create_auto_task(CuNumericOpCode.GRADIENT)
+
+        stencils = self._axis_stencils(
+            axis,
+            (k for k in range(-edge_order, edge_order + 1) if k != 0),
+        )
+        p_out = task.declare_partition(output)
+        p_input = task.declare_partition(input)
+        p_stencils = []
+        for _ in stencils:
+            p_stencils.append(task.declare_partition(input, complete=False))
+
+        task.add_output(output, partition=p_out)
+        task.add_input(input, partition=p_input)
+        for p_stencil in p_stencils:
+            task.add_input(input, partition=p_stencil)
+        if coords is not None:
+            task.add_input(coords.base)
+            task.add_broadcast(coords.base)
+        task.add_scalar_arg(axis, ty.int32)
+        task.add_scalar_arg(edge_order, ty.int32)
+        task.add_scalar_arg(rhs.shape[axis], ty.int64)
+        task.add_scalar_arg(coords is None, ty.bool_)
+        task.add_scalar_arg(spacing, ty.float64)
+
+        task.add_constraint(p_out == p_input)
+        for stencil, p_stencil in zip(stencils, p_stencils):
+            task.add_constraint(p_input + stencil <= p_stencil)  # type: ignore
+
+        task.execute()
+
     @auto_convert("rhs")
     def fft(
         self,
@@ -1464,8 +1574,12 @@ class DeferredArray(NumPyThunk):
         else:
             # Perform the fill using a task
             # If this is a fill for an arg value, make sure to pass
-            # the value dtype so that we get it packed correctly
-            argval = self.dtype.kind == "V"
+            # the value dtype so that we get it packed correctly. The
+            # other struct types are the states of Welford reductions
+            argval = (
+                self.dtype.kind == "V"
+                and not self.runtime.is_welford_type(self.base.type)
+            )
             task = self.context.create_auto_task(CuNumericOpCode.FILL)
             task.add_output(self.base)
             task.add_input(value)
@@ -3161,8 +3275,25 @@ class DeferredArray(NumPyThunk):
                 dtype=argred_dtype,
                 inputs=[self],
             )
+        # Single-pass variance reduces into (count, mean, M2) states, from
+        # which the variance is extracted at the end. The only argument is
+        # ddof, which is needed just for that last step
+        welford = op == UnaryRedCode.WELFORD
+        if welford:
+            welford_dtype = self.runtime.get_welford_type(rhs_array.base.type)
+            lhs_array = self.runtime.create_empty_thunk(
+                lhs_array.shape,
+                dtype=welford_dtype,
+                inputs=[self],
+            )
+            (ddof,) = args
+            args = None
 
         is_where = bool(where is not None)
+        pairwise = (
+            op in (UnaryRedCode.SUM, UnaryRedCode.NANSUM)
+            and settings.pairwise_sum()
+        )
         # See if we are doing reduction to a point or another region
         if lhs_array.size == 1:
             assert axes is None or lhs_array.ndim == rhs_array.ndim - (
@@ -3170,7 +3301,7 @@ class DeferredArray(NumPyThunk):
             )
 
             if initial is not None:
-                assert not argred
+                assert not argred and not welford
                 fill_value = initial
             else:
                 fill_value = _UNARY_RED_IDENTITIES[op](rhs_array.dtype)
@@ -3191,6 +3322,7 @@ class DeferredArray(NumPyThunk):
                 task.add_scalar_arg(op, ty.int32)
                 task.add_scalar_arg(rhs_array.shape, (ty.int64,))
                 task.add_scalar_arg(is_where, ty.bool_)
+                task.add_scalar_arg(pairwise, ty.bool_)
                 if is_where:
                     task.add_input(where.base)
                     task.add_alignment(rhs_array.base, where.base)
@@ -3204,7 +3336,7 @@ class DeferredArray(NumPyThunk):
             # initialized. If an initial value is given, we use it, otherwise
             # we use the identity of the reduction operator
             if initial is not None:
-                assert not argred
+                assert not argred and not welford
                 fill_value = initial
             else:
                 fill_value = _UNARY_RED_IDENTITIES[op](rhs_array.dtype)
@@ -3234,6 +3366,7 @@ class DeferredArray(NumPyThunk):
                 task.add_scalar_arg(axis, ty.int32)
                 task.add_scalar_arg(op, ty.int32)
                 task.add_scalar_arg(is_where, ty.bool_)
+                task.add_scalar_arg(pairwise, ty.bool_)
                 if is_where:
                     task.add_input(where.base)
                     task.add_alignment(rhs_array.base, where.base)
@@ -3251,6 +3384,99 @@ class DeferredArray(NumPyThunk):
                 True,
                 [],
             )
+        elif welford:
+            self.unary_op(
+                UnaryOpCode.GETVAR,
+                lhs_array,
+                True,
+                [np.array(ddof, dtype=np.int64)],
+            )
+
+    # Reduce the segments of the source array along an axis that start at the
+    # given offsets. Each point task reduces the segments that start in its
+    # piece into an unbound store, whose pieces are assembled in order into
+    # an array of the shape of the output. It also produces the partial
+    # result of the segment that runs on into its piece from the one before.
+    # If the offsets are sorted, a second pass folds those into the results
+    # of the pieces that own the segments, as for scans. Otherwise segments
+    # are not ranges of pieces, so the axis is kept whole.
+    @auto_convert("rhs", "offsets")
+    def segmented_reduction(
+        self,
+        op: UnaryRedCode,
+        rhs: Any,
+        offsets: Any,
+        axis: int,
+        monotonic: bool,
+    ) -> None:
+        result = self.runtime.create_unbound_thunk(
+            dtype=self.base.type, ndim=self.ndim
+        )
+        heads = self.runtime.create_unbound_thunk(
+            dtype=self.base.type, ndim=self.ndim
+        )
+        head_segments = self.runtime.create_unbound_thunk(
+            dtype=ty.int64, ndim=self.ndim
+        )
+
+        task = self.context.create_auto_task(CuNumericOpCode.SEGMENTED_RED)
+        task.add_input(rhs.base)
+        task.add_input(offsets.base)
+        task.add_output(result.base)
+        task.add_output(heads.base)
+        task.add_output(head_segments.base)
+        task.add_scalar_arg(op, ty.int32)
+        task.add_scalar_arg(axis, ty.int32)
+        task.add_scalar_arg(rhs.shape[axis], ty.int64)
+
+        task.add_broadcast(offsets.base)
+        if not monotonic:
+            task.add_broadcast(rhs.base, axes=(axis,))
+
+        task.execute()
+
+        if monotonic:
+            # NOTE: Assumes the partitioning stays the same from previous
+            # task, so that the heads of a piece are found by its color
+            task = self.context.create_auto_task(
+                CuNumericOpCode.SEGMENTED_RED_GLOBAL
+            )
+            task.add_input(result.base)
+            task.add_input(heads.base)
+            task.add_input(head_segments.base)
+            task.add_output(result.base)
+            task.add_scalar_arg(op, ty.int32)
+            task.add_scalar_arg(axis, ty.int32)
+
+            task.add_broadcast(heads.base)
+            task.add_broadcast(head_segments.base)
+
+            task.execute()
+
+        self.copy(result, deep=True)
+
+    # Compute min, max, sum, number of non-zeros and number of NaNs of the
+    # array in a single pass. Each statistic is reduced into its own output
+    # with the same reduction operator as the corresponding single reduction
+    def scalar_stats(self, outputs: Sequence[Any]) -> None:
+        outputs = tuple(self.runtime.to_deferred_array(out) for out in outputs)
+        redops = (
+            (UnaryRedCode.MIN, ReductionOp.MIN),
+            (UnaryRedCode.MAX, ReductionOp.MAX),
+            (UnaryRedCode.SUM, ReductionOp.ADD),
+            (UnaryRedCode.COUNT_NONZERO, ReductionOp.ADD),
+            (UnaryRedCode.COUNT_NONZERO, ReductionOp.ADD),
+        )
+        assert len(outputs) == len(redops)
+
+        task = self.context.create_auto_task(CuNumericOpCode.SCALAR_STATS)
+        task.add_input(self.base)
+        for out, (op, redop) in zip(outputs, redops):
+            fill_value = _UNARY_RED_IDENTITIES[op](self.dtype)
+            out.fill(np.array(fill_value, dtype=out.dtype))
+            task.add_reduction(out.base, redop)
+
+        task.execute()
 
     def isclose(
         self, rhs1: Any, rhs2: Any, rtol: float, atol: float, equal_nan: bool
@@ -3290,6 +3516,33 @@ class DeferredArray(NumPyThunk):
 
             task.execute()
 
+    # Evaluate a fused element-wise expression and put the result in the
+    # lhs array. The instructions form a topologically sorted expression DAG
+    # whose last instruction produces the output value
+    def fused_op(
+        self,
+        instrs: Sequence[tuple[int, int, int, int]],
+        constants: Sequence[float],
+        srcs: Sequence[Any],
+    ) -> None:
+        lhs = self.base
+        rhs = tuple(
+            self.runtime.to_deferred_array(src)._broadcast(lhs.shape)
+            for src in srcs
+        )
+        encoded = tuple(field for instr in instrs for field in instr)
+
+        with Annotation({"Instructions": str(len(instrs))}):
+            task = self.context.create_auto_task(CuNumericOpCode.FUSED_OP)
+            task.add_output(lhs)
+            for src in rhs:
+                task.add_input(src)
+                task.add_alignment(lhs, src)
+            task.add_scalar_arg(encoded, (ty.int32,))
+            task.add_scalar_arg(tuple(constants), (ty.float64,))
+
+            task.execute()
+
     @auto_convert("src1", "src2")
     def binary_reduction(
         self,
@@ -3408,48 +3661,33 @@ class DeferredArray(NumPyThunk):
             dtype=self.base.type, ndim=self.ndim
         )
 
-        if axis == rhs.ndim - 1:
-            input = rhs
-            output = self
-        else:
-            # swap axes, always performing scan along last axis
-            swapped = rhs.swapaxes(axis, rhs.ndim - 1)
-            input = self.runtime.create_empty_thunk(
-                swapped.shape, dtype=rhs.base.type, inputs=(rhs, swapped)
-            )
-            input.copy(swapped, deep=True)
-            output = input
-
-        task = output.context.create_auto_task(CuNumericOpCode.SCAN_LOCAL)
-        task.add_output(output.base)
-        task.add_input(input.base)
+        # the tasks scan along any axis directly, whatever the layout
+        task = self.context.create_auto_task(CuNumericOpCode.SCAN_LOCAL)
+        task.add_output(self.base)
+        task.add_input(rhs.base)
         task.add_output(temp.base)
         task.add_scalar_arg(op, ty.int32)
         task.add_scalar_arg(nan_to_identity, ty.bool_)
+        task.add_scalar_arg(axis, ty.int32)
 
-        task.add_alignment(input.base, output.base)
+        task.add_alignment(rhs.base, self.base)
 
         task.execute()
         # Global sum
         # NOTE: Assumes the partitioning stays the same from previous task.
         # NOTE: Each node will do a sum up to its index, alternatively could
         # do one centralized scan and broadcast (slightly less redundant work)
-        task = output.context.create_auto_task(CuNumericOpCode.SCAN_GLOBAL)
-        task.add_input(output.base)
+        task = self.context.create_auto_task(CuNumericOpCode.SCAN_GLOBAL)
+        task.add_input(self.base)
         task.add_input(temp.base)
-        task.add_output(output.base)
+        task.add_output(self.base)
         task.add_scalar_arg(op, ty.int32)
+        task.add_scalar_arg(axis, ty.int32)
 
         task.add_broadcast(temp.base)
 
         task.execute()
 
-        # if axes were swapped, turn them back
-        if output is not self:
-            swapped = output.swapaxes(rhs.ndim - 1, axis)
-            assert self.shape == swapped.shape
-            self.copy(swapped, deep=True)
-
     def unique(self) -> NumPyThunk:
         result = self.runtime.create_unbound_thunk(self.base.type)
 
@@ -3470,31 +3708,77 @@ class DeferredArray(NumPyThunk):
 
         return result
 
-    @auto_convert("rhs", "v")
-    def searchsorted(self, rhs: Any, v: Any, side: SortSide = "left") -> None:
-        task = self.context.create_auto_task(CuNumericOpCode.SEARCHSORTED)
-
-        is_left = side == "left"
+    # Maps every element to the position of its value in the sorted unique
+    # values, which are broadcast to all point tasks. The occurrence counts and
+    # first occurrences of the unique values are reduced across point tasks
+    @auto_convert("unique", "inverse", "counts", "index")
+    def unique_inverse(
+        self,
+        unique: Any,
+        inverse: Optional[Any],
+        counts: Optional[Any],
+        index: Optional[Any],
+    ) -> None:
+        task = self.context.create_auto_task(CuNumericOpCode.UNIQUE_INVERSE)
+        task.add_input(self.base)
+        task.add_input(unique.base)
+        task.add_broadcast(unique.base)
+
+        if inverse is not None:
+            task.add_output(inverse.base)
+            task.add_alignment(self.base, inverse.base)
+        if counts is not None:
+            counts.fill(np.array(0, dtype=counts.dtype))
+            task.add_reduction(counts.base, ReductionOp.ADD)
+            task.add_broadcast(counts.base)
+        if index is not None:
+            index.fill(np.array(np.iinfo(index.dtype).max, dtype=index.dtype))
+            task.add_reduction(index.base, ReductionOp.MIN)
+            task.add_broadcast(index.base)
+
+        task.add_scalar_arg(inverse is not None, ty.bool_)
+        task.add_scalar_arg(counts is not None, ty.bool_)
+        task.add_scalar_arg(index is not None, ty.bool_)
+        task.add_scalar_arg(self.shape, (ty.int64,))
 
-        if is_left:
-            self.fill(np.array(rhs.size, self.dtype))
-            task.add_reduction(self.base, ReductionOp.MIN)
-        else:
-            self.fill(np.array(0, self.dtype))
-            task.add_reduction(self.base, ReductionOp.MAX)
+        task.execute()
 
-        task.add_input(rhs.base)
-        task.add_input(v.base)
+    # Tests the elements of this array for membership in the sorted unique
+    # values of test, which are broadcast to all point tasks
+    @auto_convert("test", "mask")
+    def isin(self, test: Any, mask: Any, invert: bool) -> None:
+        task = self.context.create_auto_task(CuNumericOpCode.ISIN)
+        task.add_input(self.base)
+        task.add_input(test.base)
+        task.add_broadcast(test.base)
+        task.add_output(mask.base)
+        task.add_alignment(self.base, mask.base)
+        task.add_scalar_arg(invert, ty.bool_)
+        task.execute()
 
-        # every partition needs the value information
-        task.add_broadcast(v.base)
-        task.add_broadcast(self.base)
-        task.add_alignment(self.base, v.base)
+    # Builds a t-digest of the array, serialized as (mean, weight) pairs after
+    # a (compression, 0) header. The digests of the point tasks are merged
+    # through a reduction tree
+    def quantile_sketch(self, compression: int) -> NumPyThunk:
+        result = self.runtime.create_unbound_thunk(ty.float64)
 
-        task.add_scalar_arg(is_left, ty.bool_)
-        task.add_scalar_arg(rhs.size, ty.int64)
+        task = self.context.create_auto_task(CuNumericOpCode.QUANTILE_SKETCH)
+        task.add_output(result.base)
+        task.add_input(self.base)
+        task.add_scalar_arg(compression, ty.int32)
         task.execute()
 
+        if self.runtime.num_procs > 1:
+            result.base = self.context.tree_reduce(
+                CuNumericOpCode.QUANTILE_SKETCH_REDUCE, result.base
+            )
+
+        return result
+
+    @auto_convert("rhs", "v")
+    def searchsorted(self, rhs: Any, v: Any, side: SortSide = "left") -> None:
+        searchsorted(self, rhs, v, side == "left")
+
     @auto_convert("rhs")
     def sort(
         self,
@@ -3519,6 +3803,15 @@ class DeferredArray(NumPyThunk):
 
         sort(self, rhs, argsort, axis, stable)
 
+    def lexsort(self, keys: Sequence[Any], axis: int = -1) -> None:
+        lexsort(
+            self, [self.runtime.to_deferred_array(key) for key in keys], axis
+        )
+
+    @auto_convert("values", "indices")
+    def topk(self, values: Any, indices: Any, k: int, largest: bool) -> None:
+        topk(values, indices, self, k, largest)
+
     @auto_convert("rhs")
     def partition(
         self,
@@ -3537,8 +3830,15 @@ class DeferredArray(NumPyThunk):
         if axis is not None and (axis >= rhs.ndim or axis < -rhs.ndim):
             raise ValueError("invalid axis")
 
-        # fallback to sort for now
-        sort(self, rhs, argpartition, axis, False)
+        extent = rhs.size if axis is None else rhs.shape[axis]
+        normalized: set[int] = set()
+        for value in np.ravel(kth):
+            k = int(value)
+            if k < -extent or k >= extent:
+                raise ValueError(f"kth(={k}) out of bounds ({extent})")
+            normalized.add(k + extent if k < 0 else k)
+
+        partition(self, rhs, sorted(normalized), argpartition, axis)
 
     def create_window(self, op_code: WindowOpCode, M: int, *args: Any) -> None:
         task = self.context.create_auto_task(CuNumericOpCode.WINDOW)
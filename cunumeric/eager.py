@@ -35,6 +35,7 @@ from .config import (
     BinaryOpCode,
     ConvertCode,
     FFTDirection,
+    FusedInstrKind,
     ScanCode,
     UnaryOpCode,
     UnaryRedCode,
@@ -167,6 +168,25 @@ _BINARY_OPS: Dict[BinaryOpCode, Any] = {
     BinaryOpCode.SUBTRACT: np.subtract,
 }
 
+_SCAN_OPS: Dict[ScanCode, Any] = {
+    ScanCode.BITWISE_AND: np.bitwise_and,
+    ScanCode.BITWISE_OR: np.bitwise_or,
+    ScanCode.BITWISE_XOR: np.bitwise_xor,
+    ScanCode.LOGADDEXP: np.logaddexp,
+    ScanCode.LOGICAL_AND: np.logical_and,
+    ScanCode.LOGICAL_OR: np.logical_or,
+    ScanCode.LOGICAL_XOR: np.logical_xor,
+    ScanCode.MAX: np.maximum,
+    ScanCode.MIN: np.minimum,
+}
+
+_SEGMENTED_RED_OPS: Dict[UnaryRedCode, Any] = {
+    UnaryRedCode.MAX: np.maximum,
+    UnaryRedCode.MIN: np.minimum,
+    UnaryRedCode.PROD: np.multiply,
+    UnaryRedCode.SUM: np.add,
+}
+
 _WINDOW_OPS: Dict[
     WindowOpCode,
     Union[
@@ -355,6 +375,32 @@ class EagerArray(NumPyThunk):
 
                 out.array = convolve(self.array, v.array, mode)
 
+    def diff(self, rhs: Any, n: int, axis: int) -> None:
+        self.check_eager_args(rhs)
+        if self.deferred is not None:
+            self.deferred.diff(rhs, n, axis)
+        else:
+            self.array[...] = np.diff(rhs.array, n=n, axis=axis)
+
+    def gradient(
+        self,
+        rhs: Any,
+        axis: int,
+        edge_order: int,
+        spacing: float,
+        coords: Optional[Any],
+    ) -> None:
+        self.check_eager_args(rhs, coords)
+        if self.deferred is not None:
+            self.deferred.gradient(rhs, axis, edge_order, spacing, coords)
+        else:
+            self.array[...] = np.gradient(
+                rhs.array,
+                spacing if coords is None else coords.array,
+                axis=axis,
+                edge_order=edge_order,
+            )
+
     def fft(
         self,
         rhs: Any,
@@ -736,6 +782,23 @@ class EagerArray(NumPyThunk):
             else:
                 self.array = np.sort(rhs.array, axis, kind, order)
 
+    def lexsort(self, keys: Sequence[Any], axis: int = -1) -> None:
+        self.check_eager_args(*keys)
+        if self.deferred is not None:
+            self.deferred.lexsort(keys, axis)
+        else:
+            self.array = np.lexsort(tuple(key.array for key in keys), axis)
+
+    def topk(self, values: Any, indices: Any, k: int, largest: bool) -> None:
+        self.check_eager_args(values, indices)
+        if self.deferred is not None:
+            self.deferred.topk(values, indices, k, largest)
+        else:
+            order = np.argsort(self.array, kind="stable")
+            order = order[::-1][:k] if largest else order[:k]
+            values.array[:] = self.array[order]
+            indices.array[:] = order
+
     def bitgenerator_random_raw(
         self,
         handle: int,
@@ -1550,6 +1613,18 @@ class EagerArray(NumPyThunk):
                 keepdims=keepdims,
                 out=self.array,
             )
+        elif op == UnaryRedCode.WELFORD:
+            (ddof,) = args
+            np.var(
+                rhs.array,
+                axis=orig_axis,
+                ddof=ddof,
+                where=where
+                if not isinstance(where, EagerArray)
+                else where.array,
+                keepdims=keepdims,
+                out=self.array,
+            )
         elif op == UnaryRedCode.CONTAINS:
             self.array.fill(args[0] in rhs.array)
         elif op == UnaryRedCode.COUNT_NONZERO:
@@ -1557,6 +1632,39 @@ class EagerArray(NumPyThunk):
         else:
             raise RuntimeError("unsupported unary reduction op " + str(op))
 
+    def segmented_reduction(
+        self,
+        op: UnaryRedCode,
+        rhs: Any,
+        offsets: Any,
+        axis: int,
+        monotonic: bool,
+    ) -> None:
+        self.check_eager_args(rhs, offsets)
+        if self.deferred is not None:
+            self.deferred.segmented_reduction(
+                op, rhs, offsets, axis, monotonic
+            )
+            return
+        _SEGMENTED_RED_OPS[op].reduceat(
+            rhs.array, offsets.array, axis=axis, out=self.array
+        )
+
+    def scalar_stats(self, outputs: Sequence[Any]) -> None:
+        self.check_eager_args(*outputs)
+        if self.deferred is not None:
+            self.deferred.scalar_stats(outputs)
+            return
+        stats = (
+            np.amin(self.array),
+            np.amax(self.array),
+            np.sum(self.array, dtype=outputs[2].array.dtype),
+            np.count_nonzero(self.array),
+            np.count_nonzero(np.isnan(self.array)),
+        )
+        for out, value in zip(outputs, stats):
+            out.array.fill(value)
+
     def isclose(
         self, rhs1: Any, rhs2: Any, rtol: float, atol: float, equal_nan: bool
     ) -> None:
@@ -1591,6 +1699,31 @@ class EagerArray(NumPyThunk):
                 else where.array,
             )
 
+    def fused_op(
+        self,
+        instrs: Sequence[tuple[int, int, int, int]],
+        constants: Sequence[float],
+        srcs: Sequence[Any],
+    ) -> None:
+        self.check_eager_args(*srcs)
+        if self.deferred is not None:
+            self.deferred.fused_op(instrs, constants, srcs)
+            return
+        regs: list[Any] = []
+        for kind, op, src1, src2 in instrs:
+            if kind == FusedInstrKind.INPUT:
+                regs.append(srcs[src1].array)
+            elif kind == FusedInstrKind.CONSTANT:
+                regs.append(self.dtype.type(constants[src1]))
+            elif kind == FusedInstrKind.UNARY:
+                regs.append(_UNARY_OPS[UnaryOpCode(op)](regs[src1]))
+            elif kind == FusedInstrKind.BINARY:
+                func = _BINARY_OPS[BinaryOpCode(op)]
+                regs.append(func(regs[src1], regs[src2]))
+            else:
+                raise RuntimeError(f"unsupported fused instruction {kind}")
+        self.array[...] = regs[-1]
+
     def binary_reduction(
         self,
         op: BinaryOpCode,
@@ -1689,6 +1822,10 @@ class EagerArray(NumPyThunk):
                 np.cumprod(rhs.array, axis, dtype, self.array)
             else:
                 np.nancumprod(rhs.array, axis, dtype, self.array)
+        elif op in _SCAN_OPS:
+            _SCAN_OPS[op].accumulate(
+                rhs.array, axis=axis, dtype=dtype, out=self.array
+            )
         else:
             raise RuntimeError(f"unsupported scan op {op}")
 
@@ -1698,6 +1835,53 @@ class EagerArray(NumPyThunk):
         else:
             return EagerArray(self.runtime, np.unique(self.array))
 
+    def unique_inverse(
+        self,
+        unique: Any,
+        inverse: Optional[Any],
+        counts: Optional[Any],
+        index: Optional[Any],
+    ) -> None:
+        self.check_eager_args(unique, inverse, counts, index)
+        if self.deferred is not None:
+            self.deferred.unique_inverse(unique, inverse, counts, index)
+        else:
+            _, res_index, res_inverse, res_counts = np.unique(
+                self.array,
+                return_index=True,
+                return_inverse=True,
+                return_counts=True,
+            )
+            if inverse is not None:
+                inverse.array[:] = res_inverse.reshape(self.array.shape)
+            if counts is not None:
+                counts.array[:] = res_counts
+            if index is not None:
+                index.array[:] = res_index
+
+    def isin(self, test: Any, mask: Any, invert: bool) -> None:
+        self.check_eager_args(test, mask)
+        if self.deferred is not None:
+            self.deferred.isin(test, mask, invert)
+        else:
+            mask.array[...] = np.isin(
+                self.array, test.array, assume_unique=True, invert=invert
+            )
+
+    def quantile_sketch(self, compression: int) -> NumPyThunk:
+        if self.deferred is not None:
+            return self.deferred.quantile_sketch(compression)
+        else:
+            # Eager arrays are small enough to keep every value in a cluster
+            # of its own, which makes the sketch exact
+            values = self.array.astype(np.float64).ravel()
+            values = np.sort(values[~np.isnan(values)])
+            sketch = np.empty(2 * (values.size + 1), dtype=np.float64)
+            sketch[:2] = (compression, 0.0)
+            sketch[2::2] = values
+            sketch[3::2] = 1.0
+            return EagerArray(self.runtime, sketch)
+
     def create_window(self, op_code: WindowOpCode, M: int, *args: Any) -> None:
         if self.deferred is not None:
             return self.deferred.create_window(op_code, M, *args)
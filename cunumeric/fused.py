@@ -0,0 +1,377 @@
+# Copyright 2023 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+from __future__ import annotations
+
+from functools import wraps
+from typing import Any, Callable, Sequence, Union
+
+import numpy as np
+
+from .array import convert_to_cunumeric_ndarray, ndarray
+from .config import BinaryOpCode, FusedInstrKind, UnaryOpCode
+
+# These limits must match the ones in src/cunumeric/fused/fused_op_util.h
+MAX_FUSED_INPUTS = 8
+MAX_FUSED_INSTRS = 32
+MAX_FUSED_CONSTANTS = 16
+
+_FUSIBLE_DTYPES = (np.dtype(np.float32), np.dtype(np.float64))
+
+# Operations that map a floating point value to a value of the same type
+# and that need no extra arguments. Keep this in sync with the functor
+# table in src/cunumeric/fused/fused_op_util.h
+_FUSIBLE_UNARY_OPS = frozenset(
+    (
+        UnaryOpCode.ABSOLUTE,
+        UnaryOpCode.ARCCOS,
+        UnaryOpCode.ARCSIN,
+        UnaryOpCode.ARCTAN,
+        UnaryOpCode.CBRT,
+        UnaryOpCode.CEIL,
+        UnaryOpCode.COS,
+        UnaryOpCode.COSH,
+        UnaryOpCode.EXP,
+        UnaryOpCode.EXP2,
+        UnaryOpCode.EXPM1,
+        UnaryOpCode.FLOOR,
+        UnaryOpCode.LOG,
+        UnaryOpCode.LOG10,
+        UnaryOpCode.LOG1P,
+        UnaryOpCode.LOG2,
+        UnaryOpCode.NEGATIVE,
+        UnaryOpCode.POSITIVE,
+        UnaryOpCode.RECIPROCAL,
+        UnaryOpCode.RINT,
+        UnaryOpCode.SIGN,
+        UnaryOpCode.SIN,
+        UnaryOpCode.SINH,
+        UnaryOpCode.SQRT,
+        UnaryOpCode.SQUARE,
+        UnaryOpCode.TAN,
+        UnaryOpCode.TANH,
+        UnaryOpCode.TRUNC,
+    )
+)
+
+_FUSIBLE_BINARY_OPS = frozenset(
+    (
+        BinaryOpCode.ADD,
+        BinaryOpCode.ARCTAN2,
+        BinaryOpCode.COPYSIGN,
+        BinaryOpCode.DIVIDE,
+        BinaryOpCode.FMOD,
+        BinaryOpCode.HYPOT,
+        BinaryOpCode.MAXIMUM,
+        BinaryOpCode.MINIMUM,
+        BinaryOpCode.MULTIPLY,
+        BinaryOpCode.POWER,
+        BinaryOpCode.SUBTRACT,
+    )
+)
+
+
+class _NotFusible(Exception):
+    """
+    Raised during tracing when the traced function does something that
+    cannot be expressed as a fused element-wise expression
+    """
+
+    pass
+
+
+class FusedExpr:
+    """
+    Placeholder value recorded while tracing a function decorated with
+    :func:`fuse`. Each node is either an input array, a scalar constant,
+    or an element-wise operation on other nodes.
+    """
+
+    # Make NumPy defer to our reflected operators
+    __array_priority__ = 1000
+
+    def __init__(
+        self,
+        kind: FusedInstrKind,
+        op_code: Union[UnaryOpCode, BinaryOpCode, None] = None,
+        operands: tuple[FusedExpr, ...] = (),
+        value: Any = None,
+    ) -> None:
+        self.kind = kind
+        self.op_code = op_code
+        self.operands = operands
+        self.value = value
+
+    @staticmethod
+    def wrap(value: Any) -> FusedExpr:
+        if isinstance(value, FusedExpr):
+            return value
+        if isinstance(value, (bool, np.bool_, complex, np.complexfloating)):
+            raise _NotFusible()
+        if isinstance(value, (int, float, np.integer, np.floating)):
+            return FusedExpr(FusedInstrKind.CONSTANT, value=float(value))
+        # Any other array-like object captured by the traced function
+        # becomes an extra input of the fused expression
+        try:
+            array = convert_to_cunumeric_ndarray(value)
+        except Exception:
+            raise _NotFusible()
+        return FusedExpr(FusedInstrKind.INPUT, value=array)
+
+    @staticmethod
+    def unary(op_code: UnaryOpCode, x: Any) -> FusedExpr:
+        if op_code not in _FUSIBLE_UNARY_OPS:
+            raise _NotFusible()
+        return FusedExpr(
+            FusedInstrKind.UNARY, op_code, (FusedExpr.wrap(x),)
+        )
+
+    @staticmethod
+    def binary(op_code: BinaryOpCode, x1: Any, x2: Any) -> FusedExpr:
+        if op_code not in _FUSIBLE_BINARY_OPS:
+            raise _NotFusible()
+        return FusedExpr(
+            FusedInstrKind.BINARY,
+            op_code,
+            (FusedExpr.wrap(x1), FusedExpr.wrap(x2)),
+        )
+
+    def __add__(self, rhs: Any) -> FusedExpr:
+        return FusedExpr.binary(BinaryOpCode.ADD, self, rhs)
+
+    def __radd__(self, lhs: Any) -> FusedExpr:
+        return FusedExpr.binary(BinaryOpCode.ADD, lhs, self)
+
+    def __sub__(self, rhs: Any) -> FusedExpr:
+        return FusedExpr.binary(BinaryOpCode.SUBTRACT, self, rhs)
+
+    def __rsub__(self, lhs: Any) -> FusedExpr:
+        return FusedExpr.binary(BinaryOpCode.SUBTRACT, lhs, self)
+
+    def __mul__(self, rhs: Any) -> FusedExpr:
+        return FusedExpr.binary(BinaryOpCode.MULTIPLY, self, rhs)
+
+    def __rmul__(self, lhs: Any) -> FusedExpr:
+        return FusedExpr.binary(BinaryOpCode.MULTIPLY, lhs, self)
+
+    def __truediv__(self, rhs: Any) -> FusedExpr:
+        return FusedExpr.binary(BinaryOpCode.DIVIDE, self, rhs)
+
+    def __rtruediv__(self, lhs: Any) -> FusedExpr:
+        return FusedExpr.binary(BinaryOpCode.DIVIDE, lhs, self)
+
+    def __pow__(self, rhs: Any) -> FusedExpr:
+        return FusedExpr.binary(BinaryOpCode.POWER, self, rhs)
+
+    def __rpow__(self, lhs: Any) -> FusedExpr:
+        return FusedExpr.binary(BinaryOpCode.POWER, lhs, self)
+
+    def __neg__(self) -> FusedExpr:
+        return FusedExpr.unary(UnaryOpCode.NEGATIVE, self)
+
+    def __pos__(self) -> FusedExpr:
+        return FusedExpr.unary(UnaryOpCode.POSITIVE, self)
+
+    def __abs__(self) -> FusedExpr:
+        return FusedExpr.unary(UnaryOpCode.ABSOLUTE, self)
+
+    def __array_ufunc__(
+        self, ufunc: Any, method: str, *inputs: Any, **kwargs: Any
+    ) -> Any:
+        from . import _ufunc
+
+        if method != "__call__" or not hasattr(_ufunc, ufunc.__name__):
+            raise _NotFusible()
+        return getattr(_ufunc, ufunc.__name__)(*inputs, **kwargs)
+
+    # Anything that needs the actual values (conversions, control flow,
+    # indexing, reductions, ...) or that produces non-floating point values
+    # ends the trace
+    def _not_fusible(self, *args: Any, **kwargs: Any) -> Any:
+        raise _NotFusible()
+
+    __array__ = _not_fusible
+    __lt__ = __le__ = __gt__ = __ge__ = _not_fusible
+    __eq__ = __ne__ = _not_fusible  # type: ignore [assignment]
+    __floordiv__ = __rfloordiv__ = __mod__ = __rmod__ = _not_fusible
+    __and__ = __rand__ = __or__ = __ror__ = __xor__ = __rxor__ = _not_fusible
+    __lshift__ = __rlshift__ = __rshift__ = __rrshift__ = _not_fusible
+    __invert__ = __matmul__ = __rmatmul__ = _not_fusible
+    __hash__ = object.__hash__
+
+    def __bool__(self) -> bool:
+        raise _NotFusible()
+
+    def __len__(self) -> int:
+        raise _NotFusible()
+
+    def __iter__(self) -> Any:
+        raise _NotFusible()
+
+    def __getitem__(self, key: Any) -> Any:
+        raise _NotFusible()
+
+    def __getattr__(self, name: str) -> Any:
+        if name.startswith("__"):
+            raise AttributeError(name)
+        raise _NotFusible()
+
+
+def is_fused_expr(args: Sequence[Any]) -> bool:
+    return any(isinstance(arg, FusedExpr) for arg in args)
+
+
+def trace_ufunc_call(
+    op_code: Union[UnaryOpCode, BinaryOpCode],
+    args: Sequence[Any],
+    nin: int,
+    out: Any,
+    where: Any,
+    dtype: Any,
+    kwargs: dict[str, Any],
+) -> FusedExpr:
+    if (
+        len(args) != nin
+        or out is not None
+        or where is not True
+        or dtype is not None
+        or len(kwargs) > 0
+    ):
+        raise _NotFusible()
+    if nin == 1:
+        assert isinstance(op_code, UnaryOpCode)
+        return FusedExpr.unary(op_code, args[0])
+    assert isinstance(op_code, BinaryOpCode)
+    return FusedExpr.binary(op_code, args[0], args[1])
+
+
+def _linearize(
+    root: FusedExpr,
+) -> tuple[list[tuple[int, int, int, int]], list[float], list[ndarray]]:
+    instrs: list[tuple[int, int, int, int]] = []
+    constants: list[float] = []
+    inputs: list[ndarray] = []
+    registers: dict[int, int] = {}
+    input_slots: dict[int, int] = {}
+
+    def visit(node: FusedExpr) -> int:
+        if id(node) in registers:
+            return registers[id(node)]
+
+        srcs = [visit(operand) for operand in node.operands]
+        if node.kind == FusedInstrKind.INPUT:
+            # The same array can be captured multiple times
+            key = id(node.value)
+            if key not in input_slots:
+                input_slots[key] = len(inputs)
+                inputs.append(node.value)
+            instr = (node.kind, 0, input_slots[key], 0)
+        elif node.kind == FusedInstrKind.CONSTANT:
+            constants.append(node.value)
+            instr = (node.kind, 0, len(constants) - 1, 0)
+        elif node.kind == FusedInstrKind.UNARY:
+            instr = (node.kind, node.op_code, srcs[0], 0)
+        else:
+            instr = (node.kind, node.op_code, srcs[0], srcs[1])
+
+        registers[id(node)] = len(instrs)
+        instrs.append(tuple(int(field) for field in instr))  # type: ignore
+        return registers[id(node)]
+
+    visit(root)
+    return instrs, constants, inputs
+
+
+def _evaluate(root: Any) -> ndarray:
+    if not isinstance(root, FusedExpr) or root.kind not in (
+        FusedInstrKind.UNARY,
+        FusedInstrKind.BINARY,
+    ):
+        raise _NotFusible()
+
+    instrs, constants, inputs = _linearize(root)
+    if (
+        len(instrs) > MAX_FUSED_INSTRS
+        or len(inputs) > MAX_FUSED_INPUTS
+        or len(constants) > MAX_FUSED_CONSTANTS
+    ):
+        raise _NotFusible()
+
+    dtype = np.result_type(*(arr.dtype for arr in inputs))
+    if dtype not in _FUSIBLE_DTYPES:
+        raise _NotFusible()
+
+    shape = np.broadcast_shapes(*(arr.shape for arr in inputs))
+    if 0 in shape:
+        raise _NotFusible()
+
+    inputs = [arr._astype(dtype, temporary=True) for arr in inputs]
+    result = ndarray(shape=shape, dtype=dtype, inputs=inputs)
+    result._thunk.fused_op(
+        instrs, constants, tuple(arr._thunk for arr in inputs)
+    )
+    return result
+
+
+def fuse(func: Callable[..., Any]) -> Callable[..., Any]:
+    """
+    Compile an element-wise expression into a single fused task.
+
+    The decorated function is traced once per call with placeholder values
+    in place of its array arguments. Arithmetic operators and the
+    supported ufuncs applied to the placeholders are recorded into an
+    expression DAG, which is then evaluated by one task that reads each
+    input once and writes the result once, without materializing any
+    intermediate arrays.
+
+    Parameters
+    ----------
+    func : Callable
+        A function that takes arrays and/or scalars and returns a single
+        array computed element-wise from them. Arrays the function captures
+        from its enclosing scope become additional inputs.
+
+    Returns
+    -------
+    wrapper : Callable
+        A function with the same signature as ``func``.
+
+    Notes
+    -----
+    Only ``float32`` and ``float64`` inputs are fused, and the whole
+    expression is computed in the common type of the inputs. Expressions
+    that use unsupported operations, keyword arguments like ``out`` or
+    ``where``, data-dependent control flow, or that exceed the size limits
+    of the fused task are executed by calling ``func`` directly. Because
+    the function is first traced, it may be invoked twice in that case.
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+    """
+
+    @wraps(func)
+    def wrapper(*args: Any, **kwargs: Any) -> Any:
+        try:
+            traced_args = tuple(
+                arg
+                if isinstance(arg, (int, float, np.integer, np.floating))
+                else FusedExpr.wrap(arg)
+                for arg in args
+            )
+            return _evaluate(func(*traced_args, **kwargs))
+        except _NotFusible:
+            return func(*args, **kwargs)
+
+    return wrapper
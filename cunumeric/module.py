@@ -24,6 +24,7 @@ from typing import (
     Any,
     Iterable,
     Literal,
+    NamedTuple,
     Optional,
     Sequence,
     Tuple,
@@ -5659,6 +5660,224 @@ def nancumsum(
     )
 
 
+@add_boilerplate("a")
+def diff(
+    a: ndarray,
+    n: int = 1,
+    axis: int = -1,
+    prepend: Any = None,
+    append: Any = None,
+) -> ndarray:
+    """
+    Calculate the n-th discrete difference along the given axis.
+
+    The first difference is given by ``out[i] = a[i+1] - a[i]`` along the
+    given axis, higher differences are calculated by using `diff`
+    recursively.
+
+    Parameters
+    ----------
+    a : array_like
+        Input array
+    n : int, optional
+        The number of times values are differenced. If zero, the input is
+        returned as-is.
+    axis : int, optional
+        The axis along which the difference is taken, default is the last
+        axis.
+    prepend, append : array_like, optional
+        Values to prepend or append to `a` along axis prior to performing the
+        difference. Scalar values are expanded to arrays with length 1 in the
+        direction of axis and the shape of the input array in along all other
+        axes. Otherwise the dimension and shape must match `a` except along
+        axis.
+
+    Returns
+    -------
+    diff : ndarray
+        The n-th differences. The shape of the output is the same as `a`
+        except along `axis` where the dimension is smaller by `n`. The type of
+        the output is the same as the type of `a`. Boolean arrays are
+        differenced with ``not_equal``.
+
+    See Also
+    --------
+    numpy.diff
+
+    Notes
+    -----
+    All n differences are computed in a single pass over the input, without
+    materializing the intermediate differences.
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+    """
+    if n == 0:
+        return a
+    if n < 0:
+        raise ValueError(f"order must be non-negative but got {n}")
+    if a.ndim == 0:
+        raise ValueError(
+            "diff requires input that is at least one dimensional"
+        )
+    axis = normalize_axis_index(axis, a.ndim)
+
+    def expand(values: Any) -> ndarray:
+        values = convert_to_cunumeric_ndarray(values)
+        if values.ndim > 0:
+            return values
+        shape = a.shape[:axis] + (1,) + a.shape[axis + 1 :]
+        return broadcast_to(values, shape)
+
+    if prepend is not None or append is not None:
+        combined = [a]
+        if prepend is not None:
+            combined.insert(0, expand(prepend))
+        if append is not None:
+            combined.append(expand(append))
+        a = concatenate(combined, axis=axis)
+
+    extent = max(a.shape[axis] - n, 0)
+    out = ndarray(
+        shape=a.shape[:axis] + (extent,) + a.shape[axis + 1 :],
+        dtype=a.dtype,
+        inputs=(a,),
+    )
+    if out.size > 0:
+        out._thunk.diff(a._thunk, n, axis)
+    return out
+
+
+@add_boilerplate("f")
+def gradient(
+    f: ndarray,
+    *varargs: Any,
+    axis: Union[int, Sequence[int], None] = None,
+    edge_order: int = 1,
+) -> Union[ndarray, tuple[ndarray, ...]]:
+    """
+    Return the gradient of an N-dimensional array.
+
+    The gradient is computed using second order accurate central differences
+    in the interior points and either first or second order accurate
+    one-sides (forward or backwards) differences at the boundaries. The
+    returned gradient hence has the same shape as the input array.
+
+    Parameters
+    ----------
+    f : array_like
+        An N-dimensional array containing samples of a scalar function.
+    varargs : list of scalar or array, optional
+        Spacing between f values. Default unitary spacing for all dimensions.
+        Spacing can be specified using:
+
+        1. single scalar to specify a sample distance for all dimensions.
+        2. N scalars to specify a constant sample distance for each
+           dimension. i.e. `dx`, `dy`, `dz`, ...
+        3. N arrays to specify the coordinates of the values along each
+           dimension of F. The length of the array must match the size of
+           the corresponding dimension
+        4. Any combination of N scalars/arrays with the meaning of 2. and 3.
+
+        If `axis` is given, the number of varargs must equal the number of
+        axes.
+    edge_order : {1, 2}, optional
+        Gradient is calculated using N-th order accurate differences at the
+        boundaries.
+    axis : None or int or tuple of ints, optional
+        Gradient is calculated only along the given axis or axes. The default
+        (axis = None) is to calculate the gradient for all the axes of the
+        input array. axis may be negative, in which case it counts from the
+        last to the first axis.
+
+    Returns
+    -------
+    gradient : ndarray or tuple of ndarray
+        A tuple of ndarrays (or a single ndarray if there is only one
+        dimension) corresponding to the derivatives of f with respect to each
+        dimension. Each derivative has the same shape as f.
+
+    See Also
+    --------
+    numpy.gradient
+
+    Notes
+    -----
+    Each derivative is computed in a single pass over the input, which reads
+    the neighbors of every element along the axis directly.
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+    """
+    if axis is None:
+        axes = tuple(range(f.ndim))
+    else:
+        axes = normalize_axis_tuple(axis, f.ndim)
+
+    if len(varargs) == 0:
+        spacings = [1.0] * len(axes)
+    elif len(varargs) == 1 and np.ndim(varargs[0]) == 0:
+        spacings = [varargs[0]] * len(axes)
+    elif len(varargs) == len(axes):
+        spacings = list(varargs)
+    else:
+        raise TypeError("invalid number of arguments")
+
+    if edge_order > 2:
+        raise ValueError("'edge_order' greater than 2 not supported")
+    # The stencils at the edges are only defined for first and second order
+    if edge_order not in (1, 2):
+        raise ValueError("'edge_order' must be 1 or 2")
+    if f.dtype == bool:
+        raise TypeError(
+            "numpy boolean subtract, the `-` operator, is not supported"
+        )
+    # Integers have floating-point gradients
+    dtype = f.dtype if f.dtype.kind in "fc" else np.dtype(np.float64)
+
+    outvals = []
+    for ax, spacing in zip(axes, spacings):
+        if f.shape[ax] < edge_order + 1:
+            raise ValueError(
+                "Shape of array too small to calculate a numerical gradient, "
+                "at least (edge_order + 1) elements are required."
+            )
+        coords = None
+        distances = convert_to_cunumeric_ndarray(spacing)
+        if distances.ndim == 0:
+            spacing = float(distances)
+        elif distances.ndim != 1:
+            raise ValueError("distances must be either scalars or 1d")
+        elif distances.size != f.shape[ax]:
+            raise ValueError(
+                "when 1d, distances must match the length of the "
+                "corresponding dimension"
+            )
+        else:
+            coords = distances.astype(np.float64)
+            deltas = diff(coords)
+            # Evenly spaced coordinates are treated as a scalar spacing
+            if bool((deltas == deltas[0]).all()):
+                spacing = float(deltas[0])
+                coords = None
+
+        out = ndarray(shape=f.shape, dtype=dtype, inputs=(f,))
+        out._thunk.gradient(
+            f._thunk,
+            ax,
+            edge_order,
+            spacing,
+            None if coords is None else coords._thunk,
+        )
+        outvals.append(out)
+
+    if len(axes) == 1:
+        return outvals[0]
+    return tuple(outvals)
+
+
 @add_boilerplate("a")
 def nanargmax(
     a: ndarray,
@@ -6527,7 +6746,7 @@ def unique(
     return_inverse: bool = False,
     return_counts: bool = False,
     axis: Optional[int] = None,
-) -> ndarray:
+) -> Union[ndarray, tuple[ndarray, ...]]:
     """
 
     Find the unique elements of an array.
@@ -6546,15 +6765,12 @@ def unique(
         If True, also return the indices of `ar` (along the specified axis,
         if provided, or in the flattened array) that result in the unique
         array.
-        Currently not supported.
     return_inverse : bool, optional
         If True, also return the indices of the unique array (for the specified
         axis, if provided) that can be used to reconstruct `ar`.
-        Currently not supported.
     return_counts : bool, optional
         If True, also return the number of times each unique item appears
         in `ar`.
-        Currently not supported.
     axis : int or None, optional
         The axis to operate on. If None, `ar` will be flattened. If an integer,
         the subarrays indexed by the given axis will be flattened and treated
@@ -6562,7 +6778,6 @@ def unique(
         see the notes for more details.  Object arrays or structured arrays
         that contain objects are not supported if the `axis` kwarg is used. The
         default is None.
-        Currently not supported.
 
     Returns
     -------
@@ -6573,7 +6788,8 @@ def unique(
         original array. Only provided if `return_index` is True.
     unique_inverse : ndarray, optional
         The indices to reconstruct the original array from the
-        unique array. Only provided if `return_inverse` is True.
+        unique array, in the shape of the input if `axis` is None. Only
+        provided if `return_inverse` is True.
     unique_counts : ndarray, optional
         The number of times each of the unique values comes up in the
         original array. Only provided if `return_counts` is True.
@@ -6588,16 +6804,200 @@ def unique(
 
     Notes
     --------
-    Keyword arguments for optional outputs are not yet supported.
-    `axis` is also not handled currently.
+    The optional outputs are computed by a second pass that looks up every
+    element in the unique values. With `axis`, the subarrays are ranked one
+    column at a time, which takes one pass of `unique` per element of a
+    subarray.
 
     """
-    if _builtin_any((return_index, return_inverse, return_counts, axis)):
-        raise NotImplementedError(
-            "Keyword arguments for `unique` are not yet supported"
+    if axis is not None:
+        result, index, inverse, counts = _unique_axis(
+            ar, normalize_axis_index(axis, ar.ndim)
+        )
+    elif return_index or return_inverse or return_counts:
+        result, index, inverse, counts = _unique_with_outputs(
+            ar, return_index, return_inverse, return_counts
         )
+    else:
+        return ar.unique()
+
+    outputs = (result,)
+    if return_index:
+        outputs += (index,)
+    if return_inverse:
+        outputs += (inverse,)
+    if return_counts:
+        outputs += (counts,)
+    return outputs if len(outputs) > 1 else result
+
+
+_UniqueOutputs = tuple[ndarray, ndarray, ndarray, ndarray]
+
+
+def _unique_with_outputs(
+    ar: ndarray, return_index: bool, return_inverse: bool, return_counts: bool
+) -> _UniqueOutputs:
+    result = ar.unique()
+    # As in NumPy, the inverse has the shape of the input
+    shape = ar.shape
+    if ar.ndim == 0:
+        ar = ar.reshape(1)
+    # Outputs that were not asked for are left out of the lookup pass
+    index = ndarray(result.shape, dtype=np.int64)
+    inverse = ndarray(ar.shape, dtype=np.int64)
+    counts = ndarray(result.shape, dtype=np.int64)
+    ar._thunk.unique_inverse(
+        result._thunk,
+        inverse._thunk if return_inverse else None,
+        counts._thunk if return_counts else None,
+        index._thunk if return_index else None,
+    )
+    return result, index, inverse.reshape(shape), counts
+
+
+def _unique_axis(ar: ndarray, axis: int) -> _UniqueOutputs:
+    # Subarrays along the axis become the rows of a matrix, which are ranked
+    # in lexicographic order by folding in one column at a time. The ranks are
+    # kept dense after every column, so they never exceed the number of rows
+    ar = moveaxis(ar, axis, 0)
+    shape = ar.shape
+    rows = ar.reshape(shape[0], -1)
+    ranks = zeros(shape[0], dtype=np.int64)
+    for col in range(rows.shape[1]):
+        values, _, codes, _ = _unique_with_outputs(
+            rows[:, col], False, True, False
+        )
+        _, _, ranks, _ = _unique_with_outputs(
+            ranks * values.size + codes, False, True, False
+        )
+
+    _, index, inverse, counts = _unique_with_outputs(ranks, True, True, True)
+    result = moveaxis(rows[index].reshape((index.size,) + shape[1:]), 0, axis)
+    return result, index, inverse, counts
 
-    return ar.unique()
+
+# Boolean operations
+
+
+@add_boilerplate("ar1", "ar2")
+def in1d(
+    ar1: ndarray,
+    ar2: ndarray,
+    assume_unique: bool = False,
+    invert: bool = False,
+) -> ndarray:
+    """
+    Test whether each element of a 1-D array is also present in a second
+    array.
+
+    Returns a boolean array the same length as `ar1` that is True
+    where an element of `ar1` is in `ar2` and False otherwise.
+
+    Parameters
+    ----------
+    ar1 : (M,) array_like
+        Input array. It is flattened if it is not already 1-D.
+    ar2 : array_like
+        The values against which to test each value of `ar1`.
+    assume_unique : bool, optional
+        If True, the input arrays are both assumed to be unique, which
+        can speed up the calculation.  Default is False.
+    invert : bool, optional
+        If True, the values in the returned array are inverted (that is,
+        False where an element of `ar1` is in `ar2` and True otherwise).
+        Default is False. ``in1d(a, b, invert=True)`` is equivalent
+        to (but is faster than) ``logical_not(in1d(a, b))``.
+
+    Returns
+    -------
+    in1d : (M,) ndarray, bool
+        The values `ar1[in1d]` are in `ar2`.
+
+    See Also
+    --------
+    numpy.in1d
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+    """
+    return isin(ar1.ravel(), ar2, assume_unique=assume_unique, invert=invert)
+
+
+@add_boilerplate("element", "test_elements")
+def isin(
+    element: ndarray,
+    test_elements: ndarray,
+    assume_unique: bool = False,
+    invert: bool = False,
+) -> ndarray:
+    """
+    Calculates ``element in test_elements``, broadcasting over `element`
+    only. Returns a boolean array of the same shape as `element` that is
+    True where an element of `element` is in `test_elements` and False
+    otherwise.
+
+    Parameters
+    ----------
+    element : array_like
+        Input array.
+    test_elements : array_like
+        The values against which to test each value of `element`. This
+        argument is flattened if it is an array or array_like.
+    assume_unique : bool, optional
+        If True, the input arrays are both assumed to be unique, which
+        can speed up the calculation.  Default is False.
+    invert : bool, optional
+        If True, the values in the returned array are inverted, as if
+        calculating `element not in test_elements`. Default is False.
+        ``isin(a, b, invert=True)`` is equivalent to (but faster
+        than) ``logical_not(isin(a, b))``.
+
+    Returns
+    -------
+    isin : ndarray, bool
+        Has the same shape as `element`. The values `element[isin]`
+        are in `test_elements`.
+
+    See Also
+    --------
+    numpy.isin
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+
+    Notes
+    --------
+    The unique values of `test_elements` are sorted and broadcast to all
+    processors, which then test the elements of `element` they hold in
+    place. Integers are looked up in a hash set on CPUs, and everything
+    else by binary search.
+
+    """
+    dtype = np.result_type(element.dtype, test_elements.dtype)
+    if element.dtype != dtype:
+        element = element.astype(dtype)
+    if test_elements.dtype != dtype:
+        test_elements = test_elements.astype(dtype)
+
+    result = ndarray(element.shape, dtype=bool, inputs=(element,))
+    if element.size == 0:
+        return result
+    if assume_unique:
+        test = sort(test_elements, axis=None)
+    else:
+        test = test_elements.unique()
+    if test.size == 0:
+        result.fill(invert)
+        return result
+
+    if element.ndim == 0:
+        mask = ndarray((1,), dtype=bool, inputs=(element,))
+        element.reshape(1)._thunk.isin(test._thunk, mask._thunk, invert)
+        return mask.reshape(())
+    element._thunk.isin(test._thunk, result._thunk, invert)
+    return result
 
 
 ##################################
@@ -6653,6 +7053,56 @@ def argsort(
     return result
 
 
+def lexsort(keys: Any, axis: int = -1) -> ndarray:
+    """
+
+    Perform an indirect stable sort using a sequence of keys.
+
+    Given multiple sorting keys, lexsort returns an array of integer indices
+    that describes the sort order by multiple keys. The last key in the
+    sequence is used for the primary sort order, ties are broken by the
+    second-to-last key, and so on.
+
+    Parameters
+    ----------
+    keys : (k, N) array_like or tuple of k (N,)-shaped array_likes
+        The `k` keys to be sorted. The last key (e.g, the last row if `keys`
+        is a 2D array) is the primary sort key. Each element of `keys` along
+        the zeroth axis must be an array-like object of the same shape.
+    axis : int, optional
+        Axis to be indirectly sorted. By default, sort over the last axis.
+
+    Returns
+    -------
+    indices : (N,) ndarray[int]
+        Array of indices that sort the keys along the specified axis.
+
+    See Also
+    --------
+    numpy.lexsort
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+    """
+    if isinstance(keys, (ndarray, np.ndarray)):
+        keys = [keys[i] for i in range(keys.shape[0])] if keys.ndim > 0 else []
+    arrays = [convert_to_cunumeric_ndarray(key) for key in keys]
+    if len(arrays) == 0:
+        raise TypeError("need sequence of keys with len > 0 in lexsort")
+    shape = arrays[0].shape
+    if any(array.shape != shape for array in arrays):
+        raise ValueError("all keys need to be the same shape")
+
+    if len(shape) == 0:
+        return zeros((), dtype=np.int64)
+    axis = normalize_axis_index(axis, len(shape))
+    result = ndarray(shape, np.int64, inputs=arrays)
+    if result.size > 0:
+        result._thunk.lexsort([array._thunk for array in arrays], axis)
+    return result
+
+
 def msort(a: ndarray) -> ndarray:
     """
 
@@ -6839,7 +7289,11 @@ def argpartition(
 
     Notes
     -----
-    The current implementation falls back to `cunumeric.argsort`.
+    On CPUs, the segments along the axis are partitioned by selection, each
+    within a single processor. One-dimensional arrays distributed over
+    several processors are instead partitioned around their kth elements,
+    which are found by a radix select. Other cases, including the
+    remaining partitions on GPUs, fall back to `cunumeric.argsort`.
 
     See Also
     --------
@@ -6894,7 +7348,11 @@ def partition(
 
     Notes
     -----
-    The current implementation falls back to `cunumeric.sort`.
+    On CPUs, the segments along the axis are partitioned by selection, each
+    within a single processor. One-dimensional arrays distributed over
+    several processors are instead partitioned around their kth elements,
+    which are found by a radix select. Other cases, including the
+    remaining partitions on GPUs, fall back to `cunumeric.sort`.
 
     See Also
     --------
@@ -6911,6 +7369,90 @@ def partition(
     return result
 
 
+@add_boilerplate("a")
+def topk(
+    a: ndarray,
+    k: int,
+    axis: Union[int, None] = -1,
+    largest: bool = True,
+) -> tuple[ndarray, ndarray]:
+    """
+
+    Returns the k largest or smallest elements along an axis, along with
+    their indices.
+
+    Parameters
+    ----------
+    a : array_like
+        Input array.
+    k : int
+        Number of elements to return along the axis.
+    axis : int or None, optional
+        Axis along which to select. By default, the index -1 (the last axis)
+        is used. If None, the flattened array is used.
+    largest : bool, optional
+        Whether to return the largest elements, the default, or the smallest
+        ones.
+
+    Returns
+    -------
+    values : ndarray
+        The selected elements, ordered from the best one down along the
+        axis, which has extent `k`. NaNs are larger than all other values,
+        as in `cunumeric.sort`.
+    indices : ndarray[int]
+        Indices of the selected elements along the axis.
+
+    Notes
+    -----
+    This function has no NumPy counterpart. It is equivalent to slicing the
+    result of a sort, but does not sort the whole array. One-dimensional
+    arrays of booleans, integers or floating-point values are searched by
+    every processor for its best `k` elements, and only these candidates
+    are merged. Segments along an axis are first partitioned by
+    `cunumeric.argpartition`, after which only their `k` selected elements
+    are sorted. Which of several equal elements are returned is unspecified.
+
+    See Also
+    --------
+    cunumeric.argpartition, cunumeric.argsort
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+    """
+    if axis is None:
+        a = a.ravel()
+        axis = 0
+    axis = normalize_axis_index(axis, a.ndim)
+    extent = a.shape[axis]
+    if k < 0 or k > extent:
+        raise ValueError(f"k(={k}) out of bounds ({extent})")
+
+    shape = a.shape[:axis] + (k,) + a.shape[axis + 1 :]
+    if k == 0 or a.size == 0:
+        return empty(shape, dtype=a.dtype), empty(shape, dtype=np.int64)
+
+    if a.ndim == 1 and a.dtype.kind in "biuf":
+        values = ndarray(shape, dtype=a.dtype, inputs=(a,))
+        indices = ndarray(shape, dtype=np.int64, inputs=(a,))
+        a._thunk.topk(values._thunk, indices._thunk, k, largest)
+        return values, indices
+
+    kth = extent - k if largest else k - 1
+    selected: list[Any] = [slice(None)] * a.ndim
+    selected[axis] = slice(kth, None) if largest else slice(None, k)
+    candidates = argpartition(a, kth, axis=axis)[tuple(selected)]
+    values = take_along_axis(a, candidates, axis)
+    order = argsort(values, axis=axis, kind="stable")
+    if largest:
+        order = flip(order, axis)
+    return (
+        take_along_axis(values, order, axis),
+        take_along_axis(candidates, order, axis),
+    )
+
+
 # Searching
 
 
@@ -7269,6 +7811,85 @@ def var(
     )
 
 
+# Summary statistics
+
+
+class SummaryStats(NamedTuple):
+    """
+    Statistics of an array returned by :func:`summary_stats`. Each field
+    is a 0-d array.
+    """
+
+    min: ndarray
+    max: ndarray
+    sum: ndarray
+    count_nonzero: ndarray
+    nan_count: ndarray
+
+
+@add_boilerplate("a")
+def summary_stats(a: ndarray) -> SummaryStats:
+    """
+    Compute the minimum, the maximum, the sum, the number of non-zero
+    values and the number of NaNs of an array in a single pass.
+
+    This is equivalent to calling :func:`amin`, :func:`amax`, :func:`sum`,
+    :func:`count_nonzero` and ``isnan(a).sum()`` on the flattened array,
+    but reads the array only once.
+
+    Parameters
+    ----------
+    a : array_like
+        Input data.
+
+    Returns
+    -------
+    stats : SummaryStats
+        A named tuple with fields ``min``, ``max``, ``sum``,
+        ``count_nonzero`` and ``nan_count``. The minimum and the maximum
+        have the type of ``a``, the sum has the default accumulation type
+        of :func:`numpy.sum`, and the counts are unsigned 64-bit integers.
+
+    Notes
+    -----
+    The minimum and the maximum treat NaNs the same way as :func:`amin`
+    and :func:`amax`.
+
+    See Also
+    --------
+    numpy.amin, numpy.amax, numpy.sum, numpy.count_nonzero
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+    """
+    if a.size == 0:
+        raise ValueError(
+            "zero-size array to reduction operation minimum which has no "
+            "identity"
+        )
+    if a.dtype.kind == "c":
+        raise NotImplementedError(
+            "summary_stats is not supported for complex-type arrays"
+        )
+
+    # Integer sums are accumulated in 64 bits like in NumPy
+    if a.dtype.kind == "b" or a.dtype.kind == "i":
+        sum_dtype = np.dtype(np.int64)
+    elif a.dtype.kind == "u":
+        sum_dtype = np.dtype(np.uint64)
+    else:
+        sum_dtype = a.dtype
+    count_dtype = np.dtype(np.uint64)
+
+    outputs = tuple(
+        ndarray(shape=(), dtype=dtype, inputs=(a,))
+        for dtype in (a.dtype, a.dtype, sum_dtype, count_dtype, count_dtype)
+    )
+    a._thunk.scalar_stats(tuple(out._thunk for out in outputs))
+    return SummaryStats(*outputs)
+
+
 # Histograms
 
 
@@ -7667,10 +8288,35 @@ def reshuffle_reshape(
     return (min_dim_index, arr_reshaped)
 
 
+# args:
+#
+# q_arr:  [in] quantile input values nd-array;
+# n:      [in] number of elements the quantiles are taken over;
+# method: [in] func(q, n) returning (gamma, j);
+#
+# return: sorted list of the distinct positions, in the sorted order,
+#         of the elements the quantiles interpolate between
+def quantile_ranks(
+    q_arr: npt.NDArray[Any],
+    n: int,
+    method: Callable[[float, int], tuple[float, int]],
+) -> list[int]:
+    if n == 0:
+        return []
+    ranks = set()
+    for q in q_arr.flat:
+        (_, j) = method(q, n)
+        ranks.add(j)
+        if j + 1 < n:
+            ranks.add(j + 1)
+    return sorted(ranks)
+
+
 # args:
 #
 # arr:      [in] source nd-array on which quantiles are calculated;
-#                preccondition: assumed sorted!
+#                preccondition: assumed partitioned around the positions
+#                returned by quantile_ranks!
 # q_arr:    [in] quantile input values nd-array;
 # axis:     [in] axis along which quantiles are calculated;
 # method:   [in] func(q, n) returning (gamma, j),
@@ -7897,21 +8543,23 @@ def quantile(
     #
     q_arr = np.asarray(q)
 
-    # in the future k-sort (partition)
-    # might be faster, for now it uses sort
-    # arr = partition(arr, k = floor(nq), axis = real_axis)
-    # but that would require a k-sort call for each `q`!
-    # too expensive for many `q` values...
-    # if no axis given then elements are sorted as a 1D array
+    if a_rr.dtype.kind == "c":
+        raise TypeError("input array cannot be of complex type")
+
+    # only the order statistics that the quantiles interpolate between are
+    # needed, so the array is partitioned around all of them at once rather
+    # than sorted; if no axis given then the array is partitioned as a 1D
+    # array
     #
-    if overwrite_input:
-        a_rr.sort(axis=real_axis)
+    n = a_rr.size if real_axis is None else a_rr.shape[real_axis]
+    kth = quantile_ranks(q_arr, n, dict_methods[method])
+    if len(kth) == 0:
+        arr = a_rr if real_axis is not None else a_rr.ravel()
+    elif overwrite_input and real_axis is not None:
+        a_rr.partition(kth, axis=real_axis)
         arr = a_rr
     else:
-        arr = sort(a_rr, axis=real_axis)
-
-    if arr.dtype.kind == "c":
-        raise TypeError("input array cannot be of complex type")
+        arr = partition(a_rr, kth, axis=real_axis)
 
     # return type dependency on arr.dtype:
     #
@@ -8066,6 +8714,201 @@ def percentile(
     )
 
 
+@add_boilerplate("a")
+def median(
+    a: ndarray,
+    axis: Union[None, int, tuple[int, ...]] = None,
+    out: Optional[ndarray] = None,
+    overwrite_input: bool = False,
+    keepdims: bool = False,
+) -> ndarray:
+    """
+    Compute the median along the specified axis.
+
+    Returns the median of the array elements.
+
+    Parameters
+    ----------
+    a : array_like
+        Input array or object that can be converted to an array.
+    axis : {int, sequence of int, None}, optional
+        Axis or axes along which the medians are computed. The default
+        is to compute the median along a flattened version of the array.
+    out : ndarray, optional
+        Alternative output array in which to place the result. It must
+        have the same shape and buffer length as the expected output.
+    overwrite_input : bool, optional
+        If True, then allow use of memory of input array `a` for
+        calculations. The input array will be modified by the call to
+        `median`. In this case, the contents of the input `a` after this
+        function completes is undefined.
+    keepdims : bool, optional
+        If this is set to True, the axes which are reduced are left
+        in the result as dimensions with size one. With this option,
+        the result will broadcast correctly against the original `arr`.
+
+    Returns
+    -------
+    median : ndarray
+        A new array holding the result. If the input contains integers
+        or floats smaller than ``float64``, then the output data-type is
+        ``np.float64``.  Otherwise, the data-type of the output is the
+        same as that of the input. If `out` is specified, that array is
+        returned instead.
+
+    See Also
+    --------
+    numpy.median
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+
+    Notes
+    --------
+    The array is partitioned around its middle elements rather than
+    sorted, which only takes a selection pass. On multiple processors, a
+    flattened array goes through a distributed radix selection of the
+    middle elements, after which every element is written once into the
+    range of ranks it falls in.
+
+    """
+    original_shape = a.shape
+    if axis is None:
+        axes = tuple(range(a.ndim))
+        (real_axis, arr) = (0, a.ravel())
+        overwrite_input = False
+    elif isinstance(axis, Iterable):
+        axes = tuple(normalize_axis_index(ax, a.ndim) for ax in axis)
+        if len(axes) == 1:
+            (real_axis, arr) = (axes[0], a)
+        else:
+            (real_axis, arr) = reshuffle_reshape(a, axes)
+            overwrite_input = False
+    else:
+        axes = (normalize_axis_index(axis, a.ndim),)
+        (real_axis, arr) = (axes[0], a)
+
+    # the middle element, or the two middle elements for an even count
+    n = arr.shape[real_axis]
+    middle = [n // 2 - 1, n // 2] if n % 2 == 0 else [n // 2]
+    middle = [k for k in middle if k >= 0]
+
+    # the median of a slice holding a NaN is NaN, which is checked up front
+    # as the input may be partitioned in place
+    check_nan = n > 0 and arr.dtype.kind in "fc"
+    if check_nan:
+        has_nan = isnan(arr).any(axis=real_axis, keepdims=True)
+
+    if len(middle) == 0:
+        part = arr
+    elif overwrite_input:
+        arr.partition(middle, axis=real_axis)
+        part = arr
+    else:
+        part = partition(arr, middle, axis=real_axis)
+
+    result = mean(part.take(middle, axis=real_axis), real_axis, keepdims=True)
+    if check_nan:
+        result = where(has_nan, result.dtype.type(np.nan), result)
+
+    if keepdims:
+        shape = tuple(
+            1 if k in axes else original_shape[k]
+            for k in range(len(original_shape))
+        )
+    else:
+        shape = tuple(
+            original_shape[k]
+            for k in range(len(original_shape))
+            if k not in axes
+        )
+    result = result.reshape(shape)
+
+    if out is not None:
+        out[...] = result
+        return out
+    return result
+
+
+@add_boilerplate("a")
+def approx_quantile(
+    a: ndarray,
+    q: Union[float, Iterable[float], ndarray],
+    accuracy: float = 0.01,
+) -> ndarray:
+    """
+    Estimate the q-th quantiles of the flattened data.
+
+    The estimates are read off a mergeable sketch of the data (a t-digest)
+    that is built in a single pass and that holds ``O(1 / accuracy)``
+    values.
+
+    Parameters
+    ----------
+    a : array_like
+        Input array or object that can be converted to an array. It must
+        not be complex.
+    q : array_like of float
+        Quantile or sequence of quantiles to compute, which must be between
+        0 and 1 inclusive.
+    accuracy : float, optional
+        Target bound on the error of the estimates in rank, as a fraction of
+        the number of elements. The error is largest around the median and
+        shrinks towards both ends of the distribution; the minimum and the
+        maximum are exact.
+
+    Returns
+    -------
+    quantile : ndarray
+        The estimated quantiles, as ``float64`` values of the same shape
+        as `q`. NaNs in the input are ignored, and the estimates are NaN if
+        there is no other value.
+
+    See Also
+    --------
+    quantile
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+
+    Notes
+    --------
+    CPUs stream the array into the sketch without copying it. GPUs instead
+    copy and sort it in chunks of a fixed size, each of which is cut into
+    clusters that are merged into the sketch, so the temporary memory used
+    does not grow with the array.
+
+    """
+    if a.dtype.kind == "c":
+        raise TypeError("input array cannot be of complex type")
+    if not 0.0 < accuracy < 1.0:
+        raise ValueError("accuracy must be in the range (0, 1)")
+    q_arr = np.asarray(q, dtype=np.float64)
+    # written so that NaNs fail the check too
+    if not np.all((q_arr >= 0.0) & (q_arr <= 1.0)):
+        raise ValueError("Quantiles must be in the range [0, 1]")
+
+    # a t-digest with this compression bounds the rank error of the
+    # interpolated estimates by about half of the accuracy
+    compression = int(math.ceil(math.pi / accuracy))
+    thunk = a._thunk.quantile_sketch(compression)
+    sketch = np.asarray(ndarray(shape=thunk.shape, thunk=thunk))
+
+    # skip the header; every cluster is centered at the average position of
+    # its values in the sorted order, and positions in between are linearly
+    # interpolated as by the 'linear' method of `quantile`
+    clusters = sketch.reshape(-1, 2)[1:]
+    means, weights = clusters[:, 0], clusters[:, 1]
+    total = weights.sum()
+    if total == 0:
+        return full(q_arr.shape, np.nan, dtype=np.float64)
+    centers = np.cumsum(weights) - (weights + 1.0) / 2.0
+    result = np.interp(q_arr * (total - 1.0), centers, means)
+    return array(result, dtype=np.float64)
+
+
 @add_boilerplate("x", "weights")
 def histogram(
     x: ndarray,
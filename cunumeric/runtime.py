@@ -84,6 +84,8 @@ class Runtime(object):
         self._cached_point_types: dict[DIMENSION, ty.Dtype] = dict()
         # Maps value types to struct types used in argmin/argmax
         self._cached_argred_types: dict[ty.Dtype, ty.Dtype] = dict()
+        # Maps value types to struct types used in single-pass variance
+        self._cached_welford_types: dict[ty.Dtype, ty.Dtype] = dict()
 
     @property
     def num_procs(self) -> int:
@@ -133,6 +135,25 @@ class Runtime(object):
         )
         return argred_dtype
 
+    def get_welford_type(self, value_dtype: ty.Dtype) -> ty.Dtype:
+        cached = self._cached_welford_types.get(value_dtype)
+        if cached is not None:
+            return cached
+        # (count, mean, M2), matching WelfordState in welford.h
+        welford_dtype = ty.struct_type(
+            [ty.int64, value_dtype, value_dtype], True
+        )
+        self._cached_welford_types[value_dtype] = welford_dtype
+        self.cunumeric_lib.cunumeric_register_welford_op(
+            welford_dtype.uid, value_dtype.code
+        )
+        return welford_dtype
+
+    def is_welford_type(self, dtype: ty.Dtype) -> bool:
+        return any(
+            dtype == cached for cached in self._cached_welford_types.values()
+        )
+
     def _report_coverage(self) -> None:
         total = len(self.api_calls)
         implemented = sum(int(impl) for (_, _, impl) in self.api_calls)
@@ -88,6 +88,52 @@ class CunumericRuntimeSettings(Settings):
         """,
     )
 
+    pairwise_sum: PrioritizedSetting[bool] = PrioritizedSetting(
+        "pairwise_sum",
+        "CUNUMERIC_PAIRWISE_SUM",
+        default=False,
+        convert=convert_bool,
+        help="""
+        Accumulate floating-point sums pairwise on CPUs, which keeps the
+        rounding error of long sums close to that of NumPy without having to
+        upcast the inputs. The elements are summed in blocks with several
+        accumulators, so the cost over a plain sum is small. This is
+        currently used in the following APIs: sum, nansum, mean, as well as
+        the sum method of ndarray. GPU reductions ignore this setting: each
+        GPU thread still accumulates its elements one after another, so the
+        accuracy of sums on GPUs is unchanged.
+        """,
+    )
+
+    sort_oversampling: PrioritizedSetting[int] = PrioritizedSetting(
+        "sort_oversampling",
+        "CUNUMERIC_SORT_OVERSAMPLING",
+        default=1,
+        convert=convert_int,
+        help="""
+        Number of samples that each rank contributes per participant when
+        picking the splitters of a distributed sort. Larger values give more
+        even partitions of skewed or heavily duplicated keys, at the cost of
+        a larger sample exchange.
+        """,
+    )
+
+    searchsorted_merge_min_needles: PrioritizedSetting[
+        int
+    ] = PrioritizedSetting(
+        "searchsorted_merge_min_needles",
+        "CUNUMERIC_SEARCHSORTED_MERGE_MIN_NEEDLES",
+        default=1 << 20,
+        convert=convert_int,
+        help="""
+        Number of values from which searchsorted on multiple processors
+        sorts them and merges them with the matching ranges of the sorted
+        array, instead of sending all of them to every processor. The
+        merge does linear work but sorts and moves the values, which only
+        pays off once there are many of them.
+        """,
+    )
+
     fast_math: EnvOnlySetting[int] = EnvOnlySetting(
         "fast_math",
         "CUNUMERIC_FAST_MATH",
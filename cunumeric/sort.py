@@ -14,18 +14,27 @@
 #
 from __future__ import annotations
 
-from typing import TYPE_CHECKING, Union, cast
+from typing import TYPE_CHECKING, Any, Sequence, Union, cast
 
-from legate.core import types as ty
+import numpy as np
+from legate.core import ReductionOp, types as ty
 from numpy.core.multiarray import (  # type: ignore [attr-defined]
     normalize_axis_index,
 )
 
-from .config import CuNumericOpCode
+from .config import BinaryOpCode, CuNumericOpCode, UnaryOpCode, UnaryRedCode
+from .settings import settings
 
 if TYPE_CHECKING:
+    import numpy.typing as npt
+
     from .deferred import DeferredArray
 
+# Number of bits in a radix digit, which must match RADIX_BITS in
+# src/cunumeric/sort/radix_key.h
+RADIX_BITS = 8
+RADIX_BINS = 1 << RADIX_BITS
+
 
 def sort_flattened(
     output: DeferredArray, input: DeferredArray, argsort: bool, stable: bool
@@ -108,6 +117,7 @@ def sort_task(
     task.add_scalar_arg(argsort, ty.bool_)  # return indices flag
     task.add_scalar_arg(input.base.shape, (ty.int64,))
     task.add_scalar_arg(stable, ty.bool_)
+    task.add_scalar_arg(max(settings.sort_oversampling(), 1), ty.int32)
     task.execute()
 
     if uses_unbound_output:
@@ -134,3 +144,736 @@ def sort(
             sort_task(output, input, argsort, stable)
         else:
             sort_swapped(output, input, argsort, computed_axis, stable)
+
+
+def _radix_counts(
+    input: DeferredArray, prefix: int, shift: int
+) -> DeferredArray:
+    counts = cast(
+        "DeferredArray",
+        input.runtime.create_empty_thunk(
+            (RADIX_BINS,), ty.int64, inputs=(input,)
+        ),
+    )
+    counts.fill(np.array(0, dtype=np.int64))
+
+    task = input.context.create_auto_task(CuNumericOpCode.RADIX_SELECT)
+    task.add_reduction(counts.base, ReductionOp.ADD)
+    task.add_input(input.base)
+    task.add_broadcast(counts.base)
+    task.add_scalar_arg(prefix, ty.uint64)
+    task.add_scalar_arg(shift, ty.int32)
+    task.execute()
+    return counts
+
+
+def _decode_radix_keys(
+    keys: Sequence[int], dtype: np.dtype[Any]
+) -> npt.NDArray[Any]:
+    # Inverse of RadixKey::encode
+    key_type = np.dtype(f"u{dtype.itemsize}")
+    encoded = np.array(keys, dtype=key_type)
+    sign = key_type.type(1 << (8 * dtype.itemsize - 1))
+    if dtype.kind == "i":
+        encoded ^= sign
+    elif dtype.kind == "f":
+        encoded = np.where(encoded & sign, encoded ^ sign, ~encoded)
+    return encoded.view(dtype)
+
+
+def radix_select(
+    input: DeferredArray, ranks: Sequence[int]
+) -> npt.NDArray[Any]:
+    """Returns the elements of the given ranks in the sorted order of an
+    array of booleans, integers or floats. The elements are found one radix
+    digit at a time, from the most significant one: each round counts the
+    elements by their next digit among those sharing the digits found so far,
+    so the array is read once per digit and never moved."""
+    bits = 8 * input.dtype.itemsize
+    prefixes = [0] * len(ranks)
+    remaining = list(ranks)
+    for shift in range(bits - RADIX_BITS, -1, -RADIX_BITS):
+        # Ranks with the same prefix share the counts of the round
+        launched = {
+            prefix: _radix_counts(input, prefix, shift)
+            for prefix in set(prefixes)
+        }
+        counts = {
+            prefix: result.__numpy_array__()
+            for prefix, result in launched.items()
+        }
+        for i, prefix in enumerate(prefixes):
+            bins = counts[prefix]
+            below = np.cumsum(bins) - bins
+            digit = int(np.searchsorted(below, remaining[i], side="right")) - 1
+            remaining[i] -= int(below[digit])
+            prefixes[i] = (prefix << RADIX_BITS) | digit
+    return _decode_radix_keys(prefixes, input.dtype)
+
+
+def _scalar(input: DeferredArray, value: Any) -> Any:
+    array = np.array([value], dtype=input.dtype)
+    return input.runtime.create_wrapped_scalar(
+        array.data, array.dtype, shape=(1,)
+    )
+
+
+def _compare(
+    input: DeferredArray, op_code: BinaryOpCode, value: Any
+) -> DeferredArray:
+    result = cast(
+        "DeferredArray",
+        input.runtime.create_empty_thunk(
+            input.shape, ty.bool_, inputs=(input,)
+        ),
+    )
+    result.binary_op(op_code, input, _scalar(input, value), True, ())
+    return result
+
+
+def _arithmetic(
+    input: DeferredArray, op_code: BinaryOpCode, value: Any
+) -> DeferredArray:
+    result = cast(
+        "DeferredArray",
+        input.runtime.create_empty_thunk(
+            input.shape, input.base.type, inputs=(input,)
+        ),
+    )
+    result.binary_op(op_code, input, _scalar(input, value), True, ())
+    return result
+
+
+def _logical(
+    op_code: Union[UnaryOpCode, BinaryOpCode], *inputs: DeferredArray
+) -> DeferredArray:
+    result = cast(
+        "DeferredArray",
+        inputs[0].runtime.create_empty_thunk(
+            inputs[0].shape, ty.bool_, inputs=inputs
+        ),
+    )
+    if isinstance(op_code, UnaryOpCode):
+        result.unary_op(op_code, inputs[0], True, ())
+    else:
+        result.binary_op(op_code, inputs[0], inputs[1], True, ())
+    return result
+
+
+def _bucket_masks(
+    input: DeferredArray, pivots: npt.NDArray[Any]
+) -> list[DeferredArray]:
+    # Masks of the elements before each of the sorted pivots, equal to it and
+    # after the last one, in this order. NaNs go after all other values.
+    masks = []
+    above = None
+    for pivot in pivots:
+        if np.isnan(pivot):
+            equal = _logical(UnaryOpCode.ISNAN, input)
+            below = _logical(UnaryOpCode.LOGICAL_NOT, equal)
+        else:
+            equal = _compare(input, BinaryOpCode.EQUAL, pivot)
+            below = _compare(input, BinaryOpCode.LESS, pivot)
+        if above is not None:
+            below = _logical(BinaryOpCode.LOGICAL_AND, above, below)
+        masks.extend((below, equal))
+        if np.isnan(pivot):
+            return masks
+        # Negated so that NaNs are above every pivot that is not a NaN
+        above = _logical(
+            UnaryOpCode.LOGICAL_NOT,
+            _compare(input, BinaryOpCode.LESS_EQUAL, pivot),
+        )
+    assert above is not None
+    masks.append(above)
+    return masks
+
+
+def partition_distributed(
+    output: DeferredArray,
+    input: DeferredArray,
+    kth: Sequence[int],
+    argpartition: bool,
+) -> None:
+    # The kth elements are found by a radix select, and the elements are then
+    # laid out by how they compare with them: before the first one, equal to
+    # it, between it and the next one, and so on. Every kth element lands in
+    # the run of elements equal to it, and the only data exchange is that of
+    # writing each run to its place in the output.
+    pivots = np.unique(radix_select(input, kth))
+    pieces = [
+        mask.nonzero()[0] if argpartition else input.get_item(mask)
+        for mask in _bucket_masks(input, pivots)
+    ]
+    offset = 0
+    for piece in pieces:
+        size = piece.shape[0]
+        if size > 0:
+            output.set_item((slice(offset, offset + size),), piece)
+        offset += size
+
+
+def partition_flattened(
+    output: DeferredArray,
+    input: DeferredArray,
+    kth: Sequence[int],
+    argpartition: bool,
+) -> None:
+    flattened = cast("DeferredArray", input.reshape((input.size,), order="C"))
+
+    partition_result = cast(
+        "DeferredArray",
+        output.runtime.create_empty_thunk(
+            flattened.shape, dtype=output.base.type, inputs=(flattened,)
+        ),
+    )
+    partition(partition_result, flattened, kth, argpartition, 0)
+    output.base = partition_result.base
+    output.numpy_array = None
+
+
+def partition_swapped(
+    output: DeferredArray,
+    input: DeferredArray,
+    kth: Sequence[int],
+    argpartition: bool,
+    partition_axis: int,
+) -> None:
+    swapped = input.swapaxes(partition_axis, input.ndim - 1)
+
+    swapped_copy = cast(
+        "DeferredArray",
+        output.runtime.create_empty_thunk(
+            swapped.shape, dtype=input.base.type, inputs=(input, swapped)
+        ),
+    )
+    swapped_copy.copy(swapped, deep=True)
+
+    if argpartition:
+        partition_result = cast(
+            "DeferredArray",
+            output.runtime.create_empty_thunk(
+                swapped_copy.shape,
+                dtype=output.base.type,
+                inputs=(swapped_copy,),
+            ),
+        )
+    else:
+        partition_result = swapped_copy
+    partition_task(partition_result, swapped_copy, kth, argpartition)
+    output.base = partition_result.swapaxes(
+        input.ndim - 1, partition_axis
+    ).base
+    output.numpy_array = None
+
+
+def partition_task(
+    output: DeferredArray,
+    input: DeferredArray,
+    kth: Sequence[int],
+    argpartition: bool,
+) -> None:
+    task = output.context.create_auto_task(CuNumericOpCode.PARTITION)
+
+    task.add_input(input.base)
+    task.add_output(output.base)
+    task.add_alignment(output.base, input.base)
+    # Each segment is partitioned by a single task
+    task.add_broadcast(input.base, axes=(input.ndim - 1,))
+
+    task.add_scalar_arg(argpartition, ty.bool_)
+    task.add_scalar_arg(tuple(kth), (ty.int64,))
+    task.execute()
+
+
+def partition(
+    output: DeferredArray,
+    input: DeferredArray,
+    kth: Sequence[int],
+    argpartition: bool,
+    axis: Union[int, None] = -1,
+) -> None:
+    """Partitions the array along an axis so that the elements at the sorted
+    positions in kth are those of a sorted array, with no larger elements
+    before them and no smaller ones after them."""
+    if axis is None and input.ndim > 1:
+        partition_flattened(output, input, kth, argpartition)
+        return
+
+    if axis is None:
+        computed_axis = 0
+    else:
+        computed_axis = normalize_axis_index(axis, input.ndim)
+    runtime = output.runtime
+    distributed = input.ndim == 1 and runtime.num_procs > 1
+
+    if distributed and input.dtype.kind in "biuf":
+        partition_distributed(output, input, kth, argpartition)
+    elif distributed or runtime.num_gpus > 0:
+        # Segmented sorts are already the fastest way to partition on GPUs,
+        # and complex values have no radix keys
+        sort(output, input, argpartition, computed_axis)
+    elif computed_axis == input.ndim - 1:
+        partition_task(output, input, kth, argpartition)
+    else:
+        partition_swapped(output, input, kth, argpartition, computed_axis)
+
+
+def _key_bounds(keys: Sequence[DeferredArray]) -> list[tuple[int, int]]:
+    # The reductions of all keys are launched before any of them is waited on
+    launched = []
+    for key in keys:
+        if key.dtype.kind == "b":
+            continue
+        for op in (UnaryRedCode.MIN, UnaryRedCode.MAX):
+            result = cast(
+                "DeferredArray",
+                key.runtime.create_empty_thunk(
+                    (), key.base.type, inputs=(key,)
+                ),
+            )
+            result.unary_reduction(
+                op, key, None, None, (0,), False, None, None
+            )
+            launched.append(result)
+    values = iter(int(result.__numpy_array__()) for result in launched)
+    return [
+        (0, 1) if key.dtype.kind == "b" else (next(values), next(values))
+        for key in keys
+    ]
+
+
+def _packed_lexsort_key(
+    keys: Sequence[DeferredArray],
+) -> Union[DeferredArray, None]:
+    # Integer keys whose ranges multiply to fewer than 2**63 values are
+    # packed into a single int64 key, with the last key in the most
+    # significant position: sum((key - min(key)) * stride), where each stride
+    # is the product of the ranges of the keys before it. Returns None if the
+    # keys cannot be packed.
+    if any(key.dtype.kind not in "biu" for key in keys):
+        return None
+    if keys[0].size == 0:
+        return None
+    bounds = _key_bounds(keys)
+    strides = []
+    stride = 1
+    for lo, hi in bounds:
+        if hi >= 1 << 63:
+            return None
+        strides.append(stride)
+        stride *= hi - lo + 1
+    if stride > 1 << 63:
+        return None
+
+    runtime = keys[0].runtime
+    packed: Union[DeferredArray, None] = None
+    for key, (lo, _), stride in zip(keys, bounds, strides):
+        if key.dtype != np.int64:
+            converted = cast(
+                "DeferredArray",
+                runtime.create_empty_thunk(
+                    key.shape, ty.int64, inputs=(key,)
+                ),
+            )
+            converted.convert(key, warn=False)
+            key = converted
+        term = _arithmetic(key, BinaryOpCode.SUBTRACT, lo)
+        if stride > 1:
+            term.binary_op(
+                BinaryOpCode.MULTIPLY, term, _scalar(term, stride), True, ()
+            )
+        if packed is None:
+            packed = term
+        else:
+            packed.binary_op(BinaryOpCode.ADD, packed, term, True, ())
+    return packed
+
+
+def lexsort_distributed(
+    output: DeferredArray, keys: Sequence[DeferredArray]
+) -> None:
+    # 1-D keys are spread over all processors. Integer keys that fit are
+    # packed into one composite key, which goes through the distributed
+    # sample sort of SortTask once, carrying the indices along.
+    packed = _packed_lexsort_key(keys)
+    if packed is not None:
+        sort(output, packed, True, stable=True)
+        return
+
+    # Otherwise, e.g. for floating point keys, which have no packed form
+    # without reinterpreting their bits, each key goes through the sample
+    # sort in turn, after being gathered into the order established by the
+    # keys before it. As the sort is stable, ties in a key keep that order.
+    # Carrying all keys through a single sample sort would need exchange
+    # buffers and splitters generic over a tuple of key types, for every
+    # combination of key dtypes.
+    perm: Union[DeferredArray, None] = None
+    for key in keys:
+        if perm is not None:
+            key = cast("DeferredArray", key.get_item(perm))
+        order = cast(
+            "DeferredArray",
+            output.runtime.create_empty_thunk(
+                key.shape, dtype=output.base.type, inputs=(key,)
+            ),
+        )
+        sort(order, key, True, stable=True)
+        if perm is not None:
+            order = cast("DeferredArray", perm.get_item(order))
+        perm = order
+    assert perm is not None
+    output.base = perm.base
+    output.numpy_array = None
+
+
+def lexsort_swapped(
+    output: DeferredArray, keys: Sequence[DeferredArray], sort_axis: int
+) -> None:
+    last = output.ndim - 1
+    swapped_keys = []
+    for key in keys:
+        swapped = key.swapaxes(sort_axis, last)
+        swapped_copy = cast(
+            "DeferredArray",
+            output.runtime.create_empty_thunk(
+                swapped.shape, dtype=key.base.type, inputs=(key, swapped)
+            ),
+        )
+        swapped_copy.copy(swapped, deep=True)
+        swapped_keys.append(swapped_copy)
+
+    sort_result = cast(
+        "DeferredArray",
+        output.runtime.create_empty_thunk(
+            swapped_keys[0].shape,
+            dtype=output.base.type,
+            inputs=tuple(swapped_keys),
+        ),
+    )
+    lexsort_task(sort_result, swapped_keys)
+    output.base = sort_result.swapaxes(last, sort_axis).base
+    output.numpy_array = None
+
+
+def lexsort_task(
+    output: DeferredArray, keys: Sequence[DeferredArray]
+) -> None:
+    task = output.context.create_auto_task(CuNumericOpCode.LEXSORT)
+
+    task.add_output(output.base)
+    for key in keys:
+        task.add_input(key.base)
+        task.add_alignment(output.base, key.base)
+    # Each segment is sorted by a single task
+    task.add_broadcast(output.base, axes=(output.ndim - 1,))
+    task.execute()
+
+
+def lexsort(
+    output: DeferredArray, keys: Sequence[DeferredArray], axis: int = -1
+) -> None:
+    """Computes the indices that sort the keys along an axis, with the last
+    key as the primary one and ties broken by the keys before it. Within a
+    task, no key combining all of them is ever materialized: the permutation
+    is sorted stably by one key after another, from the first to the
+    last."""
+    computed_axis = normalize_axis_index(axis, output.ndim)
+
+    if output.ndim == 1 and output.runtime.num_procs > 1:
+        lexsort_distributed(output, keys)
+    elif computed_axis == output.ndim - 1:
+        lexsort_task(output, keys)
+    else:
+        lexsort_swapped(output, keys, computed_axis)
+
+
+def _topk_candidates(
+    input: DeferredArray,
+    positions: Union[DeferredArray, None],
+    k: int,
+    largest: bool,
+) -> tuple[DeferredArray, DeferredArray]:
+    runtime = input.runtime
+    values = runtime.create_unbound_thunk(input.base.type)
+    indices = runtime.create_unbound_thunk(ty.int64)
+
+    task = input.context.create_auto_task(CuNumericOpCode.TOPK)
+    task.add_input(input.base)
+    if positions is not None:
+        # Candidates are merged by a single task
+        task.add_input(positions.base)
+        task.add_broadcast(input.base)
+        task.add_broadcast(positions.base)
+    task.add_output(values.base)
+    task.add_output(indices.base)
+    task.add_scalar_arg(k, ty.int64)
+    task.add_scalar_arg(largest, ty.bool_)
+    task.execute()
+    return values, indices
+
+
+def topk(
+    values: DeferredArray,
+    indices: DeferredArray,
+    input: DeferredArray,
+    k: int,
+    largest: bool,
+) -> None:
+    """Finds the k largest or smallest elements of a 1-D array, from the best
+    one down. Each processor first picks the best k of its own elements,
+    and the at most k candidates from each processor are then merged by a
+    single task, so only the candidates ever move."""
+    cand_values, cand_indices = _topk_candidates(input, None, k, largest)
+    if input.runtime.num_procs > 1:
+        cand_values, cand_indices = _topk_candidates(
+            cand_values, cand_indices, k, largest
+        )
+    values.base = cand_values.base
+    values.numpy_array = None
+    indices.base = cand_indices.base
+    indices.numpy_array = None
+
+
+def searchsorted_task(
+    output: DeferredArray, rhs: DeferredArray, v: DeferredArray, left: bool
+) -> None:
+    task = output.context.create_auto_task(CuNumericOpCode.SEARCHSORTED)
+
+    if left:
+        output.fill(np.array(rhs.size, output.dtype))
+        task.add_reduction(output.base, ReductionOp.MIN)
+    else:
+        output.fill(np.array(0, output.dtype))
+        task.add_reduction(output.base, ReductionOp.MAX)
+
+    task.add_input(rhs.base)
+    task.add_input(v.base)
+
+    # every partition needs the value information
+    task.add_broadcast(v.base)
+    task.add_broadcast(output.base)
+    task.add_alignment(output.base, v.base)
+
+    task.add_scalar_arg(left, ty.bool_)
+    task.add_scalar_arg(rhs.size, ty.int64)
+    task.execute()
+
+
+def _host_array(
+    like: DeferredArray, array: npt.NDArray[Any]
+) -> DeferredArray:
+    return like.runtime.to_deferred_array(
+        like.runtime.find_or_create_array_thunk(array, defer=True)
+    )
+
+
+def _column(
+    like: DeferredArray, values: npt.NDArray[np.int64]
+) -> DeferredArray:
+    return _host_array(like, values.reshape(-1, 1).copy())
+
+
+def _samples(input: DeferredArray, step: int) -> npt.NDArray[Any]:
+    # Every step-th element of a sorted array, except the first one. The
+    # strided view is copied so that only the samples are mapped on the host.
+    if input.size <= step:
+        return np.empty(0, dtype=input.dtype)
+    view = input.get_item((slice(step, input.size, step),))
+    samples = cast(
+        "DeferredArray",
+        input.runtime.create_empty_thunk(
+            view.shape, input.base.type, inputs=(input,)
+        ),
+    )
+    samples.copy(view, deep=True)
+    return samples.__numpy_array__().copy()
+
+
+def _search_launch(
+    rhs: DeferredArray, values: npt.NDArray[Any], left: bool
+) -> Union[DeferredArray, None]:
+    if values.size == 0:
+        return None
+    needles = _host_array(rhs, values)
+    points = cast(
+        "DeferredArray",
+        rhs.runtime.create_empty_thunk(
+            needles.shape, ty.int64, inputs=(rhs, needles)
+        ),
+    )
+    searchsorted_task(points, rhs, needles, left)
+    return points
+
+
+def _merge_splits(
+    rhs: DeferredArray, needles: DeferredArray, left: bool
+) -> tuple[npt.NDArray[np.int64], npt.NDArray[np.int64]]:
+    # Cuts the merged order of the sorted array and the sorted needles into
+    # about as many runs as there are processors, by sampling both evenly.
+    # Every other sample in the merged order is a cut, so a run spans at
+    # most two gaps between consecutive samples of each array. The merged
+    # order breaks ties the way the search does, with needles before equal
+    # elements for side="left" and after them for side="right", so a cut is
+    # an exact position in it even among duplicates. Returns how many
+    # elements of each array come before every cut, from 0 to their sizes.
+    num_procs = rhs.runtime.num_procs
+    hay_step = -(-rhs.size // num_procs)
+    needle_step = -(-needles.size // num_procs)
+    hay_values = _samples(rhs, hay_step)
+    needle_values = _samples(needles, needle_step)
+    hay_pos = np.arange(1, hay_values.size + 1) * hay_step
+    needle_pos = np.arange(1, needle_values.size + 1) * needle_step
+
+    values = np.concatenate((needle_values, hay_values))
+    positions = np.concatenate((needle_pos, hay_pos))
+    is_hay = np.concatenate(
+        (np.zeros(needle_values.size, bool), np.ones(hay_values.size, bool))
+    )
+    # Ties are broken by which array goes first and then by position
+    order = np.lexsort((positions, is_hay if left else ~is_hay, values))
+    cuts = order[1::2]
+    cut_is_hay = is_hay[cuts]
+
+    # A cut at a sample of one array has its position in that array, and
+    # the number of elements of the other array before it is searched for
+    hay_cuts = cuts[cut_is_hay]
+    needle_cuts = cuts[~cut_is_hay]
+    needles_before = _search_launch(needles, values[hay_cuts], not left)
+    hay_before = _search_launch(rhs, values[needle_cuts], left)
+
+    hay_splits = np.empty(cuts.size, np.int64)
+    needle_splits = np.empty(cuts.size, np.int64)
+    hay_splits[cut_is_hay] = positions[hay_cuts]
+    needle_splits[~cut_is_hay] = positions[needle_cuts]
+    if needles_before is not None:
+        needle_splits[cut_is_hay] = needles_before.__numpy_array__()
+    if hay_before is not None:
+        hay_splits[~cut_is_hay] = hay_before.__numpy_array__()
+
+    hay_splits = np.concatenate(([0], hay_splits, [rhs.size]))
+    needle_splits = np.concatenate(([0], needle_splits, [needles.size]))
+    return hay_splits, needle_splits
+
+
+def _window_indices(
+    like: DeferredArray,
+    starts: npt.NDArray[np.int64],
+    lasts: npt.NDArray[np.int64],
+    width: int,
+) -> DeferredArray:
+    # Rows of indices starts[j], starts[j] + 1, ..., clamped to lasts[j]
+    runtime = like.runtime
+    shape = (starts.size, width)
+    columns = cast(
+        "DeferredArray",
+        runtime.create_empty_thunk((width,), ty.int64, inputs=(like,)),
+    )
+    columns.arange(0, width, 1)
+    indices = cast(
+        "DeferredArray",
+        runtime.create_empty_thunk(shape, ty.int64, inputs=(like,)),
+    )
+    indices.binary_op(
+        BinaryOpCode.ADD, _column(like, starts), columns, True, ()
+    )
+    indices.binary_op(
+        BinaryOpCode.MINIMUM, indices, _column(like, lasts), True, ()
+    )
+    return indices
+
+
+def searchsorted_merged(
+    output: DeferredArray, rhs: DeferredArray, v: DeferredArray, left: bool
+) -> None:
+    """Finds the insertion points of the needles in v by merging them with
+    the sorted array rhs. The needles are sorted, and the merged order of
+    both arrays is cut into runs of similar sizes at positions found from
+    evenly spaced samples of each. Every run, i.e. a window of rhs and the
+    needles that fall in it, is gathered into a row, and the rows are merged
+    independently along their merge paths by the SEARCHSORTED_MERGE task.
+    Apart from sorting the needles, this takes linear work and moves every
+    element once, whereas the SEARCHSORTED task needs all needles on every
+    processor."""
+    runtime = output.runtime
+    needles = cast("DeferredArray", v.reshape((v.size,), order="C"))
+
+    order = cast(
+        "DeferredArray",
+        runtime.create_empty_thunk((v.size,), ty.int64, inputs=(needles,)),
+    )
+    sort(order, needles, True, stable=True)
+    needles = cast("DeferredArray", needles.get_item(order))
+
+    hay_splits, needle_splits = _merge_splits(rhs, needles, left)
+    # Runs without needles have nothing to merge
+    rows = np.flatnonzero(needle_splits[1:] > needle_splits[:-1])
+    hay_starts = hay_splits[rows]
+    hay_sizes = hay_splits[rows + 1] - hay_starts
+    needle_starts = needle_splits[rows]
+    needle_ends = needle_splits[rows + 1]
+    width = int(max(hay_sizes.max(), (needle_ends - needle_starts).max()))
+
+    # Rows are padded to the same width. Windows of rhs are padded with any
+    # valid element, as only their first hay_sizes elements are merged, and
+    # runs of needles with copies of their last needle, which keep them
+    # sorted and get the same insertion point.
+    hay_indices = _window_indices(
+        rhs, hay_starts, np.full(rows.size, rhs.size - 1), width
+    )
+    needle_indices = _window_indices(
+        needles, needle_starts, needle_ends - 1, width
+    )
+    haystack = cast("DeferredArray", rhs.get_item(hay_indices))
+    row_needles = cast("DeferredArray", needles.get_item(needle_indices))
+    targets = cast("DeferredArray", order.get_item(needle_indices))
+
+    shape = (rows.size, width)
+    offsets = _column(rhs, hay_starts)
+    lengths = _column(rhs, hay_sizes)
+    points = cast(
+        "DeferredArray",
+        runtime.create_empty_thunk(shape, ty.int64, inputs=(row_needles,)),
+    )
+
+    inputs = (
+        haystack.base,
+        row_needles.base,
+        offsets._broadcast(shape),
+        lengths._broadcast(shape),
+    )
+    task = output.context.create_auto_task(CuNumericOpCode.SEARCHSORTED_MERGE)
+    task.add_output(points.base)
+    for store in inputs:
+        task.add_input(store)
+        task.add_alignment(points.base, store)
+    # Each row is merged by a single task
+    task.add_broadcast(points.base, axes=(1,))
+    task.add_scalar_arg(left, ty.bool_)
+    task.execute()
+
+    # Padded needles write the same insertion point as the needle they copy
+    if output.ndim == 1:
+        output.set_item(targets, points)
+    else:
+        result = runtime.create_empty_thunk(
+            (v.size,), ty.int64, inputs=(points,)
+        )
+        result.set_item(targets, points)
+        output.copy(result.reshape(output.shape, order="C"), deep=True)
+
+
+def searchsorted(
+    output: DeferredArray, rhs: DeferredArray, v: DeferredArray, left: bool
+) -> None:
+    # Many needles on multiple processors are merged with rhs rather than
+    # broadcast to every processor
+    if (
+        output.runtime.num_procs > 1
+        and rhs.size > 0
+        and v.size > 0
+        and v.size >= settings.searchsorted_merge_min_needles()
+    ):
+        searchsorted_merged(output, rhs, v, left)
+    else:
+        searchsorted_task(output, rhs, v, left)
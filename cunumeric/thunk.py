@@ -102,6 +102,21 @@ class NumPyThunk(ABC):
     def convolve(self, v: Any, out: Any, mode: ConvolveMode) -> None:
         ...
 
+    @abstractmethod
+    def diff(self, rhs: Any, n: int, axis: int) -> None:
+        ...
+
+    @abstractmethod
+    def gradient(
+        self,
+        rhs: Any,
+        axis: int,
+        edge_order: int,
+        spacing: float,
+        coords: Optional[Any],
+    ) -> None:
+        ...
+
     @abstractmethod
     def fft(
         self,
@@ -595,6 +610,10 @@ class NumPyThunk(ABC):
     def random_uniform(self) -> None:
         ...
 
+    @abstractmethod
+    def lexsort(self, keys: Sequence[Any], axis: int = -1) -> None:
+        ...
+
     @abstractmethod
     def partition(
         self,
@@ -634,6 +653,10 @@ class NumPyThunk(ABC):
     ) -> None:
         ...
 
+    @abstractmethod
+    def topk(self, values: Any, indices: Any, k: int, largest: bool) -> None:
+        ...
+
     @abstractmethod
     def unary_op(
         self,
@@ -659,6 +682,21 @@ class NumPyThunk(ABC):
     ) -> None:
         ...
 
+    @abstractmethod
+    def segmented_reduction(
+        self,
+        op: UnaryRedCode,
+        rhs: Any,
+        offsets: Any,
+        axis: int,
+        monotonic: bool,
+    ) -> None:
+        ...
+
+    @abstractmethod
+    def scalar_stats(self, outputs: Sequence[Any]) -> None:
+        ...
+
     @abstractmethod
     def isclose(
         self, rhs1: Any, rhs2: Any, rtol: float, atol: float, equal_nan: bool
@@ -671,6 +709,15 @@ class NumPyThunk(ABC):
     ) -> None:
         ...
 
+    @abstractmethod
+    def fused_op(
+        self,
+        instrs: Sequence[tuple[int, int, int, int]],
+        constants: Sequence[float],
+        srcs: Sequence[Any],
+    ) -> None:
+        ...
+
     @abstractmethod
     def binary_reduction(
         self,
@@ -717,6 +764,24 @@ class NumPyThunk(ABC):
     def unique(self) -> NumPyThunk:
         ...
 
+    @abstractmethod
+    def unique_inverse(
+        self,
+        unique: Any,
+        inverse: Optional[Any],
+        counts: Optional[Any],
+        index: Optional[Any],
+    ) -> None:
+        ...
+
+    @abstractmethod
+    def isin(self, test: Any, mask: Any, invert: bool) -> None:
+        ...
+
+    @abstractmethod
+    def quantile_sketch(self, compression: int) -> NumPyThunk:
+        ...
+
     @abstractmethod
     def create_window(self, op_code: WindowOpCode, M: Any, *args: Any) -> None:
         ...
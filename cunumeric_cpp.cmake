@@ -127,9 +127,12 @@ list(APPEND cunumeric_SOURCES
   src/cunumeric/binary/binary_red.cc
   src/cunumeric/bits/packbits.cc
   src/cunumeric/bits/unpackbits.cc
+  src/cunumeric/unary/scalar_stats.cc
   src/cunumeric/unary/scalar_unary_red.cc
   src/cunumeric/unary/unary_op.cc
   src/cunumeric/unary/unary_red.cc
+  src/cunumeric/unary/segmented_red.cc
+  src/cunumeric/unary/segmented_red_global.cc
   src/cunumeric/unary/convert.cc
   src/cunumeric/nullary/arange.cc
   src/cunumeric/nullary/eye.cc
@@ -161,11 +164,18 @@ list(APPEND cunumeric_SOURCES
   src/cunumeric/random/rand.cc
   src/cunumeric/search/argwhere.cc
   src/cunumeric/search/nonzero.cc
+  src/cunumeric/set/isin.cc
   src/cunumeric/set/unique.cc
+  src/cunumeric/set/unique_inverse.cc
   src/cunumeric/set/unique_reduce.cc
   src/cunumeric/stat/bincount.cc
+  src/cunumeric/stat/quantile_sketch.cc
+  src/cunumeric/stat/quantile_sketch_reduce.cc
   src/cunumeric/convolution/convolve.cc
+  src/cunumeric/stencil/diff.cc
+  src/cunumeric/stencil/gradient.cc
   src/cunumeric/transform/flip.cc
+  src/cunumeric/fused/fused_op.cc
   src/cunumeric/arg_redop_register.cc
   src/cunumeric/mapper.cc
   src/cunumeric/cephes/chbevl.cc
@@ -183,8 +193,11 @@ if(Legion_USE_OpenMP)
     src/cunumeric/bits/packbits_omp.cc
     src/cunumeric/bits/unpackbits_omp.cc
     src/cunumeric/unary/unary_op_omp.cc
+    src/cunumeric/unary/scalar_stats_omp.cc
     src/cunumeric/unary/scalar_unary_red_omp.cc
     src/cunumeric/unary/unary_red_omp.cc
+    src/cunumeric/unary/segmented_red_omp.cc
+    src/cunumeric/unary/segmented_red_global_omp.cc
     src/cunumeric/unary/convert_omp.cc
     src/cunumeric/nullary/arange_omp.cc
     src/cunumeric/nullary/eye_omp.cc
@@ -213,11 +226,18 @@ if(Legion_USE_OpenMP)
     src/cunumeric/random/rand_omp.cc
     src/cunumeric/search/argwhere_omp.cc
     src/cunumeric/search/nonzero_omp.cc
+    src/cunumeric/set/isin_omp.cc
     src/cunumeric/set/unique_omp.cc
+    src/cunumeric/set/unique_inverse_omp.cc
     src/cunumeric/set/unique_reduce_omp.cc
     src/cunumeric/stat/bincount_omp.cc
+    src/cunumeric/stat/quantile_sketch_omp.cc
+    src/cunumeric/stat/quantile_sketch_reduce_omp.cc
     src/cunumeric/convolution/convolve_omp.cc
+    src/cunumeric/stencil/diff_omp.cc
+    src/cunumeric/stencil/gradient_omp.cc
     src/cunumeric/transform/flip_omp.cc
+    src/cunumeric/fused/fused_op_omp.cc
     src/cunumeric/stat/histogram_omp.cc
   )
 endif()
@@ -231,8 +251,11 @@ if(Legion_USE_CUDA)
     src/cunumeric/binary/binary_red.cu
     src/cunumeric/bits/packbits.cu
     src/cunumeric/bits/unpackbits.cu
+    src/cunumeric/unary/scalar_stats.cu
     src/cunumeric/unary/scalar_unary_red.cu
     src/cunumeric/unary/unary_red.cu
+    src/cunumeric/unary/segmented_red.cu
+    src/cunumeric/unary/segmented_red_global.cu
     src/cunumeric/unary/unary_op.cu
     src/cunumeric/unary/convert.cu
     src/cunumeric/nullary/arange.cu
@@ -264,11 +287,17 @@ if(Legion_USE_CUDA)
     src/cunumeric/random/rand.cu
     src/cunumeric/search/argwhere.cu
     src/cunumeric/search/nonzero.cu
+    src/cunumeric/set/isin.cu
     src/cunumeric/set/unique.cu
+    src/cunumeric/set/unique_inverse.cu
     src/cunumeric/stat/bincount.cu
+    src/cunumeric/stat/quantile_sketch.cu
     src/cunumeric/convolution/convolve.cu
+    src/cunumeric/stencil/diff.cu
+    src/cunumeric/stencil/gradient.cu
     src/cunumeric/fft/fft.cu
     src/cunumeric/transform/flip.cu
+    src/cunumeric/fused/fused_op.cu
     src/cunumeric/arg_redop_register.cu
     src/cunumeric/cudalibs.cu
     src/cunumeric/stat/histogram.cu
@@ -279,12 +308,22 @@ endif()
 list(APPEND cunumeric_SOURCES
   src/cunumeric/sort/sort.cc
   src/cunumeric/sort/searchsorted.cc
+  src/cunumeric/sort/searchsorted_merge.cc
+  src/cunumeric/sort/partition.cc
+  src/cunumeric/sort/radix_select.cc
+  src/cunumeric/sort/lexsort.cc
+  src/cunumeric/sort/topk.cc
 )
 
 if(Legion_USE_OpenMP)
   list(APPEND cunumeric_SOURCES
     src/cunumeric/sort/sort_omp.cc
     src/cunumeric/sort/searchsorted_omp.cc
+    src/cunumeric/sort/searchsorted_merge_omp.cc
+    src/cunumeric/sort/partition_omp.cc
+    src/cunumeric/sort/radix_select_omp.cc
+    src/cunumeric/sort/lexsort_omp.cc
+    src/cunumeric/sort/topk_omp.cc
   )
 endif()
 
@@ -292,6 +331,10 @@ if(Legion_USE_CUDA)
   list(APPEND cunumeric_SOURCES
     src/cunumeric/sort/sort.cu
     src/cunumeric/sort/searchsorted.cu
+    src/cunumeric/sort/searchsorted_merge.cu
+    src/cunumeric/sort/radix_select.cu
+    src/cunumeric/sort/lexsort.cu
+    src/cunumeric/sort/topk.cu
     src/cunumeric/sort/cub_sort_bool.cu
     src/cunumeric/sort/cub_sort_int8.cu
     src/cunumeric/sort/cub_sort_int16.cu
@@ -19,6 +19,7 @@
 #include "legate.h"
 #include "cunumeric/cunumeric_c.h"
 #include "cunumeric/arg.h"
+#include "cunumeric/welford.h"
 
 namespace cunumeric {
 
@@ -53,4 +54,30 @@ struct register_reduction_op_fn {
   static int32_t next_reduction_operator_id();
 };
 
+struct register_welford_op_fn {
+  template <legate::Type::Code CODE,
+            std::enable_if_t<CODE == legate::Type::Code::FLOAT32 ||
+                             CODE == legate::Type::Code::FLOAT64>* = nullptr>
+  void operator()(int32_t type_uid)
+  {
+    using VAL = legate::legate_type_of<CODE>;
+
+    auto runtime = legate::Runtime::get_runtime();
+    auto context = runtime->find_library("cunumeric");
+
+    auto redop_id = context->register_reduction_operator<WelfordReduction<VAL>>(
+      register_reduction_op_fn::next_reduction_operator_id());
+    auto op_kind = static_cast<int32_t>(legate::ReductionOpKind::ADD);
+    runtime->record_reduction_operator(type_uid, op_kind, redop_id);
+  }
+
+  template <legate::Type::Code CODE,
+            std::enable_if_t<!(CODE == legate::Type::Code::FLOAT32 ||
+                               CODE == legate::Type::Code::FLOAT64)>* = nullptr>
+  void operator()(int32_t type_uid)
+  {
+    LEGATE_ABORT;
+  }
+};
+
 }  // namespace cunumeric
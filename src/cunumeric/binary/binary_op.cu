@@ -51,6 +51,24 @@ static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
   out[point] = func(in1[point], in2[point]);
 }
 
+template <OperandLayout LAYOUT1,
+          OperandLayout LAYOUT2,
+          typename Function,
+          typename LHS,
+          typename RHS1,
+          typename RHS2>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  broadcast_kernel(
+    size_t volume, size_t cols, Function func, LHS* out, const RHS1* in1, const RHS2* in2)
+{
+  const size_t idx = global_tid_1d();
+  if (idx >= volume) return;
+  const size_t row = idx / cols;
+  const size_t col = idx % cols;
+  out[idx] = func(OperandRow<LAYOUT1, RHS1>(in1, row, cols)[col],
+                  OperandRow<LAYOUT2, RHS2>(in2, row, cols)[col]);
+}
+
 template <BinaryOpCode OP_CODE, Type::Code CODE, int DIM>
 struct BinaryOpImplBody<VariantKind::GPU, OP_CODE, CODE, DIM> {
   using OP   = BinaryOp<OP_CODE, CODE>;
@@ -82,6 +100,38 @@ struct BinaryOpImplBody<VariantKind::GPU, OP_CODE, CODE, DIM> {
   }
 };
 
+template <BinaryOpCode OP_CODE, Type::Code CODE>
+struct BinaryOpBroadcastImplBody<VariantKind::GPU, OP_CODE, CODE> {
+  using OP   = BinaryOp<OP_CODE, CODE>;
+  using RHS1 = legate_type_of<CODE>;
+  using RHS2 = rhs2_of_binary_op<OP_CODE, CODE>;
+  using LHS  = std::result_of_t<OP(RHS1, RHS2)>;
+
+  template <OperandLayout LAYOUT1, OperandLayout LAYOUT2>
+  void operator()(
+    OP func, LHS* out, const RHS1* in1, const RHS2* in2, size_t rows, size_t cols) const
+  {
+    const size_t volume = rows * cols;
+    const size_t blocks = (volume + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+    auto stream         = get_cached_stream();
+    broadcast_kernel<LAYOUT1, LAYOUT2>
+      <<<blocks, THREADS_PER_BLOCK, 0, stream>>>(volume, cols, func, out, in1, in2);
+    CHECK_CUDA_STREAM(stream);
+  }
+
+  void operator()(OP func,
+                  LHS* out,
+                  const RHS1* in1,
+                  OperandLayout layout1,
+                  const RHS2* in2,
+                  OperandLayout layout2,
+                  size_t rows,
+                  size_t cols) const
+  {
+    broadcast_dispatch(layout1, layout2, *this, func, out, in1, in2, rows, cols);
+  }
+};
+
 /*static*/ void BinaryOpTask::gpu_variant(TaskContext& context)
 {
   binary_op_template<VariantKind::GPU>(context);
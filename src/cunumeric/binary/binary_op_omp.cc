@@ -17,6 +17,8 @@
 #include "cunumeric/binary/binary_op.h"
 #include "cunumeric/binary/binary_op_template.inl"
 
+#include <omp.h>
+
 namespace cunumeric {
 
 using namespace legate;
@@ -44,15 +46,65 @@ struct BinaryOpImplBody<VariantKind::OMP, OP_CODE, CODE, DIM> {
 #pragma omp parallel for schedule(static)
       for (size_t idx = 0; idx < volume; ++idx) outptr[idx] = func(in1ptr[idx], in2ptr[idx]);
     } else {
+      RowPitches<DIM> rows;
+      const size_t num_rows = rows.flatten(rect, omp_get_max_threads());
+      RowAccessor<LHS, DIM> outrows(out, rect);
+      RowAccessor<const RHS1, DIM> in1rows(in1, rect);
+      RowAccessor<const RHS2, DIM> in2rows(in2, rect);
 #pragma omp parallel for schedule(static)
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto p = pitches.unflatten(idx, rect.lo);
-        out[p] = func(in1[p], in2[p]);
+      for (size_t row = 0; row < num_rows; ++row) {
+        const auto offset   = rows.row_offset(row);
+        const size_t length = rows.row_length(row);
+        auto outrow         = outrows[offset];
+        auto in1row         = in1rows[offset];
+        auto in2row         = in2rows[offset];
+        for (size_t idx = 0; idx < length; ++idx) outrow[idx] = func(in1row[idx], in2row[idx]);
       }
     }
   }
 };
 
+template <BinaryOpCode OP_CODE, Type::Code CODE>
+struct BinaryOpBroadcastImplBody<VariantKind::OMP, OP_CODE, CODE> {
+  using OP   = BinaryOp<OP_CODE, CODE>;
+  using RHS1 = legate_type_of<CODE>;
+  using RHS2 = rhs2_of_binary_op<OP_CODE, CODE>;
+  using LHS  = std::result_of_t<OP(RHS1, RHS2)>;
+
+  template <OperandLayout LAYOUT1, OperandLayout LAYOUT2>
+  void operator()(
+    OP func, LHS* out, const RHS1* in1, const RHS2* in2, size_t rows, size_t cols) const
+  {
+    // Split the rows into chunks when there are too few of them to keep all
+    // threads busy
+    const size_t max_threads = omp_get_max_threads();
+    const size_t chunks      = rows < max_threads ? std::min(cols, max_threads) : 1;
+    const size_t chunk_size  = (cols + chunks - 1) / chunks;
+#pragma omp parallel for schedule(static)
+    for (size_t idx = 0; idx < rows * chunks; ++idx) {
+      const size_t row   = idx / chunks;
+      const size_t start = (idx % chunks) * chunk_size;
+      const size_t stop  = std::min(start + chunk_size, cols);
+      OperandRow<LAYOUT1, RHS1> in1row(in1, row, cols);
+      OperandRow<LAYOUT2, RHS2> in2row(in2, row, cols);
+      auto outrow = out + row * cols;
+      for (size_t col = start; col < stop; ++col) outrow[col] = func(in1row[col], in2row[col]);
+    }
+  }
+
+  void operator()(OP func,
+                  LHS* out,
+                  const RHS1* in1,
+                  OperandLayout layout1,
+                  const RHS2* in2,
+                  OperandLayout layout2,
+                  size_t rows,
+                  size_t cols) const
+  {
+    broadcast_dispatch(layout1, layout2, *this, func, out, in1, in2, rows, cols);
+  }
+};
+
 /*static*/ void BinaryOpTask::omp_variant(TaskContext& context)
 {
   binary_op_template<VariantKind::OMP>(context);
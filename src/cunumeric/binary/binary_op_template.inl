@@ -19,7 +19,9 @@
 // Useful for IDEs
 #include "cunumeric/binary/binary_op.h"
 #include "cunumeric/binary/binary_op_util.h"
+#include "cunumeric/binary/broadcast_util.h"
 #include "cunumeric/pitches.h"
+#include "cunumeric/row_pitches.h"
 
 namespace cunumeric {
 
@@ -28,6 +30,9 @@ using namespace legate;
 template <VariantKind KIND, BinaryOpCode OP_CODE, Type::Code CODE, int DIM>
 struct BinaryOpImplBody;
 
+template <VariantKind KIND, BinaryOpCode OP_CODE, Type::Code CODE>
+struct BinaryOpBroadcastImplBody;
+
 template <VariantKind KIND, BinaryOpCode OP_CODE>
 struct BinaryOpImpl {
   template <Type::Code CODE, int DIM, std::enable_if_t<BinaryOp<OP_CODE, CODE>::valid>* = nullptr>
@@ -59,6 +64,27 @@ struct BinaryOpImpl {
 #endif
 
     OP func{args.args};
+
+#ifndef LEGATE_BOUNDS_CHECKS
+    // Broadcast operands have zero strides and are never dense, so check if
+    // they have one of the layouts that have dedicated kernels
+    if (!dense && out.accessor.is_dense_row_major(rect)) {
+      const RHS1* in1ptr = nullptr;
+      const RHS2* in2ptr = nullptr;
+      auto layout1       = operand_layout(in1, rect, in1ptr);
+      auto layout2       = operand_layout(in2, rect, in2ptr);
+      if (is_broadcast(layout1, layout2)) {
+        // A scalar operand doesn't need the rows, so we treat the whole
+        // rectangle as a single row
+        size_t cols = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
+        if (layout1 == OperandLayout::SCALAR || layout2 == OperandLayout::SCALAR) cols = volume;
+        BinaryOpBroadcastImplBody<KIND, OP_CODE, CODE>()(
+          func, out.ptr(rect), in1ptr, layout1, in2ptr, layout2, volume / cols, cols);
+        return;
+      }
+    }
+#endif
+
     BinaryOpImplBody<KIND, OP_CODE, CODE, DIM>()(func, out, in1, in2, pitches, rect, dense);
   }
 
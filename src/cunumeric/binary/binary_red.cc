@@ -16,6 +16,7 @@
 
 #include "cunumeric/binary/binary_red.h"
 #include "cunumeric/binary/binary_red_template.inl"
+#include "cunumeric/execution_policy/reduction/scalar_reduction.h"
 
 namespace cunumeric {
 
@@ -26,6 +27,10 @@ struct BinaryRedImplBody<VariantKind::CPU, OP_CODE, CODE, DIM> {
   using OP  = BinaryOp<OP_CODE, CODE>;
   using ARG = legate_type_of<CODE>;
 
+  struct DenseReduction {};
+  // Number of elements checked between early exits on the dense path
+  static constexpr size_t BLOCK_SIZE = 64 * REDUCTION_LANES;
+
   template <typename AccessorRD>
   void operator()(OP func,
                   AccessorRD out,
@@ -39,18 +44,34 @@ struct BinaryRedImplBody<VariantKind::CPU, OP_CODE, CODE, DIM> {
     if (dense) {
       auto in1ptr = in1.ptr(rect);
       auto in2ptr = in2.ptr(rect);
-      for (size_t idx = 0; idx < volume; ++idx)
-        if (!func(in1ptr[idx], in2ptr[idx])) {
+      auto kernel = [&func, in1ptr, in2ptr](bool& lhs, size_t idx, bool, DenseReduction) {
+        lhs = lhs & func(in1ptr[idx], in2ptr[idx]);
+      };
+      // Elements in a block are checked without branching, so that the checks can be
+      // vectorized, and the result is only inspected once per block
+      for (size_t start = 0; start < volume; start += BLOCK_SIZE) {
+        const size_t stop = std::min(volume, start + BLOCK_SIZE);
+        if (!multi_accumulator_reduce<ProdReduction<bool>, DenseReduction>(
+              start, stop, true, kernel)) {
           out.reduce(0, false);
           return;
         }
+      }
     } else {
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto point = pitches.unflatten(idx, rect.lo);
-        if (!func(in1[point], in2[point])) {
-          out.reduce(0, false);
-          return;
-        }
+      RowPitches<DIM> rows;
+      const size_t num_rows = rows.flatten(rect);
+      RowAccessor<const ARG, DIM> in1rows(in1, rect);
+      RowAccessor<const ARG, DIM> in2rows(in2, rect);
+      for (size_t row = 0; row < num_rows; ++row) {
+        const auto offset   = rows.row_offset(row);
+        const size_t length = rows.row_length(row);
+        auto in1row         = in1rows[offset];
+        auto in2row         = in2rows[offset];
+        for (size_t idx = 0; idx < length; ++idx)
+          if (!func(in1row[idx], in2row[idx])) {
+            out.reduce(0, false);
+            return;
+          }
       }
     }
 
@@ -16,6 +16,9 @@
 
 #include "cunumeric/binary/binary_red.h"
 #include "cunumeric/binary/binary_red_template.inl"
+#include "cunumeric/execution_policy/reduction/scalar_reduction_omp.h"
+
+#include <omp.h>
 
 namespace cunumeric {
 
@@ -26,6 +29,10 @@ struct BinaryRedImplBody<VariantKind::OMP, OP_CODE, CODE, DIM> {
   using OP  = BinaryOp<OP_CODE, CODE>;
   using ARG = legate_type_of<CODE>;
 
+  struct DenseReduction {};
+  using DensePolicy =
+    ScalarReductionPolicy<VariantKind::OMP, ProdReduction<bool>, MultiAccumulator<DenseReduction>>;
+
   template <typename AccessorRD>
   void operator()(OP func,
                   AccessorRD out,
@@ -36,19 +43,29 @@ struct BinaryRedImplBody<VariantKind::OMP, OP_CODE, CODE, DIM> {
                   bool dense) const
   {
     size_t volume = rect.volume();
-    bool result   = true;
     if (dense) {
       auto in1ptr = in1.ptr(rect);
       auto in2ptr = in2.ptr(rect);
+      auto kernel = [&func, in1ptr, in2ptr](bool& lhs, size_t idx, bool, DenseReduction) {
+        lhs = lhs & func(in1ptr[idx], in2ptr[idx]);
+      };
+      DensePolicy()(volume, out, true, kernel);
+      return;
+    }
+
+    bool result = true;
+    RowPitches<DIM> rows;
+    const size_t num_rows = rows.flatten(rect, omp_get_max_threads());
+    RowAccessor<const ARG, DIM> in1rows(in1, rect);
+    RowAccessor<const ARG, DIM> in2rows(in2, rect);
 #pragma omp parallel for schedule(static)
-      for (size_t idx = 0; idx < volume; ++idx)
-        if (!func(in1ptr[idx], in2ptr[idx])) result = false;
-    } else {
-#pragma omp parallel for schedule(static)
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto point = pitches.unflatten(idx, rect.lo);
-        if (!func(in1[point], in2[point])) result = false;
-      }
+    for (size_t row = 0; row < num_rows; ++row) {
+      const auto offset   = rows.row_offset(row);
+      const size_t length = rows.row_length(row);
+      auto in1row         = in1rows[offset];
+      auto in2row         = in2rows[offset];
+      for (size_t idx = 0; idx < length; ++idx)
+        if (!func(in1row[idx], in2row[idx])) result = false;
     }
 
     out.reduce(0, result);
@@ -20,6 +20,7 @@
 #include "cunumeric/binary/binary_red.h"
 #include "cunumeric/binary/binary_op_util.h"
 #include "cunumeric/pitches.h"
+#include "cunumeric/row_pitches.h"
 
 namespace cunumeric {
 
@@ -0,0 +1,152 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cunumeric/cunumeric.h"
+
+namespace cunumeric {
+
+// Layout of an operand with respect to a dense row-major output, which is
+// viewed as a matrix whose columns are along the last dimension. Broadcast
+// operands come in as stores with zero strides in the promoted dimensions.
+enum class OperandLayout : int32_t {
+  DENSE   = 0,  // Same layout as the output
+  SCALAR  = 1,  // A single value broadcast to all elements
+  ROW     = 2,  // A single contiguous row broadcast along the outer dimensions
+  COLUMN  = 3,  // One value per row, stored contiguously, broadcast along the row
+  STRIDED = 4,  // Anything else
+};
+
+// Computes the layout of an operand and the address of its first element
+template <typename VAL, int DIM>
+OperandLayout operand_layout(const legate::AccessorRO<VAL, DIM>& acc,
+                             const legate::Rect<DIM>& rect,
+                             const VAL*& ptr)
+{
+  if (acc.accessor.is_dense_row_major(rect)) {
+    ptr = acc.ptr(rect);
+    return OperandLayout::DENSE;
+  }
+
+  size_t strides[DIM];
+  ptr = acc.ptr(rect, strides);
+
+  bool inner_zero  = true;
+  bool inner_unit  = true;
+  bool outer_zero  = true;
+  bool outer_dense = true;
+  size_t pitch     = 1;
+  for (int d = DIM - 1; d >= 0; --d) {
+    const size_t extent = rect.hi[d] - rect.lo[d] + 1;
+    // Strides of singleton dimensions don't matter
+    if (extent == 1) continue;
+    if (d == DIM - 1) {
+      inner_zero = strides[d] == 0;
+      inner_unit = strides[d] == 1;
+    } else {
+      outer_zero  = outer_zero && strides[d] == 0;
+      outer_dense = outer_dense && strides[d] == pitch;
+      pitch *= extent;
+    }
+  }
+
+  if (inner_zero && outer_zero) return OperandLayout::SCALAR;
+  if (inner_unit && outer_zero) return OperandLayout::ROW;
+  if (inner_zero && outer_dense) return OperandLayout::COLUMN;
+  return OperandLayout::STRIDED;
+}
+
+// Returns true if one of the operands is dense and the other one has one of
+// the broadcast layouts
+inline bool is_broadcast(OperandLayout layout1, OperandLayout layout2)
+{
+  auto is_bcast = [](OperandLayout layout) {
+    return layout == OperandLayout::SCALAR || layout == OperandLayout::ROW ||
+           layout == OperandLayout::COLUMN;
+  };
+  return (layout1 == OperandLayout::DENSE && is_bcast(layout2)) ||
+         (is_bcast(layout1) && layout2 == OperandLayout::DENSE);
+}
+
+// A row of an operand. Rows of broadcast operands hold their value in a
+// register, while the others stream through memory contiguously.
+template <OperandLayout LAYOUT, typename VAL>
+struct OperandRow;
+
+template <typename VAL>
+struct OperandRow<OperandLayout::DENSE, VAL> {
+  __CUDA_HD__ OperandRow(const VAL* base, size_t row, size_t cols) : ptr(base + row * cols) {}
+  __CUDA_HD__ inline const VAL& operator[](size_t col) const { return ptr[col]; }
+  const VAL* ptr;
+};
+
+template <typename VAL>
+struct OperandRow<OperandLayout::SCALAR, VAL> {
+  __CUDA_HD__ OperandRow(const VAL* base, size_t row, size_t cols) : value(base[0]) {}
+  __CUDA_HD__ inline const VAL& operator[](size_t col) const { return value; }
+  const VAL value;
+};
+
+template <typename VAL>
+struct OperandRow<OperandLayout::ROW, VAL> {
+  __CUDA_HD__ OperandRow(const VAL* base, size_t row, size_t cols) : ptr(base) {}
+  __CUDA_HD__ inline const VAL& operator[](size_t col) const { return ptr[col]; }
+  const VAL* ptr;
+};
+
+template <typename VAL>
+struct OperandRow<OperandLayout::COLUMN, VAL> {
+  __CUDA_HD__ OperandRow(const VAL* base, size_t row, size_t cols) : value(base[row]) {}
+  __CUDA_HD__ inline const VAL& operator[](size_t col) const { return value; }
+  const VAL value;
+};
+
+// Dispatches on the combinations of layouts for which is_broadcast is true
+template <typename Functor, typename... Fnargs>
+void broadcast_dispatch(OperandLayout layout1, OperandLayout layout2, Functor f, Fnargs&&... args)
+{
+  if (layout1 == OperandLayout::DENSE) {
+    switch (layout2) {
+      case OperandLayout::SCALAR:
+        return f.template operator()<OperandLayout::DENSE, OperandLayout::SCALAR>(
+          std::forward<Fnargs>(args)...);
+      case OperandLayout::ROW:
+        return f.template operator()<OperandLayout::DENSE, OperandLayout::ROW>(
+          std::forward<Fnargs>(args)...);
+      case OperandLayout::COLUMN:
+        return f.template operator()<OperandLayout::DENSE, OperandLayout::COLUMN>(
+          std::forward<Fnargs>(args)...);
+      default: break;
+    }
+  } else if (layout2 == OperandLayout::DENSE) {
+    switch (layout1) {
+      case OperandLayout::SCALAR:
+        return f.template operator()<OperandLayout::SCALAR, OperandLayout::DENSE>(
+          std::forward<Fnargs>(args)...);
+      case OperandLayout::ROW:
+        return f.template operator()<OperandLayout::ROW, OperandLayout::DENSE>(
+          std::forward<Fnargs>(args)...);
+      case OperandLayout::COLUMN:
+        return f.template operator()<OperandLayout::COLUMN, OperandLayout::DENSE>(
+          std::forward<Fnargs>(args)...);
+      default: break;
+    }
+  }
+  assert(false);
+}
+
+}  // namespace cunumeric
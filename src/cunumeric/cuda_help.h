@@ -20,6 +20,7 @@
 #include "core/cuda/cuda_help.h"
 #include "core/cuda/stream_pool.h"
 #include "cunumeric/arg.h"
+#include "cunumeric/welford.h"
 #include "cunumeric/device_scalar_reduction_buffer.h"
 #include <cublas_v2.h>
 #include <cusolverDn.h>
@@ -252,6 +253,11 @@ struct HasNativeShuffle<Argval<T>> {
   static constexpr bool value = false;
 };
 
+template <typename T>
+struct HasNativeShuffle<WelfordState<T>> {
+  static constexpr bool value = false;
+};
+
 template <typename T, typename REDUCTION>
 __device__ __forceinline__ void reduce_output(DeviceScalarReductionBuffer<REDUCTION> result,
                                               T value)
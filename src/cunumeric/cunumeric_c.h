@@ -41,35 +41,50 @@ enum CuNumericOpCode {
   CUNUMERIC_SCAN_GLOBAL,
   CUNUMERIC_SCAN_LOCAL,
   CUNUMERIC_DIAG,
+  CUNUMERIC_DIFF,
   CUNUMERIC_DOT,
   CUNUMERIC_EYE,
   CUNUMERIC_FFT,
   CUNUMERIC_FILL,
   CUNUMERIC_FLIP,
+  CUNUMERIC_FUSED_OP,
   CUNUMERIC_GEMM,
+  CUNUMERIC_GRADIENT,
   CUNUMERIC_HISTOGRAM,
+  CUNUMERIC_ISIN,
+  CUNUMERIC_LEXSORT,
   CUNUMERIC_LOAD_CUDALIBS,
   CUNUMERIC_MATMUL,
   CUNUMERIC_MATVECMUL,
   CUNUMERIC_NONZERO,
   CUNUMERIC_PACKBITS,
+  CUNUMERIC_PARTITION,
   CUNUMERIC_POTRF,
   CUNUMERIC_PUTMASK,
+  CUNUMERIC_QUANTILE_SKETCH,
+  CUNUMERIC_QUANTILE_SKETCH_REDUCE,
+  CUNUMERIC_RADIX_SELECT,
   CUNUMERIC_RAND,
   CUNUMERIC_READ,
   CUNUMERIC_REPEAT,
+  CUNUMERIC_SCALAR_STATS,
   CUNUMERIC_SCALAR_UNARY_RED,
   CUNUMERIC_SEARCHSORTED,
+  CUNUMERIC_SEARCHSORTED_MERGE,
+  CUNUMERIC_SEGMENTED_RED,
+  CUNUMERIC_SEGMENTED_RED_GLOBAL,
   CUNUMERIC_SOLVE,
   CUNUMERIC_SORT,
   CUNUMERIC_SYRK,
   CUNUMERIC_TILE,
+  CUNUMERIC_TOPK,
   CUNUMERIC_TRANSPOSE_COPY_2D,
   CUNUMERIC_TRILU,
   CUNUMERIC_TRSM,
   CUNUMERIC_UNARY_OP,
   CUNUMERIC_UNARY_RED,
   CUNUMERIC_UNIQUE,
+  CUNUMERIC_UNIQUE_INVERSE,
   CUNUMERIC_UNIQUE_REDUCE,
   CUNUMERIC_UNLOAD_CUDALIBS,
   CUNUMERIC_UNPACKBITS,
@@ -104,6 +119,7 @@ enum CuNumericUnaryOpCode {
   CUNUMERIC_UOP_FLOOR,
   CUNUMERIC_UOP_FREXP,
   CUNUMERIC_UOP_GETARG,
+  CUNUMERIC_UOP_GETVAR,
   CUNUMERIC_UOP_IMAG,
   CUNUMERIC_UOP_INVERT,
   CUNUMERIC_UOP_ISFINITE,
@@ -152,7 +168,8 @@ enum CuNumericUnaryRedCode {
   CUNUMERIC_RED_PROD,
   CUNUMERIC_RED_SUM,
   CUNUMERIC_RED_SUM_SQUARES,
-  CUNUMERIC_RED_VARIANCE
+  CUNUMERIC_RED_VARIANCE,
+  CUNUMERIC_RED_WELFORD
 };
 
 // Match these to BinaryOpCode in config.py
@@ -226,10 +243,27 @@ enum CuNumericBounds {
 // Match these to ScanCode in config.py
 // Also, sort these alphabetically for easy lookup later
 enum CuNumericScanCode {
-  CUNUMERIC_SCAN_PROD = 1,
+  CUNUMERIC_SCAN_BITWISE_AND = 1,
+  CUNUMERIC_SCAN_BITWISE_OR,
+  CUNUMERIC_SCAN_BITWISE_XOR,
+  CUNUMERIC_SCAN_LOGADDEXP,
+  CUNUMERIC_SCAN_LOGICAL_AND,
+  CUNUMERIC_SCAN_LOGICAL_OR,
+  CUNUMERIC_SCAN_LOGICAL_XOR,
+  CUNUMERIC_SCAN_MAX,
+  CUNUMERIC_SCAN_MIN,
+  CUNUMERIC_SCAN_PROD,
   CUNUMERIC_SCAN_SUM,
 };
 
+// Match these to FusedInstrKind in config.py
+enum CuNumericFusedInstrKind {
+  CUNUMERIC_FUSED_INPUT = 1,
+  CUNUMERIC_FUSED_CONSTANT,
+  CUNUMERIC_FUSED_UNARY,
+  CUNUMERIC_FUSED_BINARY,
+};
+
 // Match these to ConvertCode in config.py
 // Also, sort these alphabetically for easy lookup later
 enum CuNumericConvertCode {
@@ -336,6 +370,7 @@ extern "C" {
 void cunumeric_perform_registration();
 bool cunumeric_has_curand();
 void cunumeric_register_reduction_op(int32_t type_uid, int32_t elem_type_code);
+void cunumeric_register_welford_op(int32_t type_uid, int32_t elem_type_code);
 
 #ifdef __cplusplus
 }
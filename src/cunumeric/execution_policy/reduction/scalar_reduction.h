@@ -17,6 +17,7 @@
 #pragma once
 
 #include "cunumeric/cunumeric.h"
+#include "cunumeric/pairwise.h"
 
 namespace cunumeric {
 
@@ -36,6 +37,60 @@ struct ScalarReductionPolicy {
   };
 };
 
+// Wraps the tag of a dense kernel whose reduction operator is associative and commutative, so
+// that elements may be folded in any order. Policies are then free to spread the elements over
+// several independent accumulators, which breaks the dependency chain on a single accumulator
+// and lets the compiler keep the accumulators in vector registers. Arg reductions must not use
+// this, as they rely on elements being visited in order to break ties.
+template <class Tag>
+struct MultiAccumulator {};
+
+// Number of independent accumulators used for MultiAccumulator reductions
+constexpr size_t REDUCTION_LANES = 8;
+
+// Folds the elements in [start, stop) into REDUCTION_LANES accumulators, element idx going to
+// lane idx % REDUCTION_LANES, and combines the accumulators pairwise at the end
+template <class LG_OP, class Tag, class LHS, class Kernel>
+LHS multi_accumulator_reduce(size_t start, size_t stop, const LHS& identity, Kernel&& kernel)
+{
+  LHS lanes[REDUCTION_LANES];
+  for (size_t lane = 0; lane < REDUCTION_LANES; ++lane) lanes[lane] = identity;
+
+  size_t idx = start;
+  for (; idx + REDUCTION_LANES <= stop; idx += REDUCTION_LANES) {
+    for (size_t lane = 0; lane < REDUCTION_LANES; ++lane)
+      kernel(lanes[lane], idx + lane, identity, Tag{});
+  }
+  for (size_t lane = 0; idx < stop; ++idx, ++lane) kernel(lanes[lane], idx, identity, Tag{});
+
+  for (size_t stride = REDUCTION_LANES / 2; stride > 0; stride /= 2)
+    for (size_t lane = 0; lane < stride; ++lane)
+      LG_OP::template fold<true>(lanes[lane], lanes[lane + stride]);
+  return lanes[0];
+}
+
+// Wraps the tag of a kernel whose elements should be summed pairwise, for reductions that may
+// otherwise accumulate a large rounding error. The same restrictions as for MultiAccumulator
+// apply.
+template <class Tag>
+struct Pairwise {};
+
+// Reduces the elements in [start, stop) in blocks of PAIRWISE_BLOCK elements, each with several
+// accumulators, and merges the blocks pairwise
+template <class LG_OP, class Tag, class LHS, class Kernel>
+LHS pairwise_reduce(size_t start, size_t stop, const LHS& identity, Kernel&& kernel)
+{
+  PairwiseCascade<LG_OP, LHS> cascade;
+  for (size_t lo = start; lo < stop; lo += PAIRWISE_BLOCK) {
+    const size_t hi = std::min(stop, lo + PAIRWISE_BLOCK);
+    auto block      = multi_accumulator_reduce<LG_OP, Tag>(lo, hi, identity, kernel);
+    cascade.push(&block);
+  }
+  auto result = identity;
+  cascade.finish(&result);
+  return result;
+}
+
 template <class LG_OP, class Tag>
 struct ScalarReductionPolicy<VariantKind::CPU, LG_OP, Tag> {
   template <class AccessorRD, class LHS, class Kernel>
@@ -47,4 +102,22 @@ struct ScalarReductionPolicy<VariantKind::CPU, LG_OP, Tag> {
   }
 };
 
+template <class LG_OP, class Tag>
+struct ScalarReductionPolicy<VariantKind::CPU, LG_OP, MultiAccumulator<Tag>> {
+  template <class AccessorRD, class LHS, class Kernel>
+  void operator()(size_t volume, AccessorRD& out, const LHS& identity, Kernel&& kernel)
+  {
+    out.reduce(0, multi_accumulator_reduce<LG_OP, Tag>(0, volume, identity, kernel));
+  }
+};
+
+template <class LG_OP, class Tag>
+struct ScalarReductionPolicy<VariantKind::CPU, LG_OP, Pairwise<Tag>> {
+  template <class AccessorRD, class LHS, class Kernel>
+  void operator()(size_t volume, AccessorRD& out, const LHS& identity, Kernel&& kernel)
+  {
+    out.reduce(0, pairwise_reduce<LG_OP, Tag>(0, volume, identity, kernel));
+  }
+};
+
 }  // namespace cunumeric
@@ -41,4 +41,46 @@ struct ScalarReductionPolicy<VariantKind::OMP, LG_OP, Tag> {
   }
 };
 
+// Each thread reduces a contiguous chunk of the iteration space, the same as a static schedule
+// would give it, with the given sequential reduction
+template <class AccessorRD, class LHS, class Reduce>
+void reduce_chunks(size_t volume, AccessorRD& out, const LHS& identity, Reduce&& reduce)
+{
+  const auto max_threads = omp_get_max_threads();
+  ThreadLocalStorage<LHS> locals(max_threads);
+  for (auto idx = 0; idx < max_threads; ++idx) locals[idx] = identity;
+#pragma omp parallel
+  {
+    const size_t tid         = omp_get_thread_num();
+    const size_t num_threads = omp_get_num_threads();
+    const size_t chunk       = (volume + num_threads - 1) / num_threads;
+    const size_t start       = std::min(volume, tid * chunk);
+    const size_t stop        = std::min(volume, start + chunk);
+    locals[tid]              = reduce(start, stop);
+  }
+  for (auto idx = 0; idx < max_threads; ++idx) out.reduce(0, locals[idx]);
+}
+
+template <class LG_OP, class Tag>
+struct ScalarReductionPolicy<VariantKind::OMP, LG_OP, MultiAccumulator<Tag>> {
+  template <class AccessorRD, class LHS, class Kernel>
+  void operator()(size_t volume, AccessorRD& out, const LHS& identity, Kernel&& kernel)
+  {
+    reduce_chunks(volume, out, identity, [&](size_t start, size_t stop) {
+      return multi_accumulator_reduce<LG_OP, Tag>(start, stop, identity, kernel);
+    });
+  }
+};
+
+template <class LG_OP, class Tag>
+struct ScalarReductionPolicy<VariantKind::OMP, LG_OP, Pairwise<Tag>> {
+  template <class AccessorRD, class LHS, class Kernel>
+  void operator()(size_t volume, AccessorRD& out, const LHS& identity, Kernel&& kernel)
+  {
+    reduce_chunks(volume, out, identity, [&](size_t start, size_t stop) {
+      return pairwise_reduce<LG_OP, Tag>(start, stop, identity, kernel);
+    });
+  }
+};
+
 }  // namespace cunumeric
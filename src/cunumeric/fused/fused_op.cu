@@ -0,0 +1,74 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/fused/fused_op.h"
+#include "cunumeric/fused/fused_op_template.inl"
+
+#include "cunumeric/cuda_help.h"
+
+namespace cunumeric {
+
+template <typename Program, typename LHS, typename Inputs>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  dense_kernel(size_t volume, Program program, LHS* out, Inputs inputs)
+{
+  const size_t idx = global_tid_1d();
+  if (idx >= volume) return;
+  out[idx] = program(inputs, idx);
+}
+
+template <typename Program, typename WriteAcc, typename Inputs, typename Pitches, typename Rect>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  generic_kernel(
+    size_t volume, Program program, WriteAcc out, Inputs inputs, Pitches pitches, Rect rect)
+{
+  const size_t idx = global_tid_1d();
+  if (idx >= volume) return;
+  auto point = pitches.unflatten(idx, rect.lo);
+  out[point] = program(inputs, point);
+}
+
+template <Type::Code CODE, int DIM>
+struct FusedOpImplBody<VariantKind::GPU, CODE, DIM> {
+  using VAL = legate_type_of<CODE>;
+
+  void operator()(const FusedProgram<CODE>& program,
+                  AccessorWO<VAL, DIM> out,
+                  const FusedInputs<VAL, DIM>& inputs,
+                  const Pitches<DIM - 1>& pitches,
+                  const Rect<DIM>& rect,
+                  bool dense) const
+  {
+    size_t volume       = rect.volume();
+    const size_t blocks = (volume + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+    auto stream         = get_cached_stream();
+    if (dense) {
+      auto outptr = out.ptr(rect);
+      dense_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(volume, program, outptr, inputs);
+    } else {
+      generic_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+        volume, program, out, inputs, pitches, rect);
+    }
+    CHECK_CUDA_STREAM(stream);
+  }
+};
+
+/*static*/ void FusedOpTask::gpu_variant(TaskContext& context)
+{
+  fused_op_template<VariantKind::GPU>(context);
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,68 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/fused/fused_op.h"
+#include "cunumeric/fused/fused_op_template.inl"
+
+#include <omp.h>
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <Type::Code CODE, int DIM>
+struct FusedOpImplBody<VariantKind::OMP, CODE, DIM> {
+  using VAL = legate_type_of<CODE>;
+
+  void operator()(const FusedProgram<CODE>& program,
+                  AccessorWO<VAL, DIM> out,
+                  const FusedInputs<VAL, DIM>& inputs,
+                  const Pitches<DIM - 1>& pitches,
+                  const Rect<DIM>& rect,
+                  bool dense) const
+  {
+    const size_t volume = rect.volume();
+    if (dense) {
+      auto outptr = out.ptr(rect);
+#pragma omp parallel for schedule(static)
+      for (size_t idx = 0; idx < volume; ++idx) outptr[idx] = program(inputs, idx);
+    } else {
+      RowPitches<DIM> rows;
+      const size_t num_rows = rows.flatten(rect, omp_get_max_threads());
+      RowAccessor<VAL, DIM> outrows(out, rect);
+      RowAccessor<const VAL, DIM> inrows[MAX_FUSED_INPUTS];
+      for (int32_t input = 0; input < inputs.num_inputs; ++input)
+        inrows[input] = RowAccessor<const VAL, DIM>(inputs.accessors[input], rect);
+#pragma omp parallel for schedule(static)
+      for (size_t row = 0; row < num_rows; ++row) {
+        const auto offset   = rows.row_offset(row);
+        const size_t length = rows.row_length(row);
+        auto outrow         = outrows[offset];
+        FusedRowInputs<VAL> rowinputs;
+        for (int32_t input = 0; input < inputs.num_inputs; ++input)
+          rowinputs.rows[input] = inrows[input][offset];
+        for (size_t idx = 0; idx < length; ++idx) outrow[idx] = program(rowinputs, idx);
+      }
+    }
+  }
+};
+
+/*static*/ void FusedOpTask::omp_variant(TaskContext& context)
+{
+  fused_op_template<VariantKind::OMP>(context);
+}
+
+}  // namespace cunumeric
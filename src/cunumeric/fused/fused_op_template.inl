@@ -0,0 +1,92 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/fused/fused_op.h"
+#include "cunumeric/pitches.h"
+#include "cunumeric/row_pitches.h"
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <VariantKind KIND, Type::Code CODE, int DIM>
+struct FusedOpImplBody;
+
+template <VariantKind KIND>
+struct FusedOpImpl {
+  template <Type::Code CODE, int DIM, std::enable_if_t<FusedProgram<CODE>::valid>* = nullptr>
+  void operator()(FusedOpArgs& args) const
+  {
+    using VAL = legate_type_of<CODE>;
+
+    auto rect = args.out.shape<DIM>();
+
+    Pitches<DIM - 1> pitches;
+    size_t volume = pitches.flatten(rect);
+
+    if (volume == 0) return;
+
+    auto out = args.out.write_accessor<VAL, DIM>(rect);
+
+    assert(args.inputs.size() <= MAX_FUSED_INPUTS);
+    FusedInputs<VAL, DIM> inputs;
+    inputs.num_inputs = static_cast<int32_t>(args.inputs.size());
+
+#ifndef LEGATE_BOUNDS_CHECKS
+    // Check to see if this is dense or not
+    bool dense = out.accessor.is_dense_row_major(rect);
+#else
+    // No dense execution if we're doing bounds checks
+    bool dense = false;
+#endif
+
+    for (int32_t idx = 0; idx < inputs.num_inputs; ++idx) {
+      inputs.accessors[idx] = args.inputs[idx].read_accessor<VAL, DIM>(rect);
+#ifndef LEGATE_BOUNDS_CHECKS
+      dense = dense && inputs.accessors[idx].accessor.is_dense_row_major(rect);
+#endif
+    }
+    if (dense)
+      for (int32_t idx = 0; idx < inputs.num_inputs; ++idx)
+        inputs.ptrs[idx] = inputs.accessors[idx].ptr(rect);
+
+    FusedProgram<CODE> program(args.instrs, args.constants);
+    FusedOpImplBody<KIND, CODE, DIM>()(program, out, inputs, pitches, rect, dense);
+  }
+
+  template <Type::Code CODE, int DIM, std::enable_if_t<!FusedProgram<CODE>::valid>* = nullptr>
+  void operator()(FusedOpArgs& args) const
+  {
+    assert(false);
+  }
+};
+
+template <VariantKind KIND>
+static void fused_op_template(TaskContext& context)
+{
+  auto& inputs  = context.inputs();
+  auto& outputs = context.outputs();
+  auto& scalars = context.scalars();
+
+  FusedOpArgs args{outputs[0], inputs, scalars[0].values<int32_t>(), scalars[1].values<double>()};
+  auto dim = std::max(1, args.out.dim());
+  double_dispatch(dim, args.out.code(), FusedOpImpl<KIND>{}, args);
+}
+
+}  // namespace cunumeric
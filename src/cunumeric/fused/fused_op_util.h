@@ -0,0 +1,260 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cunumeric/cunumeric.h"
+#include "cunumeric/unary/unary_op_util.h"
+#include "cunumeric/binary/binary_op_util.h"
+#include "cunumeric/row_pitches.h"
+
+namespace cunumeric {
+
+enum class FusedInstrKind : int32_t {
+  INPUT    = CUNUMERIC_FUSED_INPUT,
+  CONSTANT = CUNUMERIC_FUSED_CONSTANT,
+  UNARY    = CUNUMERIC_FUSED_UNARY,
+  BINARY   = CUNUMERIC_FUSED_BINARY,
+};
+
+// These limits keep the whole program small enough to be passed by value
+// to the device kernels. Match them to the limits in fused.py
+constexpr int32_t MAX_FUSED_INPUTS    = 8;
+constexpr int32_t MAX_FUSED_INSTRS    = 32;
+constexpr int32_t MAX_FUSED_CONSTANTS = 16;
+
+// Every instruction writes its result to the register with the same index
+// as the instruction, so the program is a topologically sorted expression DAG
+// and the last instruction produces the output value. Operands refer to
+// inputs (INPUT), constants (CONSTANT), or earlier registers (UNARY/BINARY).
+struct FusedInstr {
+  FusedInstrKind kind;
+  int32_t op_code;
+  int32_t src1;
+  int32_t src2;
+};
+
+template <typename OP, typename VAL, bool VALID = OP::valid>
+struct FusedFunctor {
+  FusedFunctor() {}
+  __CUDA_HD__ VAL operator()(const VAL& x) const { return x; }
+  __CUDA_HD__ VAL operator()(const VAL& x, const VAL& y) const { return x; }
+};
+
+template <typename OP, typename VAL>
+struct FusedFunctor<OP, VAL, true> {
+  FusedFunctor() : func(std::vector<legate::Store>{}) {}
+  __CUDA_HD__ VAL operator()(const VAL& x) const { return static_cast<VAL>(func(x)); }
+  __CUDA_HD__ VAL operator()(const VAL& x, const VAL& y) const
+  {
+    return static_cast<VAL>(func(x, y));
+  }
+
+  OP func;
+};
+
+// Host-constructed instances of all the functors that can appear in a fused
+// program. The functors are stateless, so the whole table can be copied
+// to the device along with the program.
+template <legate::Type::Code CODE>
+struct FusedFunctors {
+  using VAL = legate::legate_type_of<CODE>;
+
+  template <UnaryOpCode OP_CODE>
+  using Unary = FusedFunctor<UnaryOp<OP_CODE, CODE>, VAL>;
+  template <BinaryOpCode OP_CODE>
+  using Binary = FusedFunctor<BinaryOp<OP_CODE, CODE>, VAL>;
+
+  __CUDA_HD__ VAL unary(int32_t op_code, const VAL& x) const
+  {
+    switch (static_cast<UnaryOpCode>(op_code)) {
+      case UnaryOpCode::ABSOLUTE: return absolute(x);
+      case UnaryOpCode::ARCCOS: return arccos(x);
+      case UnaryOpCode::ARCSIN: return arcsin(x);
+      case UnaryOpCode::ARCTAN: return arctan(x);
+      case UnaryOpCode::CBRT: return cbrt(x);
+      case UnaryOpCode::CEIL: return ceil(x);
+      case UnaryOpCode::COS: return cos(x);
+      case UnaryOpCode::COSH: return cosh(x);
+      case UnaryOpCode::EXP: return exp(x);
+      case UnaryOpCode::EXP2: return exp2(x);
+      case UnaryOpCode::EXPM1: return expm1(x);
+      case UnaryOpCode::FLOOR: return floor(x);
+      case UnaryOpCode::LOG: return log(x);
+      case UnaryOpCode::LOG10: return log10(x);
+      case UnaryOpCode::LOG1P: return log1p(x);
+      case UnaryOpCode::LOG2: return log2(x);
+      case UnaryOpCode::NEGATIVE: return negative(x);
+      case UnaryOpCode::POSITIVE: return positive(x);
+      case UnaryOpCode::RECIPROCAL: return reciprocal(x);
+      case UnaryOpCode::RINT: return rint(x);
+      case UnaryOpCode::SIGN: return sign(x);
+      case UnaryOpCode::SIN: return sin(x);
+      case UnaryOpCode::SINH: return sinh(x);
+      case UnaryOpCode::SQRT: return sqrt(x);
+      case UnaryOpCode::SQUARE: return square(x);
+      case UnaryOpCode::TAN: return tan(x);
+      case UnaryOpCode::TANH: return tanh(x);
+      case UnaryOpCode::TRUNC: return trunc(x);
+      default: break;
+    }
+    assert(false);
+    return x;
+  }
+
+  __CUDA_HD__ VAL binary(int32_t op_code, const VAL& x, const VAL& y) const
+  {
+    switch (static_cast<BinaryOpCode>(op_code)) {
+      case BinaryOpCode::ADD: return add(x, y);
+      case BinaryOpCode::ARCTAN2: return arctan2(x, y);
+      case BinaryOpCode::COPYSIGN: return copysign(x, y);
+      case BinaryOpCode::DIVIDE: return divide(x, y);
+      case BinaryOpCode::FMOD: return fmod(x, y);
+      case BinaryOpCode::HYPOT: return hypot(x, y);
+      case BinaryOpCode::MAXIMUM: return maximum(x, y);
+      case BinaryOpCode::MINIMUM: return minimum(x, y);
+      case BinaryOpCode::MULTIPLY: return multiply(x, y);
+      case BinaryOpCode::POWER: return power(x, y);
+      case BinaryOpCode::SUBTRACT: return subtract(x, y);
+      default: break;
+    }
+    assert(false);
+    return x;
+  }
+
+  Unary<UnaryOpCode::ABSOLUTE> absolute;
+  Unary<UnaryOpCode::ARCCOS> arccos;
+  Unary<UnaryOpCode::ARCSIN> arcsin;
+  Unary<UnaryOpCode::ARCTAN> arctan;
+  Unary<UnaryOpCode::CBRT> cbrt;
+  Unary<UnaryOpCode::CEIL> ceil;
+  Unary<UnaryOpCode::COS> cos;
+  Unary<UnaryOpCode::COSH> cosh;
+  Unary<UnaryOpCode::EXP> exp;
+  Unary<UnaryOpCode::EXP2> exp2;
+  Unary<UnaryOpCode::EXPM1> expm1;
+  Unary<UnaryOpCode::FLOOR> floor;
+  Unary<UnaryOpCode::LOG> log;
+  Unary<UnaryOpCode::LOG10> log10;
+  Unary<UnaryOpCode::LOG1P> log1p;
+  Unary<UnaryOpCode::LOG2> log2;
+  Unary<UnaryOpCode::NEGATIVE> negative;
+  Unary<UnaryOpCode::POSITIVE> positive;
+  Unary<UnaryOpCode::RECIPROCAL> reciprocal;
+  Unary<UnaryOpCode::RINT> rint;
+  Unary<UnaryOpCode::SIGN> sign;
+  Unary<UnaryOpCode::SIN> sin;
+  Unary<UnaryOpCode::SINH> sinh;
+  Unary<UnaryOpCode::SQRT> sqrt;
+  Unary<UnaryOpCode::SQUARE> square;
+  Unary<UnaryOpCode::TAN> tan;
+  Unary<UnaryOpCode::TANH> tanh;
+  Unary<UnaryOpCode::TRUNC> trunc;
+
+  Binary<BinaryOpCode::ADD> add;
+  Binary<BinaryOpCode::ARCTAN2> arctan2;
+  Binary<BinaryOpCode::COPYSIGN> copysign;
+  Binary<BinaryOpCode::DIVIDE> divide;
+  Binary<BinaryOpCode::FMOD> fmod;
+  Binary<BinaryOpCode::HYPOT> hypot;
+  Binary<BinaryOpCode::MAXIMUM> maximum;
+  Binary<BinaryOpCode::MINIMUM> minimum;
+  Binary<BinaryOpCode::MULTIPLY> multiply;
+  Binary<BinaryOpCode::POWER> power;
+  Binary<BinaryOpCode::SUBTRACT> subtract;
+};
+
+template <legate::Type::Code CODE>
+struct FusedProgram {
+  using VAL = legate::legate_type_of<CODE>;
+
+  static constexpr bool valid =
+    CODE == legate::Type::Code::FLOAT32 || CODE == legate::Type::Code::FLOAT64;
+
+  FusedProgram(legate::Span<const int32_t> encoded, legate::Span<const double> values)
+  {
+    assert(encoded.size() % 4 == 0);
+    num_instrs = static_cast<int32_t>(encoded.size() / 4);
+    assert(num_instrs > 0 && num_instrs <= MAX_FUSED_INSTRS);
+    for (int32_t idx = 0; idx < num_instrs; ++idx) {
+      instrs[idx].kind    = static_cast<FusedInstrKind>(encoded[4 * idx]);
+      instrs[idx].op_code = encoded[4 * idx + 1];
+      instrs[idx].src1    = encoded[4 * idx + 2];
+      instrs[idx].src2    = encoded[4 * idx + 3];
+    }
+    assert(values.size() <= MAX_FUSED_CONSTANTS);
+    for (size_t idx = 0; idx < values.size(); ++idx) constants[idx] = static_cast<VAL>(values[idx]);
+  }
+
+  // Evaluates the program for a single element. INPUTS only needs to provide
+  // a load(input, index) method, which lets the same evaluator serve both
+  // the dense and the strided paths.
+  template <typename INPUTS, typename INDEX>
+  __CUDA_HD__ VAL operator()(const INPUTS& inputs, const INDEX& index) const
+  {
+    VAL regs[MAX_FUSED_INSTRS];
+    for (int32_t idx = 0; idx < num_instrs; ++idx) {
+      const FusedInstr& instr = instrs[idx];
+      switch (instr.kind) {
+        case FusedInstrKind::INPUT: {
+          regs[idx] = inputs.load(instr.src1, index);
+          break;
+        }
+        case FusedInstrKind::CONSTANT: {
+          regs[idx] = constants[instr.src1];
+          break;
+        }
+        case FusedInstrKind::UNARY: {
+          regs[idx] = functors.unary(instr.op_code, regs[instr.src1]);
+          break;
+        }
+        case FusedInstrKind::BINARY: {
+          regs[idx] = functors.binary(instr.op_code, regs[instr.src1], regs[instr.src2]);
+          break;
+        }
+      }
+    }
+    return regs[num_instrs - 1];
+  }
+
+  int32_t num_instrs;
+  FusedInstr instrs[MAX_FUSED_INSTRS];
+  VAL constants[MAX_FUSED_CONSTANTS];
+  FusedFunctors<CODE> functors;
+};
+
+template <typename VAL, int DIM>
+struct FusedInputs {
+  __CUDA_HD__ VAL load(int32_t input, size_t idx) const { return ptrs[input][idx]; }
+  __CUDA_HD__ VAL load(int32_t input, const legate::Point<DIM>& point) const
+  {
+    return accessors[input][point];
+  }
+
+  int32_t num_inputs;
+  const VAL* ptrs[MAX_FUSED_INPUTS];
+  legate::AccessorRO<VAL, DIM> accessors[MAX_FUSED_INPUTS];
+};
+
+// Inputs of a single row in the non-dense path
+template <typename VAL>
+struct FusedRowInputs {
+  __CUDA_HD__ VAL load(int32_t input, size_t idx) const { return rows[input][idx]; }
+
+  RowView<const VAL> rows[MAX_FUSED_INPUTS];
+};
+
+}  // namespace cunumeric
@@ -35,23 +35,33 @@ struct AdvancedIndexingImplBody<VariantKind::CPU, CODE, DIM, OUT_TYPE> {
                       const size_t key_dim,
                       const size_t skip_size) const
   {
+    RowPitches<DIM> rows;
+    const size_t num_rows = rows.flatten(rect);
+    RowAccessor<const VAL, DIM> inputrows(input, rect);
+    RowAccessor<const bool, DIM> indexrows(index, rect);
+
     size_t out_idx = 0;
-    for (size_t idx = 0; idx < volume; ++idx) {
-      auto p = pitches.unflatten(idx, rect.lo);
-      if (index[p] == true) {
-        Point<DIM> out_p;
-        out_p[0] = out_idx;
-        for (size_t i = 0; i < DIM - key_dim; i++) {
-          size_t j     = key_dim + i;
-          out_p[i + 1] = p[j];
+    for (size_t row = 0; row < num_rows; ++row) {
+      const auto offset   = rows.row_offset(row);
+      const size_t length = rows.row_length(row);
+      const size_t first  = rows.row_first(row);
+      auto inputrow       = inputrows[offset];
+      auto indexrow       = indexrows[offset];
+      Point<DIM> p        = rect.lo + offset;
+      for (size_t idx = 0; idx < length; ++idx, ++p[DIM - 1]) {
+        if (indexrow[idx] == true) {
+          Point<DIM> out_p;
+          out_p[0] = out_idx;
+          for (size_t i = 0; i < DIM - key_dim; i++) {
+            size_t j     = key_dim + i;
+            out_p[i + 1] = p[j];
+          }
+          for (size_t i = DIM - key_dim + 1; i < DIM; i++) out_p[i] = 0;
+          fill_out(out[out_p], p, inputrow[idx]);
+          // The logic below is based on the assumtion that
+          // rows enumerate points in C-order
+          if ((first + idx + 1) % skip_size == 0) out_idx++;
         }
-        for (size_t i = DIM - key_dim + 1; i < DIM; i++) out_p[i] = 0;
-        fill_out(out[out_p], p, input[p]);
-        // The logic below is based on the assumtion that
-        // pitches enumerate points in C-order, but this might
-        // change in the future
-        // TODO: replace with the order-aware interator when available
-        if ((idx + 1) % skip_size == 0) out_idx++;
       }
     }
   }
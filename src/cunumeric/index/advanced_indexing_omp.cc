@@ -38,15 +38,22 @@ struct AdvancedIndexingImplBody<VariantKind::OMP, CODE, DIM, OUT_TYPE> {
                                 const size_t skip_size,
                                 const size_t max_threads) const
   {
+    RowPitches<DIM> rows;
+    const size_t num_rows = rows.flatten(rect, max_threads);
+    RowAccessor<const bool, DIM> indexrows(index, rect);
+
     ThreadLocalStorage<int64_t> sizes(max_threads);
     for (auto idx = 0; idx < max_threads; ++idx) sizes[idx] = 0;
 #pragma omp parallel
     {
       const int tid = omp_get_thread_num();
 #pragma omp for schedule(static)
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto p = pitches.unflatten(idx, rect.lo);
-        sizes[tid] += static_cast<int64_t>(index[p] && ((idx + 1) % skip_size == 0));
+      for (size_t row = 0; row < num_rows; ++row) {
+        const size_t length = rows.row_length(row);
+        const size_t first  = rows.row_first(row);
+        auto indexrow       = indexrows[rows.row_offset(row)];
+        for (size_t idx = 0; idx < length; ++idx)
+          sizes[tid] += static_cast<int64_t>(indexrow[idx] && ((first + idx + 1) % skip_size == 0));
       }
     }  // end of parallel
     size_t size = 0;
@@ -87,27 +94,40 @@ struct AdvancedIndexingImplBody<VariantKind::OMP, CODE, DIM, OUT_TYPE> {
     for (size_t i = DIM - key_dim + 1; i < DIM; i++) extents[i] = 1;
 
     auto out = out_arr.create_output_buffer<OUT_TYPE, DIM>(extents, true);
-    if (size > 0)
+    if (size == 0) return;
+
+    // The partition of rows among threads must match the one used in
+    // compute_output_offsets
+    RowPitches<DIM> rows;
+    const size_t num_rows = rows.flatten(rect, max_threads);
+    RowAccessor<const VAL, DIM> inputrows(input, rect);
+    RowAccessor<const bool, DIM> indexrows(index, rect);
 #pragma omp parallel
     {
       const int tid   = omp_get_thread_num();
       int64_t out_idx = offsets[tid];
 #pragma omp for schedule(static)
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto p = pitches.unflatten(idx, rect.lo);
-        if (index[p] == true) {
-          Point<DIM> out_p;
-          out_p[0] = out_idx;
-          for (size_t i = 0; i < DIM - key_dim; i++) {
-            size_t j     = key_dim + i;
-            out_p[i + 1] = p[j];
+      for (size_t row = 0; row < num_rows; ++row) {
+        const auto offset   = rows.row_offset(row);
+        const size_t length = rows.row_length(row);
+        const size_t first  = rows.row_first(row);
+        auto inputrow       = inputrows[offset];
+        auto indexrow       = indexrows[offset];
+        Point<DIM> p        = rect.lo + offset;
+        for (size_t idx = 0; idx < length; ++idx, ++p[DIM - 1]) {
+          if (indexrow[idx] == true) {
+            Point<DIM> out_p;
+            out_p[0] = out_idx;
+            for (size_t i = 0; i < DIM - key_dim; i++) {
+              size_t j     = key_dim + i;
+              out_p[i + 1] = p[j];
+            }
+            for (size_t i = DIM - key_dim + 1; i < DIM; i++) out_p[i] = 0;
+            fill_out(out[out_p], p, inputrow[idx]);
+            if ((first + idx + 1) % skip_size == 0) out_idx++;
           }
-          for (size_t i = DIM - key_dim + 1; i < DIM; i++) out_p[i] = 0;
-          fill_out(out[out_p], p, input[p]);
-          if ((idx + 1) % skip_size == 0) out_idx++;
         }
       }
-
     }  // end parallel region
   }
 };
@@ -85,6 +85,31 @@ std::vector<StoreMapping> CuNumericMapper::store_mappings(
         input_mapping.stores.push_back(inputs[idx]);
       return std::move(mappings);
     }
+    case CUNUMERIC_DIFF: {
+      // The input tiles are shifted along the axis and share one instance
+      std::vector<StoreMapping> mappings;
+      auto& inputs = task.inputs();
+      mappings.push_back(StoreMapping::default_mapping(inputs[0], options.front()));
+      auto& input_mapping = mappings.back();
+      for (uint32_t idx = 1; idx < inputs.size(); ++idx)
+        input_mapping.stores.push_back(inputs[idx]);
+      return std::move(mappings);
+    }
+    case CUNUMERIC_GRADIENT: {
+      // Same as diff, except that the coordinates come last if the spacing is
+      // not uniform
+      std::vector<StoreMapping> mappings;
+      auto& inputs             = task.inputs();
+      auto uniform             = task.scalars()[3].value<bool>();
+      const uint32_t num_tiles = uniform ? inputs.size() : inputs.size() - 1;
+      mappings.push_back(StoreMapping::default_mapping(inputs[0], options.front()));
+      auto& input_mapping = mappings.back();
+      for (uint32_t idx = 1; idx < num_tiles; ++idx)
+        input_mapping.stores.push_back(inputs[idx]);
+      if (!uniform)
+        mappings.push_back(StoreMapping::default_mapping(inputs.back(), options.front()));
+      return std::move(mappings);
+    }
     case CUNUMERIC_FFT: {
       std::vector<StoreMapping> mappings;
       auto& inputs  = task.inputs();
@@ -182,6 +207,7 @@ std::vector<StoreMapping> CuNumericMapper::store_mappings(
       mappings.back().policy.exact = true;
       return std::move(mappings);
     }
+    case CUNUMERIC_LEXSORT:
     case CUNUMERIC_SORT: {
       std::vector<StoreMapping> mappings;
       auto& inputs  = task.inputs();
@@ -198,38 +224,6 @@ std::vector<StoreMapping> CuNumericMapper::store_mappings(
       }
       return std::move(mappings);
     }
-    case CUNUMERIC_SCAN_LOCAL: {
-      std::vector<StoreMapping> mappings;
-      auto& inputs  = task.inputs();
-      auto& outputs = task.outputs();
-      for (auto& input : inputs) {
-        mappings.push_back(StoreMapping::default_mapping(input, options.front()));
-        mappings.back().policy.ordering.set_c_order();
-        mappings.back().policy.exact = true;
-      }
-      for (auto& output : outputs) {
-        mappings.push_back(StoreMapping::default_mapping(output, options.front()));
-        mappings.back().policy.ordering.set_c_order();
-        mappings.back().policy.exact = true;
-      }
-      return std::move(mappings);
-    }
-    case CUNUMERIC_SCAN_GLOBAL: {
-      std::vector<StoreMapping> mappings;
-      auto& inputs  = task.inputs();
-      auto& outputs = task.outputs();
-      for (auto& input : inputs) {
-        mappings.push_back(StoreMapping::default_mapping(input, options.front()));
-        mappings.back().policy.ordering.set_c_order();
-        mappings.back().policy.exact = true;
-      }
-      for (auto& output : outputs) {
-        mappings.push_back(StoreMapping::default_mapping(output, options.front()));
-        mappings.back().policy.ordering.set_c_order();
-        mappings.back().policy.exact = true;
-      }
-      return std::move(mappings);
-    }
     case CUNUMERIC_BITGENERATOR: {
       std::vector<StoreMapping> mappings;
       auto& inputs  = task.inputs();
@@ -16,6 +16,7 @@
 
 #include "cunumeric/matrix/dot.h"
 #include "cunumeric/matrix/dot_template.inl"
+#include "cunumeric/execution_policy/reduction/scalar_reduction.h"
 
 namespace cunumeric {
 
@@ -26,6 +27,10 @@ struct DotImplBody<VariantKind::CPU, CODE> {
   using VAL = legate_type_of<CODE>;
   using ACC = acc_type_of<VAL>;
 
+  struct DenseReduction {};
+  using DensePolicy =
+    ScalarReductionPolicy<VariantKind::CPU, SumReduction<ACC>, MultiAccumulator<DenseReduction>>;
+
   template <typename AccessorRD>
   void operator()(AccessorRD out,
                   const AccessorRO<VAL, 1>& rhs1,
@@ -37,10 +42,11 @@ struct DotImplBody<VariantKind::CPU, CODE> {
     if (dense) {
       auto rhs1ptr = rhs1.ptr(rect);
       auto rhs2ptr = rhs2.ptr(rect);
-      for (coord_t idx = 0; idx < volume; ++idx) {
+      auto kernel  = [rhs1ptr, rhs2ptr](ACC& lhs, size_t idx, const ACC&, DenseReduction) {
         const auto prod = static_cast<ACC>(rhs1ptr[idx]) * static_cast<ACC>(rhs2ptr[idx]);
-        out.reduce(0, prod);
-      }
+        SumReduction<ACC>::template fold<true>(lhs, prod);
+      };
+      DensePolicy()(volume, out, SumReduction<ACC>::identity, kernel);
     } else {
       for (coord_t idx = rect.lo[0]; idx <= rect.hi[0]; ++idx) {
         const auto prod = static_cast<ACC>(rhs1[idx]) * static_cast<ACC>(rhs2[idx]);
@@ -16,7 +16,7 @@
 
 #include "cunumeric/matrix/dot.h"
 #include "cunumeric/matrix/dot_template.inl"
-#include "cunumeric/omp_help.h"
+#include "cunumeric/execution_policy/reduction/scalar_reduction_omp.h"
 
 #include <omp.h>
 
@@ -29,6 +29,10 @@ struct DotImplBody<VariantKind::OMP, CODE> {
   using VAL = legate_type_of<CODE>;
   using ACC = acc_type_of<VAL>;
 
+  struct DenseReduction {};
+  using DensePolicy =
+    ScalarReductionPolicy<VariantKind::OMP, SumReduction<ACC>, MultiAccumulator<DenseReduction>>;
+
   template <typename AccessorRD>
   void operator()(AccessorRD out,
                   const AccessorRO<VAL, 1>& rhs1,
@@ -36,35 +40,30 @@ struct DotImplBody<VariantKind::OMP, CODE> {
                   const Rect<1>& rect,
                   bool dense)
   {
-    const auto volume      = rect.volume();
-    const auto max_threads = omp_get_max_threads();
-    ThreadLocalStorage<ACC> locals(max_threads);
-    for (auto idx = 0; idx < max_threads; ++idx) locals[idx] = SumReduction<ACC>::identity;
-
+    const auto volume = rect.volume();
     if (dense) {
       auto rhs1ptr = rhs1.ptr(rect);
       auto rhs2ptr = rhs2.ptr(rect);
+      auto kernel  = [rhs1ptr, rhs2ptr](ACC& lhs, size_t idx, const ACC&, DenseReduction) {
+        const auto prod = static_cast<ACC>(rhs1ptr[idx]) * static_cast<ACC>(rhs2ptr[idx]);
+        SumReduction<ACC>::template fold<true>(lhs, prod);
+      };
+      DensePolicy()(volume, out, SumReduction<ACC>::identity, kernel);
+      return;
+    }
+
+    const auto max_threads = omp_get_max_threads();
+    ThreadLocalStorage<ACC> locals(max_threads);
+    for (auto idx = 0; idx < max_threads; ++idx) locals[idx] = SumReduction<ACC>::identity;
 #pragma omp parallel
-      {
-        const int tid = omp_get_thread_num();
-#pragma omp for schedule(static)
-        for (size_t idx = 0; idx < volume; ++idx) {
-          const auto prod = static_cast<ACC>(rhs1ptr[idx]) * static_cast<ACC>(rhs2ptr[idx]);
-          SumReduction<ACC>::template fold<true>(locals[tid], prod);
-        }
-      }
-    } else {
-#pragma omp parallel
-      {
-        const int tid = omp_get_thread_num();
+    {
+      const int tid = omp_get_thread_num();
 #pragma omp for schedule(static)
-        for (coord_t idx = rect.lo[0]; idx <= rect.hi[0]; ++idx) {
-          const auto prod = static_cast<ACC>(rhs1[idx]) * static_cast<ACC>(rhs2[idx]);
-          SumReduction<ACC>::template fold<true>(locals[tid], prod);
-        }
+      for (coord_t idx = rect.lo[0]; idx <= rect.hi[0]; ++idx) {
+        const auto prod = static_cast<ACC>(rhs1[idx]) * static_cast<ACC>(rhs2[idx]);
+        SumReduction<ACC>::template fold<true>(locals[tid], prod);
       }
     }
-
     for (auto idx = 0; idx < max_threads; ++idx) out.reduce(0, locals[idx]);
   }
 };
@@ -35,9 +35,13 @@ struct FillImplBody<VariantKind::CPU, VAL, DIM> {
       auto outptr = out.ptr(rect);
       for (size_t idx = 0; idx < volume; ++idx) outptr[idx] = fill_value;
     } else {
-      for (size_t idx = 0; idx < volume; ++idx) {
-        const auto point = pitches.unflatten(idx, rect.lo);
-        out[point]       = fill_value;
+      RowPitches<DIM> rows;
+      const size_t num_rows = rows.flatten(rect);
+      RowAccessor<VAL, DIM> outrows(out, rect);
+      for (size_t row = 0; row < num_rows; ++row) {
+        const size_t length = rows.row_length(row);
+        auto outrow         = outrows[rows.row_offset(row)];
+        for (size_t idx = 0; idx < length; ++idx) outrow[idx] = fill_value;
       }
     }
   }
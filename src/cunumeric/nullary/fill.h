@@ -24,6 +24,7 @@ struct FillArgs {
   const Array& out;
   const Array& fill_value;
   bool is_argval;
+  bool is_welford;
 };
 
 class FillTask : public CuNumericTask<FillTask> {
@@ -17,6 +17,8 @@
 #include "cunumeric/nullary/fill.h"
 #include "cunumeric/nullary/fill_template.inl"
 
+#include <omp.h>
+
 namespace cunumeric {
 
 using namespace legate;
@@ -41,10 +43,14 @@ struct FillImplBody<VariantKind::OMP, VAL, DIM> {
 #pragma omp parallel for schedule(static)
       for (size_t idx = 0; idx < volume; ++idx) outptr[idx] = fill_value;
     } else {
+      RowPitches<DIM> rows;
+      const size_t num_rows = rows.flatten(rect, omp_get_max_threads());
+      RowAccessor<VAL, DIM> outrows(out, rect);
 #pragma omp parallel for schedule(static)
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto p = pitches.unflatten(idx, rect.lo);
-        out[p] = fill_value;
+      for (size_t row = 0; row < num_rows; ++row) {
+        const size_t length = rows.row_length(row);
+        auto outrow         = outrows[rows.row_offset(row)];
+        for (size_t idx = 0; idx < length; ++idx) outrow[idx] = fill_value;
       }
     }
   }
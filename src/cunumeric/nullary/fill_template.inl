@@ -20,7 +20,9 @@
 #include "cunumeric/nullary/fill.h"
 #include "cunumeric/arg.h"
 #include "cunumeric/arg.inl"
+#include "cunumeric/welford.h"
 #include "cunumeric/pitches.h"
+#include "cunumeric/row_pitches.h"
 
 namespace cunumeric {
 
@@ -60,6 +62,14 @@ struct FillImpl {
     if (args.is_argval) {
       using VAL = Argval<legate_type_of<CODE>>;
       fill<VAL, DIM>(args);
+    } else if (args.is_welford) {
+      if constexpr (CODE == Type::Code::FLOAT32 || CODE == Type::Code::FLOAT64) {
+        using VAL = WelfordState<legate_type_of<CODE>>;
+        // The struct type must have the layout of the state
+        assert(args.out.type().size() == sizeof(VAL));
+        fill<VAL, DIM>(args);
+      } else
+        assert(false);
     } else {
       using VAL = legate_type_of<CODE>;
       fill<VAL, DIM>(args);
@@ -70,13 +80,18 @@ struct FillImpl {
 template <VariantKind KIND>
 static void fill_template(TaskContext& context)
 {
-  FillArgs args{context.outputs()[0], context.inputs()[0], context.scalars()[0].value<bool>()};
+  FillArgs args{
+    context.outputs()[0], context.inputs()[0], context.scalars()[0].value<bool>(), false};
   Type::Code code{args.out.code()};
   if (Type::Code::STRUCT == code) {
+    auto& struct_type = static_cast<const StructType&>(args.out.type());
+    // Struct types that are not argvals hold the (count, mean, M2) states of
+    // Welford reductions, whose second field has the value type as well
+    args.is_welford = !args.is_argval;
 #ifdef DEBUG_CUNUMERIC
-    assert(args.is_argval);
+    assert(struct_type.num_fields() == (args.is_argval ? 2 : 3));
 #endif
-    auto& field_type = static_cast<const StructType&>(args.out.type()).field_type(1);
+    auto& field_type = struct_type.field_type(1);
     code             = field_type.code;
   }
   double_dispatch(args.out.dim(), code, FillImpl<KIND>{}, args);
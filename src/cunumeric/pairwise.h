@@ -0,0 +1,71 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace cunumeric {
+
+// Number of consecutive elements that are accumulated directly before their
+// partial result goes through the pairwise cascade
+constexpr size_t PAIRWISE_BLOCK = 128;
+
+// Streaming pairwise reduction of blocks of partial results. Blocks are
+// merged like the digits of a binary counter, so that after n blocks every
+// partial result has been through O(log n) folds rather than O(n), which
+// keeps the rounding error of long floating-point sums close to that of a
+// recursive pairwise sum. Each block holds `width` independent values, e.g.
+// one per output of an axis reduction. Host-only.
+template <class LG_OP, class VAL>
+class PairwiseCascade {
+ public:
+  explicit PairwiseCascade(size_t width = 1) : width_(width) {}
+
+ public:
+  // Folds a block of partial results in. The contents of the block are
+  // clobbered.
+  void push(VAL* block)
+  {
+    size_t level = 0;
+    for (uint64_t count = count_++; count & 1; count >>= 1, ++level)
+      for (size_t idx = 0; idx < width_; ++idx)
+        LG_OP::template fold<true>(block[idx], levels_[level * width_ + idx]);
+    if (levels_.size() < (level + 1) * width_) levels_.resize((level + 1) * width_);
+    std::copy(block, block + width_, levels_.begin() + level * width_);
+  }
+  // Folds all partial results pushed so far into out, from the smallest to
+  // the largest
+  void finish(VAL* out) const
+  {
+    size_t level = 0;
+    for (uint64_t count = count_; count > 0; count >>= 1, ++level)
+      if (count & 1)
+        for (size_t idx = 0; idx < width_; ++idx)
+          LG_OP::template fold<true>(out[idx], levels_[level * width_ + idx]);
+  }
+  // Forgets all partial results, keeping the storage
+  void clear() { count_ = 0; }
+
+ private:
+  size_t width_;
+  uint64_t count_{0};
+  std::vector<VAL> levels_;
+};
+
+}  // namespace cunumeric
@@ -0,0 +1,189 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "core/utilities/typedefs.h"
+
+namespace cunumeric {
+
+// Row-wise counterpart of Pitches for non-dense iteration. The rectangle is
+// split into rows along its last dimension, so only the outer coordinates
+// are unflattened, once per row, and the elements of a row are visited by a
+// constant-stride inner loop that the compiler can vectorize. Rows are cut
+// into equal chunks when there are fewer of them than the requested minimum,
+// so that e.g. a strided 1-D view still has enough rows to go around all
+// OpenMP threads.
+template <int DIM>
+class RowPitches {
+ public:
+  // Returns the number of rows in the rectangle
+  __CUDA_HD__
+  inline size_t flatten(const legate::Rect<DIM>& rect, size_t min_rows = 1)
+  {
+    size_t num_rows = 1;
+    for (int d = DIM - 1; d >= 0; --d) {
+      // Quick exit for empty rectangle dimensions
+      if (rect.lo[d] > rect.hi[d]) return 0;
+      const size_t diff = rect.hi[d] - rect.lo[d] + 1;
+      if (d == DIM - 1)
+        extent = diff;
+      else {
+        pitches[d] = num_rows;
+        num_rows *= diff;
+      }
+    }
+    chunks = 1;
+    if (num_rows < min_rows) {
+      chunks = (min_rows + num_rows - 1) / num_rows;
+      if (chunks > extent) chunks = extent;
+    }
+    chunk_size = (extent + chunks - 1) / chunks;
+    chunks     = (extent + chunk_size - 1) / chunk_size;
+    return num_rows * chunks;
+  }
+  // Number of elements in a row
+  __CUDA_HD__
+  inline size_t row_length(size_t row) const
+  {
+    const size_t start = (row % chunks) * chunk_size;
+    return extent - start < chunk_size ? extent - start : chunk_size;
+  }
+  // Linear index of the first element of a row in C order
+  __CUDA_HD__
+  inline size_t row_first(size_t row) const
+  {
+    return (row / chunks) * extent + (row % chunks) * chunk_size;
+  }
+  // Offset of the first element of a row from the lower bound of the rectangle
+  __CUDA_HD__
+  inline legate::Point<DIM> row_offset(size_t row) const
+  {
+    legate::Point<DIM> offset;
+    offset[DIM - 1] = (row % chunks) * chunk_size;
+    row /= chunks;
+    for (int d = 0; d < DIM - 1; ++d) {
+      offset[d] = row / pitches[d];
+      row       = row % pitches[d];
+    }
+    return offset;
+  }
+  __CUDA_HD__
+  inline legate::Point<DIM> row_start(size_t row, const legate::Point<DIM>& lo) const
+  {
+    return lo + row_offset(row);
+  }
+
+ private:
+  size_t pitches[DIM > 1 ? DIM - 1 : 1];
+  size_t extent;
+  size_t chunks;
+  size_t chunk_size;
+};
+
+// Row-wise iteration for reductions along one dimension. Rows are along the
+// last dimension and are enumerated over all other dimensions except the
+// collapsed one, whose coordinate is given separately. When the last
+// dimension is the collapsed one, each row reduces to a single output.
+template <int DIM>
+class AxisPitches {
+ public:
+  // Returns the number of rows in a slice normal to the collapsed dimension
+  __CUDA_HD__
+  inline size_t flatten(const legate::Rect<DIM>& rect, int32_t collapsed_dim)
+  {
+    collapsed = collapsed_dim;
+    size_t num_rows = 1;
+    for (int d = DIM - 2; d >= 0; --d) {
+      pitches[d] = num_rows;
+      if (d != collapsed) num_rows *= rect.hi[d] - rect.lo[d] + 1;
+    }
+    return num_rows;
+  }
+  // Offset of the first element of a row from the lower bound of the rectangle
+  __CUDA_HD__
+  inline legate::Point<DIM> row_offset(size_t row, coord_t collapsed_idx) const
+  {
+    legate::Point<DIM> offset = legate::Point<DIM>::ZEROES();
+    for (int d = 0; d < DIM - 1; ++d) {
+      if (d == collapsed) continue;
+      offset[d] = row / pitches[d];
+      row       = row % pitches[d];
+    }
+    offset[collapsed] += collapsed_idx;
+    return offset;
+  }
+
+ private:
+  int32_t collapsed;
+  size_t pitches[DIM > 1 ? DIM - 1 : 1];
+};
+
+// A single row of an affine accessor
+template <typename T>
+class RowView {
+ public:
+  RowView() = default;
+  __CUDA_HD__
+  RowView(T* ptr, size_t stride) : ptr_(ptr), stride_(stride) {}
+  __CUDA_HD__
+  inline T& operator[](size_t idx) const { return ptr_[idx * stride_]; }
+  __CUDA_HD__
+  inline T* ptr() const { return ptr_; }
+  __CUDA_HD__
+  inline bool contiguous() const { return stride_ == 1; }
+
+ private:
+  T* ptr_;
+  size_t stride_;
+};
+
+// Resolves the base pointer and strides of an accessor over a rectangle
+// once, so that rows can be located without going through the accessor for
+// every element. T should be const-qualified for read-only accessors.
+template <typename T, int DIM>
+class RowAccessor {
+ public:
+  RowAccessor() = default;
+  template <typename ACC>
+  RowAccessor(const ACC& acc, const legate::Rect<DIM>& rect)
+  {
+    base_ = acc.ptr(rect, strides_);
+  }
+  __CUDA_HD__
+  inline RowView<T> operator[](const legate::Point<DIM>& offset) const
+  {
+    size_t index = 0;
+    for (int d = 0; d < DIM; ++d) index += offset[d] * strides_[d];
+    return RowView<T>(base_ + index, strides_[DIM - 1]);
+  }
+  // Address of the element at the given offset
+  __CUDA_HD__
+  inline T* ptr(const legate::Point<DIM>& offset) const
+  {
+    size_t index = 0;
+    for (int d = 0; d < DIM; ++d) index += offset[d] * strides_[d];
+    return base_ + index;
+  }
+  __CUDA_HD__
+  inline size_t stride(int dim) const { return strides_[dim]; }
+
+ private:
+  T* base_;
+  size_t strides_[DIM];
+};
+
+}  // namespace cunumeric
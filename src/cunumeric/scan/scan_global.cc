@@ -13,12 +13,10 @@
  * limitations under the License.
  *
  */
-
 #include "cunumeric/scan/scan_global.h"
 #include "cunumeric/scan/scan_global_template.inl"
 
-#include <thrust/reduce.h>
-#include <thrust/execution_policy.h>
+#include <vector>
 
 namespace cunumeric {
 
@@ -30,39 +28,18 @@ struct ScanGlobalImplBody<VariantKind::CPU, OP_CODE, CODE, DIM> {
   using VAL = legate_type_of<CODE>;
 
   void operator()(OP func,
-                  const AccessorRW<VAL, DIM>& out,
+                  const RowAccessor<VAL, DIM>& out,
                   const AccessorRO<VAL, DIM>& sum_vals,
-                  const Pitches<DIM - 1>& out_pitches,
-                  const Rect<DIM>& out_rect,
-                  const Pitches<DIM - 1>& sum_vals_pitches,
-                  const Rect<DIM>& sum_vals_rect,
-                  const DomainPoint& partition_index) const
+                  const ScanLines<DIM>& lines,
+                  size_t num_lines,
+                  const Rect<DIM>& rect,
+                  coord_t color) const
   {
-    auto outptr = out.ptr(out_rect.lo);
-    auto volume = out_rect.volume();
-
-    if (partition_index[DIM - 1] == 0) {
-      // first partition has nothing to do and can return;
-      return;
-    }
-
-    auto stride = out_rect.hi[DIM - 1] - out_rect.lo[DIM - 1] + 1;
-    for (uint64_t index = 0; index < volume; index += stride) {
-      // get the corresponding ND index to use for sum_val
-      auto sum_valsp = out_pitches.unflatten(index, out_rect.lo);
-      // first element on scan axis
-      sum_valsp[DIM - 1]     = 0;
-      auto sum_valsp_end     = sum_valsp;
-      sum_valsp_end[DIM - 1] = partition_index[DIM - 1];
-      auto global_prefix     = thrust::reduce(thrust::host,
-                                          &sum_vals[sum_valsp],
-                                          &sum_vals[sum_valsp_end],
-                                          (VAL)ScanOp<OP_CODE, CODE>::nan_identity,
-                                          func);
-      // apply global_prefix to out
-      for (uint64_t i = index; i < index + stride; i++) {
-        outptr[i] = func(outptr[i], global_prefix);
-      }
+    std::vector<VAL> prefix(lines.width);
+    for (size_t line = 0; line < num_lines; line += lines.width) {
+      auto offset = lines.line_offset(line);
+      scan_prefixes(func, sum_vals, lines, rect.lo + offset, color, prefix.data(), lines.width);
+      apply_prefixes(func, out, lines, offset, prefix.data(), lines.width);
     }
   }
 };
@@ -13,12 +13,9 @@
  * limitations under the License.
  *
  */
-
 #include "cunumeric/scan/scan_global.h"
 #include "cunumeric/scan/scan_global_template.inl"
-#include "cunumeric/utilities/thrust_util.h"
-
-#include <thrust/reduce.h>
+#include "cunumeric/pitches.h"
 
 #include "cunumeric/cuda_help.h"
 
@@ -26,13 +23,44 @@ namespace cunumeric {
 
 using namespace legate;
 
-template <typename Function, typename RES>
+// Combines the sums of the pieces before this one along the scan axis into
+// one prefix per line, starting from the sums of the first piece
+template <typename Function, typename VAL, int DIM>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  prefix_kernel(Function func,
+                const AccessorRO<VAL, DIM> sum_vals,
+                const ScanLines<DIM> lines,
+                size_t num_lines,
+                const Point<DIM> lo,
+                coord_t color,
+                VAL* prefix)
+{
+  const size_t line = global_tid_1d();
+  if (line >= num_lines) return;
+  auto point        = lo + lines.line_offset(line);
+  point[lines.axis] = 0;
+  VAL acc           = sum_vals[point];
+  for (coord_t c = 1; c < color; ++c) {
+    point[lines.axis] = c;
+    acc               = func(acc, sum_vals[point]);
+  }
+  prefix[line] = acc;
+}
+
+template <typename Function, typename VAL, int DIM>
 static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
-  scalar_kernel(uint64_t volume, Function func, RES* out, RES scalar)
+  apply_kernel(Function func,
+               const RowAccessor<VAL, DIM> out,
+               const ScanLines<DIM> lines,
+               const Pitches<DIM - 1> pitches,
+               size_t volume,
+               const VAL* prefix)
 {
-  const size_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+  const size_t idx = global_tid_1d();
   if (idx >= volume) return;
-  out[idx] = func(out[idx], scalar);
+  auto offset = pitches.unflatten(idx, Point<DIM>::ZEROES());
+  VAL* outp   = out.ptr(offset);
+  *outp       = func(*outp, prefix[lines.line_of(offset)]);
 }
 
 template <ScanCode OP_CODE, Type::Code CODE, int DIM>
@@ -41,42 +69,25 @@ struct ScanGlobalImplBody<VariantKind::GPU, OP_CODE, CODE, DIM> {
   using VAL = legate_type_of<CODE>;
 
   void operator()(OP func,
-                  const AccessorRW<VAL, DIM>& out,
+                  const RowAccessor<VAL, DIM>& out,
                   const AccessorRO<VAL, DIM>& sum_vals,
-                  const Pitches<DIM - 1>& out_pitches,
-                  const Rect<DIM>& out_rect,
-                  const Pitches<DIM - 1>& sum_vals_pitches,
-                  const Rect<DIM>& sum_vals_rect,
-                  const DomainPoint& partition_index) const
+                  const ScanLines<DIM>& lines,
+                  size_t num_lines,
+                  const Rect<DIM>& rect,
+                  coord_t color) const
   {
-    auto outptr = out.ptr(out_rect.lo);
-    auto volume = out_rect.volume();
-
-    if (partition_index[DIM - 1] == 0) {
-      // first partition has nothing to do and can return;
-      return;
-    }
-
     auto stream = get_cached_stream();
 
-    auto stride         = out_rect.hi[DIM - 1] - out_rect.lo[DIM - 1] + 1;
-    const size_t blocks = (stride + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
-    for (uint64_t index = 0; index < volume; index += stride) {
-      // get the corresponding ND index to use for sum_val
-      auto sum_valsp = out_pitches.unflatten(index, out_rect.lo);
-      // first element on scan axis
-      sum_valsp[DIM - 1]     = 0;
-      auto sum_valsp_end     = sum_valsp;
-      sum_valsp_end[DIM - 1] = partition_index[DIM - 1];
-      auto global_prefix     = thrust::reduce(DEFAULT_POLICY.on(stream),
-                                          &sum_vals[sum_valsp],
-                                          &sum_vals[sum_valsp_end],
-                                          (VAL)ScanOp<OP_CODE, CODE>::nan_identity,
-                                          func);
-      // apply global_prefix to out
-      scalar_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
-        stride, func, &outptr[index], global_prefix);
-    }
+    auto prefix         = create_buffer<VAL>(num_lines);
+    const size_t blocks = (num_lines + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+    prefix_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+      func, sum_vals, lines, num_lines, rect.lo, color, prefix.ptr(0));
+
+    Pitches<DIM - 1> pitches;
+    const size_t volume     = pitches.flatten(rect);
+    const size_t num_blocks = (volume + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+    apply_kernel<<<num_blocks, THREADS_PER_BLOCK, 0, stream>>>(
+      func, out, lines, pitches, volume, prefix.ptr(0));
     CHECK_CUDA_STREAM(stream);
   }
 };
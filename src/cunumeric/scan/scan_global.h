@@ -16,7 +16,7 @@
 
 #pragma once
 
-#include "cunumeric/scan/scan_global_util.h"
+#include "cunumeric/scan/scan_util.h"
 #include "cunumeric/cunumeric.h"
 
 namespace cunumeric {
@@ -25,6 +25,7 @@ struct ScanGlobalArgs {
   const Array& sum_vals;
   const Array& out;
   ScanCode op_code;
+  int32_t axis;
   const legate::DomainPoint& partition_index;
 };
 
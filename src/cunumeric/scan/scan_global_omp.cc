@@ -13,14 +13,11 @@
  * limitations under the License.
  *
  */
-
 #include "cunumeric/scan/scan_global.h"
 #include "cunumeric/scan/scan_global_template.inl"
 
-#include <thrust/reduce.h>
-#include <thrust/execution_policy.h>
-#include <thrust/system/omp/execution_policy.h>
 #include <omp.h>
+#include <vector>
 
 namespace cunumeric {
 
@@ -32,39 +29,49 @@ struct ScanGlobalImplBody<VariantKind::OMP, OP_CODE, CODE, DIM> {
   using VAL = legate_type_of<CODE>;
 
   void operator()(OP func,
-                  const AccessorRW<VAL, DIM>& out,
+                  const RowAccessor<VAL, DIM>& out,
                   const AccessorRO<VAL, DIM>& sum_vals,
-                  const Pitches<DIM - 1>& out_pitches,
-                  const Rect<DIM>& out_rect,
-                  const Pitches<DIM - 1>& sum_vals_pitches,
-                  const Rect<DIM>& sum_vals_rect,
-                  const DomainPoint& partition_index) const
+                  const ScanLines<DIM>& lines,
+                  size_t num_lines,
+                  const Rect<DIM>& rect,
+                  coord_t color) const
   {
-    auto outptr = out.ptr(out_rect.lo);
-    auto volume = out_rect.volume();
+    const size_t num_threads = omp_get_max_threads();
 
-    if (partition_index[DIM - 1] == 0) {
-      // first partition has nothing to do and can return;
+    // Few long lines are updated a row at a time. The row is split along the
+    // axis into one block per thread, after its prefixes are computed.
+    if (scan_within_lines(lines, num_lines, num_threads)) {
+      const size_t block      = scan_block_size(lines, num_threads);
+      const size_t num_blocks = (lines.length + block - 1) / block;
+      std::vector<VAL> prefix(lines.width);
+      for (size_t line = 0; line < num_lines; line += lines.width) {
+        auto offset = lines.line_offset(line);
+        scan_prefixes(func, sum_vals, lines, rect.lo + offset, color, prefix.data(), lines.width);
+#pragma omp parallel for schedule(static)
+        for (size_t b = 0; b < num_blocks; ++b) {
+          const size_t last = std::min(lines.length, (b + 1) * block);
+          apply_prefixes(func, out, lines, offset, prefix.data(), lines.width, b * block, last);
+        }
+      }
       return;
     }
 
-    auto stride = out_rect.hi[DIM - 1] - out_rect.lo[DIM - 1] + 1;
-    for (uint64_t index = 0; index < volume; index += stride) {
-      // get the corresponding ND index to use for sum_val
-      auto sum_valsp = out_pitches.unflatten(index, out_rect.lo);
-      // first element on scan axis
-      sum_valsp[DIM - 1]     = 0;
-      auto sum_valsp_end     = sum_valsp;
-      sum_valsp_end[DIM - 1] = partition_index[DIM - 1];
-      auto global_prefix     = thrust::reduce(thrust::omp::par,
-                                          &sum_vals[sum_valsp],
-                                          &sum_vals[sum_valsp_end],
-                                          (VAL)ScanOp<OP_CODE, CODE>::nan_identity,
-                                          func);
-      // apply global_prefix to out
-#pragma omp parallel for schedule(static)
-      for (uint64_t i = index; i < index + stride; i++) {
-        outptr[i] = func(outptr[i], global_prefix);
+    // Otherwise each thread updates whole lines, in chunks of adjacent lines
+    // that are updated together
+    const size_t chunk      = lines.chunk_size(num_lines, num_threads);
+    const size_t per_row    = (lines.width + chunk - 1) / chunk;
+    const size_t num_chunks = num_lines / lines.width * per_row;
+#pragma omp parallel
+    {
+      std::vector<VAL> prefix(chunk);
+#pragma omp for schedule(static)
+      for (size_t idx = 0; idx < num_chunks; ++idx) {
+        const size_t first = (idx % per_row) * chunk;
+        const size_t line  = idx / per_row * lines.width + first;
+        const size_t count = std::min(chunk, lines.width - first);
+        auto offset        = lines.line_offset(line);
+        scan_prefixes(func, sum_vals, lines, rect.lo + offset, color, prefix.data(), count);
+        apply_prefixes(func, out, lines, offset, prefix.data(), count);
       }
     }
   }
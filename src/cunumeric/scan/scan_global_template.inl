@@ -14,8 +14,8 @@
  *
  */
 
-#include "cunumeric/scan/scan_global_util.h"
-#include "cunumeric/pitches.h"
+#include "cunumeric/scan/scan_util.h"
+#include "cunumeric/scan/scan_lines.h"
 
 namespace cunumeric {
 
@@ -26,34 +26,36 @@ struct ScanGlobalImplBody;
 
 template <VariantKind KIND, ScanCode OP_CODE>
 struct ScanGlobalImpl {
-  template <Type::Code CODE, int DIM>
+  template <Type::Code CODE, int DIM, std::enable_if_t<ScanOp<OP_CODE, CODE>::valid>* = nullptr>
   void operator()(ScanGlobalArgs& args) const
   {
     using OP  = ScanOp<OP_CODE, CODE>;
     using VAL = legate_type_of<CODE>;
 
+    // first partition along the scan axis has nothing to do and can return
+    const coord_t color = args.partition_index[args.axis];
+    if (color == 0) return;
+
     auto out_rect      = args.out.shape<DIM>();
     auto sum_vals_rect = args.sum_vals.shape<DIM>();
 
-    Pitches<DIM - 1> out_pitches;
-    size_t volume = out_pitches.flatten(out_rect);
-    Pitches<DIM - 1> sum_vals_pitches;
-    size_t sum_vals_volume = sum_vals_pitches.flatten(sum_vals_rect);
+    ScanLines<DIM> lines;
+    size_t num_lines = lines.flatten(out_rect, args.axis);
 
-    if (volume == 0) return;
+    if (num_lines == 0) return;
 
-    auto out      = args.out.read_write_accessor<VAL, DIM>(out_rect);
+    RowAccessor<VAL, DIM> out(args.out.read_write_accessor<VAL, DIM>(out_rect), out_rect);
     auto sum_vals = args.sum_vals.read_accessor<VAL, DIM>(sum_vals_rect);
 
     OP func;
-    ScanGlobalImplBody<KIND, OP_CODE, CODE, DIM>()(func,
-                                                   out,
-                                                   sum_vals,
-                                                   out_pitches,
-                                                   out_rect,
-                                                   sum_vals_pitches,
-                                                   sum_vals_rect,
-                                                   args.partition_index);
+    ScanGlobalImplBody<KIND, OP_CODE, CODE, DIM>()(
+      func, out, sum_vals, lines, num_lines, out_rect, color);
+  }
+
+  template <Type::Code CODE, int DIM, std::enable_if_t<!ScanOp<OP_CODE, CODE>::valid>* = nullptr>
+  void operator()(ScanGlobalArgs& args) const
+  {
+    assert(false);
   }
 };
 
@@ -70,8 +72,11 @@ template <VariantKind KIND>
 static void scan_global_template(TaskContext& context)
 {
   auto task_index = context.get_task_index();
-  ScanGlobalArgs args{
-    context.inputs()[1], context.outputs()[0], context.scalars()[0].value<ScanCode>(), task_index};
+  ScanGlobalArgs args{context.inputs()[1],
+                      context.outputs()[0],
+                      context.scalars()[0].value<ScanCode>(),
+                      context.scalars()[1].value<int32_t>(),
+                      task_index};
   op_dispatch(args.op_code, ScanGlobalDispatch<KIND>{}, args);
 }
 
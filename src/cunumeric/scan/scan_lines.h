@@ -0,0 +1,256 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cunumeric/cunumeric.h"
+#include "cunumeric/row_pitches.h"
+
+#include <algorithm>
+
+namespace cunumeric {
+
+// Decomposition of a rectangle into lines along the scan axis, which are
+// enumerated over all other dimensions in C order. Unless the scan axis is
+// the last dimension, consecutive lines are adjacent along the last
+// dimension, and rows of `width` of them are scanned together one step along
+// the axis at a time, so that the running values of many lines are carried
+// by a single loop over the last dimension. No particular layout is assumed.
+template <int DIM>
+class ScanLines {
+ public:
+  // Returns the number of lines in the rectangle
+  __CUDA_HD__
+  inline size_t flatten(const legate::Rect<DIM>& rect, int32_t scan_axis)
+  {
+    axis             = scan_axis;
+    size_t num_lines = 1;
+    for (int d = DIM - 1; d >= 0; --d) {
+      // Quick exit for empty rectangle dimensions
+      if (rect.lo[d] > rect.hi[d]) return 0;
+      const size_t diff = rect.hi[d] - rect.lo[d] + 1;
+      if (d == axis) {
+        length     = diff;
+        pitches[d] = 0;
+      } else {
+        pitches[d] = num_lines;
+        num_lines *= diff;
+      }
+    }
+    width = axis == DIM - 1 ? 1 : rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
+    return num_lines;
+  }
+  // Offset of the first element of a line from the lower bound of the rectangle
+  __CUDA_HD__
+  inline legate::Point<DIM> line_offset(size_t line) const
+  {
+    legate::Point<DIM> offset;
+    for (int d = 0; d < DIM; ++d) {
+      if (d == axis) {
+        offset[d] = 0;
+        continue;
+      }
+      offset[d] = line / pitches[d];
+      line      = line % pitches[d];
+    }
+    return offset;
+  }
+  // Index of the line through the element at the given offset
+  __CUDA_HD__
+  inline size_t line_of(const legate::Point<DIM>& offset) const
+  {
+    size_t line = 0;
+    for (int d = 0; d < DIM; ++d) line += offset[d] * pitches[d];
+    return line;
+  }
+  // Splits every row of lines into chunks of adjacent lines, so that there
+  // are at least min_chunks of them overall where possible. Returns the
+  // number of lines in a chunk.
+  inline size_t chunk_size(size_t num_lines, size_t min_chunks) const
+  {
+    const size_t num_rows = num_lines / width;
+    const size_t per_row  = (min_chunks + num_rows - 1) / num_rows;
+    const size_t chunks   = std::min(width, std::max<size_t>(1, per_row));
+    return (width + chunks - 1) / chunks;
+  }
+
+ public:
+  int32_t axis;
+  // Number of elements in a line
+  size_t length;
+  // Number of lines in a row
+  size_t width;
+
+ private:
+  size_t pitches[DIM];
+};
+
+// Lines shorter than this are always scanned by a single thread each, as the
+// overhead of a parallel region outweighs the work in the line
+constexpr size_t SCAN_MIN_PARALLEL_LENGTH = 1 << 14;
+
+// Returns true if threads should cooperate on each line rather than scan
+// separate lines. This pays off for long lines that are too few to keep all
+// threads busy, whatever the scan axis and the layout.
+template <int DIM>
+inline bool scan_within_lines(const ScanLines<DIM>& lines, size_t num_lines, size_t num_threads)
+{
+  return num_lines < num_threads && lines.length >= SCAN_MIN_PARALLEL_LENGTH;
+}
+
+// Splits lines into at most num_blocks blocks of the same number of steps
+// along the axis, and returns that number
+template <int DIM>
+inline size_t scan_block_size(const ScanLines<DIM>& lines, size_t num_blocks)
+{
+  return (lines.length + num_blocks - 1) / num_blocks;
+}
+
+// Scans `count` adjacent lines from the given offset over the steps
+// [first, last) along the axis, starting afresh at step first. LOAD converts
+// the input values, e.g. to replace NaNs.
+template <typename OP, typename LOAD, typename VAL, int DIM>
+void scan_steps(OP func,
+                LOAD load,
+                const RowAccessor<VAL, DIM>& out,
+                const RowAccessor<const VAL, DIM>& in,
+                const ScanLines<DIM>& lines,
+                const legate::Point<DIM>& offset,
+                size_t count,
+                size_t first,
+                size_t last)
+{
+  const size_t out_step = out.stride(lines.axis);
+  const size_t in_step  = in.stride(lines.axis);
+  VAL* outp             = out.ptr(offset) + first * out_step;
+  const VAL* inp        = in.ptr(offset) + first * in_step;
+
+  auto scan = [&](size_t out_col, size_t in_col) {
+    for (size_t j = 0; j < count; ++j) outp[j * out_col] = load(inp[j * in_col]);
+    for (size_t k = 1; k < last - first; ++k) {
+      VAL* cur        = outp + k * out_step;
+      const VAL* prev = cur - out_step;
+      const VAL* src  = inp + k * in_step;
+      for (size_t j = 0; j < count; ++j)
+        cur[j * out_col] = func(prev[j * out_col], load(src[j * in_col]));
+    }
+  };
+  // Unit strides are spelled out so that the compiler can vectorize
+  const size_t out_col = out.stride(DIM - 1);
+  const size_t in_col  = in.stride(DIM - 1);
+  if (out_col == 1 && in_col == 1)
+    scan(1, 1);
+  else
+    scan(out_col, in_col);
+}
+
+// Writes the last values of `count` adjacent lines from the given offset to
+// sums
+template <typename VAL, int DIM>
+void write_sums(const RowAccessor<VAL, DIM>& out,
+                const legate::Buffer<VAL, DIM>& sums,
+                const ScanLines<DIM>& lines,
+                const legate::Point<DIM>& offset,
+                size_t count)
+{
+  const VAL* last  = out.ptr(offset) + (lines.length - 1) * out.stride(lines.axis);
+  const size_t col = out.stride(DIM - 1);
+  for (size_t j = 0; j < count; ++j) {
+    auto point = offset;
+    point[DIM - 1] += j;
+    sums[point] = last[j * col];
+  }
+}
+
+// Scans `count` adjacent lines from the given offset and writes their last
+// values to sums
+template <typename OP, typename LOAD, typename VAL, int DIM>
+void scan_lines(OP func,
+                LOAD load,
+                const RowAccessor<VAL, DIM>& out,
+                const RowAccessor<const VAL, DIM>& in,
+                const legate::Buffer<VAL, DIM>& sums,
+                const ScanLines<DIM>& lines,
+                const legate::Point<DIM>& offset,
+                size_t count)
+{
+  scan_steps(func, load, out, in, lines, offset, count, 0, lines.length);
+  write_sums(out, sums, lines, offset, count);
+}
+
+// Combines the sums of the pieces before the given color along the scan axis
+// into the prefixes of `count` adjacent lines from the given point. The color
+// is at least one, so the prefixes start from the sums of the first piece.
+template <typename OP, typename VAL, int DIM>
+void scan_prefixes(OP func,
+                   const legate::AccessorRO<VAL, DIM>& sums,
+                   const ScanLines<DIM>& lines,
+                   legate::Point<DIM> point,
+                   coord_t color,
+                   VAL* prefix,
+                   size_t count)
+{
+  for (coord_t c = 0; c < color; ++c) {
+    point[lines.axis] = c;
+    for (size_t j = 0; j < count; ++j) {
+      auto p = point;
+      p[DIM - 1] += j;
+      prefix[j] = c == 0 ? sums[p] : func(prefix[j], sums[p]);
+    }
+  }
+}
+
+// Folds the prefixes into `count` adjacent lines from the given offset, over
+// the steps [first, last) along the axis
+template <typename OP, typename VAL, int DIM>
+void apply_prefixes(OP func,
+                    const RowAccessor<VAL, DIM>& out,
+                    const ScanLines<DIM>& lines,
+                    const legate::Point<DIM>& offset,
+                    const VAL* prefix,
+                    size_t count,
+                    size_t first,
+                    size_t last)
+{
+  VAL* outp         = out.ptr(offset);
+  const size_t step = out.stride(lines.axis);
+
+  auto apply = [&](size_t col) {
+    for (size_t k = first; k < last; ++k) {
+      VAL* cur = outp + k * step;
+      for (size_t j = 0; j < count; ++j) cur[j * col] = func(cur[j * col], prefix[j]);
+    }
+  };
+  const size_t col = out.stride(DIM - 1);
+  if (col == 1)
+    apply(1);
+  else
+    apply(col);
+}
+
+// Folds the prefixes into `count` adjacent lines from the given offset
+template <typename OP, typename VAL, int DIM>
+void apply_prefixes(OP func,
+                    const RowAccessor<VAL, DIM>& out,
+                    const ScanLines<DIM>& lines,
+                    const legate::Point<DIM>& offset,
+                    const VAL* prefix,
+                    size_t count)
+{
+  apply_prefixes(func, out, lines, offset, prefix, count, 0, lines.length);
+}
+
+}  // namespace cunumeric
@@ -13,14 +13,8 @@
  * limitations under the License.
  *
  */
-
 #include "cunumeric/scan/scan_local.h"
 #include "cunumeric/scan/scan_local_template.inl"
-#include "cunumeric/unary/isnan.h"
-
-#include <thrust/scan.h>
-#include <thrust/execution_policy.h>
-#include <thrust/iterator/transform_iterator.h>
 
 namespace cunumeric {
 
@@ -31,81 +25,17 @@ struct ScanLocalImplBody<VariantKind::CPU, OP_CODE, CODE, DIM> {
   using OP  = ScanOp<OP_CODE, CODE>;
   using VAL = legate_type_of<CODE>;
 
+  template <typename LOAD>
   void operator()(OP func,
-                  const AccessorWO<VAL, DIM>& out,
-                  const AccessorRO<VAL, DIM>& in,
-                  Array& sum_vals,
-                  const Pitches<DIM - 1>& pitches,
-                  const Rect<DIM>& rect) const
-  {
-    auto outptr = out.ptr(rect.lo);
-    auto inptr  = in.ptr(rect.lo);
-    auto volume = rect.volume();
-
-    auto stride = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
-
-    Point<DIM> extents = rect.hi - rect.lo + Point<DIM>::ONES();
-    extents[DIM - 1]   = 1;  // one element along scan axis
-
-    auto sum_valsptr = sum_vals.create_output_buffer<VAL, DIM>(extents, true);
-
-    for (uint64_t index = 0; index < volume; index += stride) {
-      thrust::inclusive_scan(
-        thrust::host, inptr + index, inptr + index + stride, outptr + index, func);
-      // get the corresponding ND index with base zero to use for sum_val
-      auto sum_valp = pitches.unflatten(index, Point<DIM>::ZEROES());
-      // only one element on scan axis
-      sum_valp[DIM - 1] = 0;
-      // write out the partition sum
-      sum_valsptr[sum_valp] = outptr[index + stride - 1];
-    }
-  }
-};
-
-template <ScanCode OP_CODE, Type::Code CODE, int DIM>
-struct ScanLocalNanImplBody<VariantKind::CPU, OP_CODE, CODE, DIM> {
-  using OP  = ScanOp<OP_CODE, CODE>;
-  using VAL = legate_type_of<CODE>;
-
-  struct convert_nan_func {
-    VAL operator()(VAL x) const
-    {
-      return cunumeric::is_nan(x) ? (VAL)ScanOp<OP_CODE, CODE>::nan_identity : x;
-    }
-  };
-
-  void operator()(OP func,
-                  const AccessorWO<VAL, DIM>& out,
-                  const AccessorRO<VAL, DIM>& in,
-                  Array& sum_vals,
-                  const Pitches<DIM - 1>& pitches,
-                  const Rect<DIM>& rect) const
+                  LOAD load,
+                  const RowAccessor<VAL, DIM>& out,
+                  const RowAccessor<const VAL, DIM>& in,
+                  const Buffer<VAL, DIM>& sum_vals,
+                  const ScanLines<DIM>& lines,
+                  size_t num_lines) const
   {
-    auto outptr = out.ptr(rect.lo);
-    auto inptr  = in.ptr(rect.lo);
-    auto volume = rect.volume();
-
-    auto stride = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
-
-    Point<DIM> extents = rect.hi - rect.lo + Point<DIM>::ONES();
-    extents[DIM - 1]   = 1;  // one element along scan axis
-
-    auto sum_valsptr = sum_vals.create_output_buffer<VAL, DIM>(extents, true);
-
-    for (uint64_t index = 0; index < volume; index += stride) {
-      thrust::inclusive_scan(
-        thrust::host,
-        thrust::make_transform_iterator(inptr + index, convert_nan_func()),
-        thrust::make_transform_iterator(inptr + index + stride, convert_nan_func()),
-        outptr + index,
-        func);
-      // get the corresponding ND index with base zero to use for sum_val
-      auto sum_valp = pitches.unflatten(index, Point<DIM>::ZEROES());
-      // only one element on scan axis
-      sum_valp[DIM - 1] = 0;
-      // write out the partition sum
-      sum_valsptr[sum_valp] = outptr[index + stride - 1];
-    }
+    for (size_t line = 0; line < num_lines; line += lines.width)
+      scan_lines(func, load, out, in, sum_vals, lines, lines.line_offset(line), lines.width);
   }
 };
 
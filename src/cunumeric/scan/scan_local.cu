@@ -13,10 +13,8 @@
  * limitations under the License.
  *
  */
-
 #include "cunumeric/scan/scan_local.h"
 #include "cunumeric/scan/scan_local_template.inl"
-#include "cunumeric/unary/isnan.h"
 #include "cunumeric/utilities/thrust_util.h"
 
 #include <thrust/scan.h>
@@ -37,92 +35,174 @@ static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
   sum_val[0] = out[0];
 }
 
-template <ScanCode OP_CODE, Type::Code CODE, int DIM>
-struct ScanLocalImplBody<VariantKind::GPU, OP_CODE, CODE, DIM> {
-  using OP  = ScanOp<OP_CODE, CODE>;
-  using VAL = legate_type_of<CODE>;
-
-  void operator()(OP func,
-                  const AccessorWO<VAL, DIM>& out,
-                  const AccessorRO<VAL, DIM>& in,
-                  Array& sum_vals,
-                  const Pitches<DIM - 1>& pitches,
-                  const Rect<DIM>& rect) const
-  {
-    auto outptr = out.ptr(rect.lo);
-    auto inptr  = in.ptr(rect.lo);
-    auto volume = rect.volume();
+// Each thread scans one line, and consecutive threads scan adjacent lines,
+// so that their accesses are coalesced unless the scan axis is the last
+// dimension
+template <typename OP, typename LOAD, typename VAL, int DIM>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  scan_lines_kernel(OP func,
+                    LOAD load,
+                    const RowAccessor<VAL, DIM> out,
+                    const RowAccessor<const VAL, DIM> in,
+                    const Buffer<VAL, DIM> sum_vals,
+                    const ScanLines<DIM> lines,
+                    size_t num_lines)
+{
+  const size_t line = global_tid_1d();
+  if (line >= num_lines) return;
+  auto offset           = lines.line_offset(line);
+  VAL* outp             = out.ptr(offset);
+  const VAL* inp        = in.ptr(offset);
+  const size_t out_step = out.stride(lines.axis);
+  const size_t in_step  = in.stride(lines.axis);
+
+  VAL acc = load(inp[0]);
+  outp[0] = acc;
+  for (size_t k = 1; k < lines.length; ++k) {
+    acc                = func(acc, load(inp[k * in_step]));
+    outp[k * out_step] = acc;
+  }
+  sum_vals[offset] = acc;
+}
 
-    auto stride = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
+// With fewer lines than this, one thread per line leaves most of the device
+// idle, so lines are also split along the axis into blocks
+constexpr size_t SCAN_MIN_DEVICE_LINES = 1 << 14;
+// Number of threads that lines are split over in that case
+constexpr size_t SCAN_BLOCK_THREADS = 1 << 16;
 
-    auto stream = get_cached_stream();
+// Scans blocks of `block` steps of the lines independently and writes the
+// total of each block. Consecutive threads take the same block of adjacent
+// lines.
+template <typename OP, typename LOAD, typename VAL, int DIM>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  scan_blocks_kernel(OP func,
+                     LOAD load,
+                     const RowAccessor<VAL, DIM> out,
+                     const RowAccessor<const VAL, DIM> in,
+                     VAL* totals,
+                     const ScanLines<DIM> lines,
+                     size_t num_lines,
+                     size_t block,
+                     size_t num_blocks)
+{
+  const size_t idx = global_tid_1d();
+  if (idx >= num_lines * num_blocks) return;
+  auto offset           = lines.line_offset(idx % num_lines);
+  const size_t first    = idx / num_lines * block;
+  const size_t end      = first + block;
+  const size_t last     = end < lines.length ? end : lines.length;
+  VAL* outp             = out.ptr(offset);
+  const VAL* inp        = in.ptr(offset);
+  const size_t out_step = out.stride(lines.axis);
+  const size_t in_step  = in.stride(lines.axis);
+
+  VAL acc                = load(inp[first * in_step]);
+  outp[first * out_step] = acc;
+  for (size_t k = first + 1; k < last; ++k) {
+    acc                = func(acc, load(inp[k * in_step]));
+    outp[k * out_step] = acc;
+  }
+  totals[idx] = acc;
+}
 
-    Point<DIM> extents = rect.hi - rect.lo + Point<DIM>::ONES();
-    extents[DIM - 1]   = 1;  // one element along scan axis
-
-    auto sum_valsptr = sum_vals.create_output_buffer<VAL, DIM>(extents, true);
-
-    for (uint64_t index = 0; index < volume; index += stride) {
-      thrust::inclusive_scan(
-        DEFAULT_POLICY.on(stream), inptr + index, inptr + index + stride, outptr + index, func);
-      // get the corresponding ND index with base zero to use for sum_val
-      auto sum_valp = pitches.unflatten(index, Point<DIM>::ZEROES());
-      // only one element on scan axis
-      sum_valp[DIM - 1] = 0;
-      // write out the partition sum
-      lazy_kernel<<<1, THREADS_PER_BLOCK, 0, stream>>>(&outptr[index + stride - 1],
-                                                       &sum_valsptr[sum_valp]);
-    }
-    CHECK_CUDA_STREAM(stream);
+// Scans the block totals of each line in place and writes the sum of the line
+template <typename OP, typename VAL, int DIM>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  scan_totals_kernel(OP func,
+                     VAL* totals,
+                     const Buffer<VAL, DIM> sum_vals,
+                     const ScanLines<DIM> lines,
+                     size_t num_lines,
+                     size_t num_blocks)
+{
+  const size_t line = global_tid_1d();
+  if (line >= num_lines) return;
+  VAL acc = totals[line];
+  for (size_t b = 1; b < num_blocks; ++b) {
+    acc                          = func(acc, totals[b * num_lines + line]);
+    totals[b * num_lines + line] = acc;
   }
-};
+  sum_vals[lines.line_offset(line)] = acc;
+}
+
+// Folds the running values at the end of the blocks before each block but
+// the first into it
+template <typename OP, typename VAL, int DIM>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  apply_totals_kernel(OP func,
+                      const RowAccessor<VAL, DIM> out,
+                      const VAL* totals,
+                      const ScanLines<DIM> lines,
+                      size_t num_lines,
+                      size_t block,
+                      size_t num_blocks)
+{
+  const size_t idx = global_tid_1d() + num_lines;
+  if (idx >= num_lines * num_blocks) return;
+  auto offset        = lines.line_offset(idx % num_lines);
+  const size_t first = idx / num_lines * block;
+  const size_t end   = first + block;
+  const size_t last  = end < lines.length ? end : lines.length;
+  VAL* outp          = out.ptr(offset);
+  const size_t step  = out.stride(lines.axis);
+  const VAL prefix   = totals[idx - num_lines];
+  for (size_t k = first; k < last; ++k) outp[k * step] = func(outp[k * step], prefix);
+}
 
 template <ScanCode OP_CODE, Type::Code CODE, int DIM>
-struct ScanLocalNanImplBody<VariantKind::GPU, OP_CODE, CODE, DIM> {
+struct ScanLocalImplBody<VariantKind::GPU, OP_CODE, CODE, DIM> {
   using OP  = ScanOp<OP_CODE, CODE>;
   using VAL = legate_type_of<CODE>;
 
-  struct convert_nan_func {
-    __device__ VAL operator()(VAL x)
-    {
-      return cunumeric::is_nan(x) ? (VAL)ScanOp<OP_CODE, CODE>::nan_identity : x;
-    }
-  };
-
+  template <typename LOAD>
   void operator()(OP func,
-                  const AccessorWO<VAL, DIM>& out,
-                  const AccessorRO<VAL, DIM>& in,
-                  Array& sum_vals,
-                  const Pitches<DIM - 1>& pitches,
-                  const Rect<DIM>& rect) const
+                  LOAD load,
+                  const RowAccessor<VAL, DIM>& out,
+                  const RowAccessor<const VAL, DIM>& in,
+                  const Buffer<VAL, DIM>& sum_vals,
+                  const ScanLines<DIM>& lines,
+                  size_t num_lines) const
   {
-    auto outptr = out.ptr(rect.lo);
-    auto inptr  = in.ptr(rect.lo);
-    auto volume = rect.volume();
-
-    auto stride = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
-
     auto stream = get_cached_stream();
 
-    Point<DIM> extents = rect.hi - rect.lo + Point<DIM>::ONES();
-    extents[DIM - 1]   = 1;  // one element along scan axis
-
-    auto sum_valsptr = sum_vals.create_output_buffer<VAL, DIM>(extents, true);
-
-    for (uint64_t index = 0; index < volume; index += stride) {
-      thrust::inclusive_scan(
-        DEFAULT_POLICY.on(stream),
-        thrust::make_transform_iterator(inptr + index, convert_nan_func()),
-        thrust::make_transform_iterator(inptr + index + stride, convert_nan_func()),
-        outptr + index,
-        func);
-      // get the corresponding ND index with base zero to use for sum_val
-      auto sum_valp = pitches.unflatten(index, Point<DIM>::ZEROES());
-      // only one element on scan axis
-      sum_valp[DIM - 1] = 0;
-      // write out the partition sum
-      lazy_kernel<<<1, THREADS_PER_BLOCK, 0, stream>>>(&outptr[index + stride - 1],
-                                                       &sum_valsptr[sum_valp]);
+    // Contiguous lines along the last dimension are scanned one at a time,
+    // each by the whole device
+    if (lines.width == 1 && out.stride(lines.axis) == 1 && in.stride(lines.axis) == 1) {
+      for (size_t line = 0; line < num_lines; ++line) {
+        auto offset      = lines.line_offset(line);
+        VAL* outptr      = out.ptr(offset);
+        const VAL* inptr = in.ptr(offset);
+        thrust::inclusive_scan(DEFAULT_POLICY.on(stream),
+                               thrust::make_transform_iterator(inptr, load),
+                               thrust::make_transform_iterator(inptr + lines.length, load),
+                               outptr,
+                               func);
+        // write out the partition sum
+        lazy_kernel<<<1, THREADS_PER_BLOCK, 0, stream>>>(&outptr[lines.length - 1],
+                                                         &sum_vals[offset]);
+      }
+    } else if (num_lines < SCAN_MIN_DEVICE_LINES && lines.length > 1) {
+      // Few other lines are split along the axis into blocks, which are
+      // scanned independently before the totals of the blocks before them
+      // are folded in
+      const size_t per_line    = std::max<size_t>(1, SCAN_BLOCK_THREADS / num_lines);
+      const size_t block       = scan_block_size(lines, per_line);
+      const size_t num_blocks  = (lines.length + block - 1) / block;
+      const size_t volume      = num_lines * num_blocks;
+      auto totals              = create_buffer<VAL>(volume);
+      const size_t blocks      = (volume + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+      const size_t line_blocks = (num_lines + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+      scan_blocks_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+        func, load, out, in, totals.ptr(0), lines, num_lines, block, num_blocks);
+      scan_totals_kernel<<<line_blocks, THREADS_PER_BLOCK, 0, stream>>>(
+        func, totals.ptr(0), sum_vals, lines, num_lines, num_blocks);
+      apply_totals_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+        func, out, totals.ptr(0), lines, num_lines, block, num_blocks);
+    } else {
+      const size_t blocks = (num_lines + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+      scan_lines_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+        func, load, out, in, sum_vals, lines, num_lines);
     }
     CHECK_CUDA_STREAM(stream);
   }
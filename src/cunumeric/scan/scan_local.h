@@ -27,6 +27,7 @@ struct ScanLocalArgs {
   Array& sum_vals;
   ScanCode op_code;
   bool nan_to_identity;
+  int32_t axis;
 };
 
 class ScanLocalTask : public CuNumericTask<ScanLocalTask> {
@@ -13,16 +13,15 @@
  * limitations under the License.
  *
  */
-
 #include "cunumeric/scan/scan_local.h"
 #include "cunumeric/scan/scan_local_template.inl"
-#include "cunumeric/unary/isnan.h"
 
 #include <thrust/scan.h>
 #include <thrust/execution_policy.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/system/omp/execution_policy.h>
 #include <omp.h>
+#include <vector>
 
 namespace cunumeric {
 
@@ -33,80 +32,82 @@ struct ScanLocalImplBody<VariantKind::OMP, OP_CODE, CODE, DIM> {
   using OP  = ScanOp<OP_CODE, CODE>;
   using VAL = legate_type_of<CODE>;
 
+  template <typename LOAD>
   void operator()(OP func,
-                  const AccessorWO<VAL, DIM>& out,
-                  const AccessorRO<VAL, DIM>& in,
-                  Array& sum_vals,
-                  const Pitches<DIM - 1>& pitches,
-                  const Rect<DIM>& rect) const
+                  LOAD load,
+                  const RowAccessor<VAL, DIM>& out,
+                  const RowAccessor<const VAL, DIM>& in,
+                  const Buffer<VAL, DIM>& sum_vals,
+                  const ScanLines<DIM>& lines,
+                  size_t num_lines) const
   {
-    auto outptr = out.ptr(rect.lo);
-    auto inptr  = in.ptr(rect.lo);
-    auto volume = rect.volume();
-
-    auto stride = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
-
-    Point<DIM> extents = rect.hi - rect.lo + Point<DIM>::ONES();
-    extents[DIM - 1]   = 1;  // one element along scan axis
-
-    auto sum_valsptr = sum_vals.create_output_buffer<VAL, DIM>(extents, true);
-
-    for (uint64_t index = 0; index < volume; index += stride) {
-      thrust::inclusive_scan(
-        thrust::omp::par, inptr + index, inptr + index + stride, outptr + index, func);
-      // get the corresponding ND index with base zero to use for sum_val
-      auto sum_valp = pitches.unflatten(index, Point<DIM>::ZEROES());
-      // only one element on scan axis
-      sum_valp[DIM - 1] = 0;
-      // write out the partition sum
-      sum_valsptr[sum_valp] = outptr[index + stride - 1];
+    const size_t num_threads = omp_get_max_threads();
+
+    if (!scan_within_lines(lines, num_lines, num_threads)) {
+      // Each thread scans whole lines, in chunks of adjacent lines that are
+      // scanned together
+      const size_t chunk      = lines.chunk_size(num_lines, num_threads);
+      const size_t per_row    = (lines.width + chunk - 1) / chunk;
+      const size_t num_chunks = num_lines / lines.width * per_row;
+#pragma omp parallel for schedule(static)
+      for (size_t idx = 0; idx < num_chunks; ++idx) {
+        const size_t first = (idx % per_row) * chunk;
+        const size_t line  = idx / per_row * lines.width + first;
+        const size_t count = std::min(chunk, lines.width - first);
+        scan_lines(func, load, out, in, sum_vals, lines, lines.line_offset(line), count);
+      }
+      return;
     }
-  }
-};
 
-template <ScanCode OP_CODE, Type::Code CODE, int DIM>
-struct ScanLocalNanImplBody<VariantKind::OMP, OP_CODE, CODE, DIM> {
-  using OP  = ScanOp<OP_CODE, CODE>;
-  using VAL = legate_type_of<CODE>;
-
-  struct convert_nan_func {
-    VAL operator()(VAL x) const
-    {
-      return cunumeric::is_nan(x) ? (VAL)ScanOp<OP_CODE, CODE>::nan_identity : x;
+    // Few long contiguous lines along the last dimension are scanned one at a
+    // time, each by all threads
+    if (lines.width == 1 && out.stride(lines.axis) == 1 && in.stride(lines.axis) == 1) {
+      for (size_t line = 0; line < num_lines; ++line) {
+        auto offset      = lines.line_offset(line);
+        VAL* outptr      = out.ptr(offset);
+        const VAL* inptr = in.ptr(offset);
+        thrust::inclusive_scan(thrust::omp::par,
+                               thrust::make_transform_iterator(inptr, load),
+                               thrust::make_transform_iterator(inptr + lines.length, load),
+                               outptr,
+                               func);
+        // write out the partition sum
+        sum_vals[offset] = outptr[lines.length - 1];
+      }
+      return;
     }
-  };
-
-  void operator()(OP func,
-                  const AccessorWO<VAL, DIM>& out,
-                  const AccessorRO<VAL, DIM>& in,
-                  Array& sum_vals,
-                  const Pitches<DIM - 1>& pitches,
-                  const Rect<DIM>& rect) const
-  {
-    auto outptr = out.ptr(rect.lo);
-    auto inptr  = in.ptr(rect.lo);
-    auto volume = rect.volume();
-
-    auto stride = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
-
-    Point<DIM> extents = rect.hi - rect.lo + Point<DIM>::ONES();
-    extents[DIM - 1]   = 1;  // one element along scan axis
-
-    auto sum_valsptr = sum_vals.create_output_buffer<VAL, DIM>(extents, true);
 
-    for (uint64_t index = 0; index < volume; index += stride) {
-      thrust::inclusive_scan(
-        thrust::omp::par,
-        thrust::make_transform_iterator(inptr + index, convert_nan_func()),
-        thrust::make_transform_iterator(inptr + index + stride, convert_nan_func()),
-        outptr + index,
-        func);
-      // get the corresponding ND index with base zero to use for sum_val
-      auto sum_valp = pitches.unflatten(index, Point<DIM>::ZEROES());
-      // only one element on scan axis
-      sum_valp[DIM - 1] = 0;
-      // write out the partition sum
-      sum_valsptr[sum_valp] = outptr[index + stride - 1];
+    // Other few long lines are scanned a row at a time. The row is split
+    // along the axis into one block per thread, and the blocks are scanned
+    // independently. Every block but the first then folds in the running
+    // values at the end of the blocks before it.
+    const size_t block      = scan_block_size(lines, num_threads);
+    const size_t num_blocks = (lines.length + block - 1) / block;
+    const size_t step       = out.stride(lines.axis);
+    const size_t col        = out.stride(DIM - 1);
+    std::vector<VAL> prefix(num_blocks * lines.width);
+    for (size_t line = 0; line < num_lines; line += lines.width) {
+      auto offset = lines.line_offset(line);
+#pragma omp parallel for schedule(static)
+      for (size_t b = 0; b < num_blocks; ++b) {
+        const size_t last = std::min(lines.length, (b + 1) * block);
+        scan_steps(func, load, out, in, lines, offset, lines.width, b * block, last);
+      }
+      const VAL* outptr = out.ptr(offset);
+      for (size_t b = 1; b < num_blocks; ++b) {
+        const VAL* end  = outptr + (b * block - 1) * step;
+        VAL* pre        = prefix.data() + b * lines.width;
+        const VAL* prev = pre - lines.width;
+        for (size_t j = 0; j < lines.width; ++j)
+          pre[j] = b == 1 ? end[j * col] : func(prev[j], end[j * col]);
+      }
+#pragma omp parallel for schedule(static)
+      for (size_t b = 1; b < num_blocks; ++b) {
+        const size_t last = std::min(lines.length, (b + 1) * block);
+        const VAL* pre    = prefix.data() + b * lines.width;
+        apply_prefixes(func, out, lines, offset, pre, lines.width, b * block, last);
+      }
+      write_sums(out, sum_vals, lines, offset, lines.width);
     }
   }
 };
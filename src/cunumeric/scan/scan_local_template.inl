@@ -15,7 +15,7 @@
  */
 
 #include "cunumeric/scan/scan_local_util.h"
-#include "cunumeric/pitches.h"
+#include "cunumeric/scan/scan_lines.h"
 
 namespace cunumeric {
 
@@ -24,16 +24,9 @@ using namespace legate;
 template <VariantKind KIND, ScanCode OP_CODE, Type::Code CODE, int DIM>
 struct ScanLocalImplBody;
 
-template <VariantKind KIND, ScanCode OP_CODE, Type::Code CODE, int DIM>
-struct ScanLocalNanImplBody;
-
-template <VariantKind KIND, ScanCode OP_CODE, bool NAN_TO_IDENTITY>
+template <VariantKind KIND, ScanCode OP_CODE>
 struct ScanLocalImpl {
-  // Case where NANs are transformed
-  template <Type::Code CODE,
-            int DIM,
-            std::enable_if_t<NAN_TO_IDENTITY && (legate::is_floating_point<CODE>::value ||
-                                                 legate::is_complex<CODE>::value)>* = nullptr>
+  template <Type::Code CODE, int DIM, std::enable_if_t<ScanOp<OP_CODE, CODE>::valid>* = nullptr>
   void operator()(ScanLocalArgs& args) const
   {
     using OP  = ScanOp<OP_CODE, CODE>;
@@ -41,55 +34,48 @@ struct ScanLocalImpl {
 
     auto rect = args.out.shape<DIM>();
 
-    Pitches<DIM - 1> pitches;
-    size_t volume = pitches.flatten(rect);
+    ScanLines<DIM> lines;
+    size_t num_lines = lines.flatten(rect, args.axis);
 
-    if (volume == 0) {
+    if (num_lines == 0) {
       args.sum_vals.bind_empty_data();
       return;
     }
 
-    auto out = args.out.write_accessor<VAL, DIM>(rect);
-    auto in  = args.in.read_accessor<VAL, DIM>(rect);
+    RowAccessor<VAL, DIM> out(args.out.write_accessor<VAL, DIM>(rect), rect);
+    RowAccessor<const VAL, DIM> in(args.in.read_accessor<VAL, DIM>(rect), rect);
+
+    Point<DIM> extents  = rect.hi - rect.lo + Point<DIM>::ONES();
+    extents[lines.axis] = 1;  // one element along scan axis
+    auto sum_vals       = args.sum_vals.create_output_buffer<VAL, DIM>(extents, true);
 
     OP func;
-    ScanLocalNanImplBody<KIND, OP_CODE, CODE, DIM>()(func, out, in, args.sum_vals, pitches, rect);
+    // NaNs are transformed only for sums and products of types that have them
+    if constexpr ((OP_CODE == ScanCode::SUM || OP_CODE == ScanCode::PROD) &&
+                  (legate::is_floating_point<CODE>::value || legate::is_complex<CODE>::value)) {
+      if (args.nan_to_identity) {
+        ScanLocalImplBody<KIND, OP_CODE, CODE, DIM>()(
+          func, ScanLoadNan<OP_CODE, CODE>{}, out, in, sum_vals, lines, num_lines);
+        return;
+      }
+    }
+    ScanLocalImplBody<KIND, OP_CODE, CODE, DIM>()(
+      func, ScanLoad<CODE>{}, out, in, sum_vals, lines, num_lines);
   }
-  // Case where NANs are as is
-  template <Type::Code CODE,
-            int DIM,
-            std::enable_if_t<!(NAN_TO_IDENTITY && (legate::is_floating_point<CODE>::value ||
-                                                   legate::is_complex<CODE>::value))>* = nullptr>
+
+  template <Type::Code CODE, int DIM, std::enable_if_t<!ScanOp<OP_CODE, CODE>::valid>* = nullptr>
   void operator()(ScanLocalArgs& args) const
   {
-    using OP  = ScanOp<OP_CODE, CODE>;
-    using VAL = legate_type_of<CODE>;
-
-    auto rect = args.out.shape<DIM>();
-
-    Pitches<DIM - 1> pitches;
-    size_t volume = pitches.flatten(rect);
-
-    if (volume == 0) {
-      args.sum_vals.bind_empty_data();
-      return;
-    }
-
-    auto out = args.out.write_accessor<VAL, DIM>(rect);
-    auto in  = args.in.read_accessor<VAL, DIM>(rect);
-
-    OP func;
-    ScanLocalImplBody<KIND, OP_CODE, CODE, DIM>()(func, out, in, args.sum_vals, pitches, rect);
+    assert(false);
   }
 };
 
 template <VariantKind KIND>
 struct ScanLocalDispatch {
-  template <ScanCode OP_CODE, bool NAN_TO_IDENTITY>
+  template <ScanCode OP_CODE>
   void operator()(ScanLocalArgs& args) const
   {
-    return double_dispatch(
-      args.in.dim(), args.in.code(), ScanLocalImpl<KIND, OP_CODE, NAN_TO_IDENTITY>{}, args);
+    return double_dispatch(args.in.dim(), args.in.code(), ScanLocalImpl<KIND, OP_CODE>{}, args);
   }
 };
 
@@ -100,8 +86,9 @@ static void scan_local_template(TaskContext& context)
                      context.inputs()[0],
                      context.outputs()[1],
                      context.scalars()[0].value<ScanCode>(),
-                     context.scalars()[1].value<bool>()};
-  op_dispatch(args.op_code, args.nan_to_identity, ScanLocalDispatch<KIND>{}, args);
+                     context.scalars()[1].value<bool>(),
+                     context.scalars()[2].value<int32_t>()};
+  op_dispatch(args.op_code, ScanLocalDispatch<KIND>{}, args);
 }
 
 }  // namespace cunumeric
@@ -16,55 +16,25 @@
 
 #pragma once
 
-#include "cunumeric/cunumeric.h"
-
-#include <thrust/functional.h>
+#include "cunumeric/scan/scan_util.h"
 
 namespace cunumeric {
 
-enum class ScanCode : int {
-  PROD = CUNUMERIC_SCAN_PROD,
-  SUM  = CUNUMERIC_SCAN_SUM,
-};
-
-template <typename Functor, typename... Fnargs>
-constexpr decltype(auto) op_dispatch(ScanCode op_code,
-                                     bool nan_to_identity,
-                                     Functor f,
-                                     Fnargs&&... args)
-{
-  switch (op_code) {
-    case ScanCode::PROD:
-      if (nan_to_identity) {
-        return f.template operator()<ScanCode::PROD, true>(std::forward<Fnargs>(args)...);
-      } else {
-        return f.template operator()<ScanCode::PROD, false>(std::forward<Fnargs>(args)...);
-      }
-    case ScanCode::SUM:
-      if (nan_to_identity) {
-        return f.template operator()<ScanCode::SUM, true>(std::forward<Fnargs>(args)...);
-      } else {
-        return f.template operator()<ScanCode::SUM, false>(std::forward<Fnargs>(args)...);
-      }
-    default: break;
-  }
-  assert(false);
-  return f.template operator()<ScanCode::SUM, false>(std::forward<Fnargs>(args)...);
-}
-
-template <ScanCode OP_CODE, legate::Type::Code CODE>
-struct ScanOp {};
-
+// Loads input values as they are
 template <legate::Type::Code CODE>
-struct ScanOp<ScanCode::SUM, CODE> : thrust::plus<legate::legate_type_of<CODE>> {
-  static constexpr int nan_identity = 0;
-  ScanOp() {}
+struct ScanLoad {
+  using VAL = legate::legate_type_of<CODE>;
+  __CUDA_HD__ VAL operator()(const VAL& x) const { return x; }
 };
 
-template <legate::Type::Code CODE>
-struct ScanOp<ScanCode::PROD, CODE> : thrust::multiplies<legate::legate_type_of<CODE>> {
-  static constexpr int nan_identity = 1;
-  ScanOp() {}
+// Loads NaNs as the identity of the scan
+template <ScanCode OP_CODE, legate::Type::Code CODE>
+struct ScanLoadNan {
+  using VAL = legate::legate_type_of<CODE>;
+  __CUDA_HD__ VAL operator()(const VAL& x) const
+  {
+    return cunumeric::is_nan(x) ? (VAL)ScanOp<OP_CODE, CODE>::nan_identity : x;
+  }
 };
 
 }  // namespace cunumeric
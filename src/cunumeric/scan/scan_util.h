@@ -0,0 +1,163 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cunumeric/cunumeric.h"
+#include "cunumeric/binary/binary_op_util.h"
+#include "cunumeric/unary/isnan.h"
+
+#include <thrust/functional.h>
+
+namespace cunumeric {
+
+enum class ScanCode : int {
+  BITWISE_AND = CUNUMERIC_SCAN_BITWISE_AND,
+  BITWISE_OR  = CUNUMERIC_SCAN_BITWISE_OR,
+  BITWISE_XOR = CUNUMERIC_SCAN_BITWISE_XOR,
+  LOGADDEXP   = CUNUMERIC_SCAN_LOGADDEXP,
+  LOGICAL_AND = CUNUMERIC_SCAN_LOGICAL_AND,
+  LOGICAL_OR  = CUNUMERIC_SCAN_LOGICAL_OR,
+  LOGICAL_XOR = CUNUMERIC_SCAN_LOGICAL_XOR,
+  MAX         = CUNUMERIC_SCAN_MAX,
+  MIN         = CUNUMERIC_SCAN_MIN,
+  PROD        = CUNUMERIC_SCAN_PROD,
+  SUM         = CUNUMERIC_SCAN_SUM,
+};
+
+template <typename Functor, typename... Fnargs>
+constexpr decltype(auto) op_dispatch(ScanCode op_code, Functor f, Fnargs&&... args)
+{
+  switch (op_code) {
+    case ScanCode::BITWISE_AND:
+      return f.template operator()<ScanCode::BITWISE_AND>(std::forward<Fnargs>(args)...);
+    case ScanCode::BITWISE_OR:
+      return f.template operator()<ScanCode::BITWISE_OR>(std::forward<Fnargs>(args)...);
+    case ScanCode::BITWISE_XOR:
+      return f.template operator()<ScanCode::BITWISE_XOR>(std::forward<Fnargs>(args)...);
+    case ScanCode::LOGADDEXP:
+      return f.template operator()<ScanCode::LOGADDEXP>(std::forward<Fnargs>(args)...);
+    case ScanCode::LOGICAL_AND:
+      return f.template operator()<ScanCode::LOGICAL_AND>(std::forward<Fnargs>(args)...);
+    case ScanCode::LOGICAL_OR:
+      return f.template operator()<ScanCode::LOGICAL_OR>(std::forward<Fnargs>(args)...);
+    case ScanCode::LOGICAL_XOR:
+      return f.template operator()<ScanCode::LOGICAL_XOR>(std::forward<Fnargs>(args)...);
+    case ScanCode::MAX: return f.template operator()<ScanCode::MAX>(std::forward<Fnargs>(args)...);
+    case ScanCode::MIN: return f.template operator()<ScanCode::MIN>(std::forward<Fnargs>(args)...);
+    case ScanCode::PROD:
+      return f.template operator()<ScanCode::PROD>(std::forward<Fnargs>(args)...);
+    case ScanCode::SUM: return f.template operator()<ScanCode::SUM>(std::forward<Fnargs>(args)...);
+    default: break;
+  }
+  assert(false);
+  return f.template operator()<ScanCode::SUM>(std::forward<Fnargs>(args)...);
+}
+
+// Associative binary operators that the scan tasks support. The global pass
+// only ever combines values that are already in the array, so none of them
+// needs an identity. Only sums and products have NaN-ignoring variants, for
+// which NaNs are loaded as nan_identity.
+template <ScanCode OP_CODE, legate::Type::Code CODE>
+struct ScanOp {
+  static constexpr bool valid = false;
+};
+
+template <legate::Type::Code CODE>
+struct ScanOp<ScanCode::SUM, CODE> : thrust::plus<legate::legate_type_of<CODE>> {
+  static constexpr bool valid       = true;
+  static constexpr int nan_identity = 0;
+  ScanOp() {}
+};
+
+template <legate::Type::Code CODE>
+struct ScanOp<ScanCode::PROD, CODE> : thrust::multiplies<legate::legate_type_of<CODE>> {
+  static constexpr bool valid       = true;
+  static constexpr int nan_identity = 1;
+  ScanOp() {}
+};
+
+// Operators other than sums and products are the elementwise ones of the
+// binary ufuncs, which take no arguments
+template <BinaryOpCode OP_CODE, legate::Type::Code CODE>
+struct ScanBinaryOp : BinaryOp<OP_CODE, CODE> {
+  ScanBinaryOp() : BinaryOp<OP_CODE, CODE>(std::vector<legate::Store>{}) {}
+};
+
+// NaNs propagate, as in NumPy, which the elementwise maximum and minimum do
+// not guarantee. Complex values have no order.
+template <legate::Type::Code CODE>
+struct ScanOp<ScanCode::MAX, CODE> : ScanBinaryOp<BinaryOpCode::MAXIMUM, CODE> {
+  using VAL                   = legate::legate_type_of<CODE>;
+  static constexpr bool valid = !legate::is_complex<CODE>::value;
+  __CUDA_HD__ VAL operator()(const VAL& a, const VAL& b) const
+  {
+    if (cunumeric::is_nan(a)) return a;
+    if (cunumeric::is_nan(b)) return b;
+    return ScanBinaryOp<BinaryOpCode::MAXIMUM, CODE>::operator()(a, b);
+  }
+};
+
+template <legate::Type::Code CODE>
+struct ScanOp<ScanCode::MIN, CODE> : ScanBinaryOp<BinaryOpCode::MINIMUM, CODE> {
+  using VAL                   = legate::legate_type_of<CODE>;
+  static constexpr bool valid = !legate::is_complex<CODE>::value;
+  __CUDA_HD__ VAL operator()(const VAL& a, const VAL& b) const
+  {
+    if (cunumeric::is_nan(a)) return a;
+    if (cunumeric::is_nan(b)) return b;
+    return ScanBinaryOp<BinaryOpCode::MINIMUM, CODE>::operator()(a, b);
+  }
+};
+
+// Half-precision values are combined in single precision
+template <legate::Type::Code CODE>
+struct ScanOp<ScanCode::LOGADDEXP, CODE> : ScanBinaryOp<BinaryOpCode::LOGADDEXP, CODE> {
+  static constexpr bool valid = BinaryOp<BinaryOpCode::LOGADDEXP, CODE>::valid;
+};
+
+template <legate::Type::Code CODE>
+struct ScanOp<ScanCode::BITWISE_AND, CODE> : ScanBinaryOp<BinaryOpCode::BITWISE_AND, CODE> {
+  static constexpr bool valid = BinaryOp<BinaryOpCode::BITWISE_AND, CODE>::valid;
+};
+
+template <legate::Type::Code CODE>
+struct ScanOp<ScanCode::BITWISE_OR, CODE> : ScanBinaryOp<BinaryOpCode::BITWISE_OR, CODE> {
+  static constexpr bool valid = BinaryOp<BinaryOpCode::BITWISE_OR, CODE>::valid;
+};
+
+template <legate::Type::Code CODE>
+struct ScanOp<ScanCode::BITWISE_XOR, CODE> : ScanBinaryOp<BinaryOpCode::BITWISE_XOR, CODE> {
+  static constexpr bool valid = BinaryOp<BinaryOpCode::BITWISE_XOR, CODE>::valid;
+};
+
+// Logical scans run on booleans, to which the inputs are converted beforehand
+template <legate::Type::Code CODE>
+struct ScanOp<ScanCode::LOGICAL_AND, CODE> : ScanBinaryOp<BinaryOpCode::LOGICAL_AND, CODE> {
+  static constexpr bool valid = CODE == legate::Type::Code::BOOL;
+};
+
+template <legate::Type::Code CODE>
+struct ScanOp<ScanCode::LOGICAL_OR, CODE> : ScanBinaryOp<BinaryOpCode::LOGICAL_OR, CODE> {
+  static constexpr bool valid = CODE == legate::Type::Code::BOOL;
+};
+
+template <legate::Type::Code CODE>
+struct ScanOp<ScanCode::LOGICAL_XOR, CODE> : ScanBinaryOp<BinaryOpCode::LOGICAL_XOR, CODE> {
+  static constexpr bool valid = CODE == legate::Type::Code::BOOL;
+};
+
+}  // namespace cunumeric
@@ -31,11 +31,16 @@ struct NonzeroImplBody<VariantKind::CPU, CODE, DIM> {
                   const Rect<DIM>& rect,
                   const size_t volume)
   {
+    RowPitches<DIM> rows;
+    const size_t num_rows = rows.flatten(rect);
+    RowAccessor<const VAL, DIM> inrows(in, rect);
+
     int64_t size = 0;
 
-    for (size_t idx = 0; idx < volume; ++idx) {
-      auto point = pitches.unflatten(idx, rect.lo);
-      size += in[point] != VAL(0);
+    for (size_t row = 0; row < num_rows; ++row) {
+      const size_t length = rows.row_length(row);
+      auto inrow          = inrows[rows.row_offset(row)];
+      for (size_t idx = 0; idx < length; ++idx) size += inrow[idx] != VAL(0);
     }
 
     std::vector<Buffer<int64_t>> results;
@@ -43,11 +48,17 @@ struct NonzeroImplBody<VariantKind::CPU, CODE, DIM> {
       results.push_back(output.create_output_buffer<int64_t, 1>(Point<1>(size), true));
 
     int64_t out_idx = 0;
-    for (size_t idx = 0; idx < volume; ++idx) {
-      auto point = pitches.unflatten(idx, rect.lo);
-      if (in[point] == VAL(0)) continue;
-      for (int32_t dim = 0; dim < DIM; ++dim) results[dim][out_idx] = point[dim];
-      ++out_idx;
+    for (size_t row = 0; row < num_rows; ++row) {
+      const auto offset   = rows.row_offset(row);
+      const size_t length = rows.row_length(row);
+      const auto point    = rect.lo + offset;
+      auto inrow          = inrows[offset];
+      for (size_t idx = 0; idx < length; ++idx) {
+        if (inrow[idx] == VAL(0)) continue;
+        for (int32_t dim = 0; dim < DIM - 1; ++dim) results[dim][out_idx] = point[dim];
+        results[DIM - 1][out_idx] = point[DIM - 1] + idx;
+        ++out_idx;
+      }
     }
     assert(size == out_idx);
   }
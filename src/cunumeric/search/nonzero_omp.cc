@@ -36,6 +36,10 @@ struct NonzeroImplBody<VariantKind::OMP, CODE, DIM> {
   {
     const auto max_threads = omp_get_max_threads();
 
+    RowPitches<DIM> rows;
+    const size_t num_rows = rows.flatten(rect, max_threads);
+    RowAccessor<const VAL, DIM> inrows(in, rect);
+
     int64_t size = 0;
     ThreadLocalStorage<int64_t> offsets(max_threads);
 
@@ -46,9 +50,10 @@ struct NonzeroImplBody<VariantKind::OMP, CODE, DIM> {
       {
         const int tid = omp_get_thread_num();
 #pragma omp for schedule(static)
-        for (size_t idx = 0; idx < volume; ++idx) {
-          auto point = pitches.unflatten(idx, rect.lo);
-          sizes[tid] += in[point] != VAL(0);
+        for (size_t row = 0; row < num_rows; ++row) {
+          const size_t length = rows.row_length(row);
+          auto inrow          = inrows[rows.row_offset(row)];
+          for (size_t idx = 0; idx < length; ++idx) sizes[tid] += inrow[idx] != VAL(0);
         }
       }
 
@@ -67,11 +72,17 @@ struct NonzeroImplBody<VariantKind::OMP, CODE, DIM> {
       const int tid   = omp_get_thread_num();
       int64_t out_idx = offsets[tid];
 #pragma omp for schedule(static)
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto point = pitches.unflatten(idx, rect.lo);
-        if (in[point] == VAL(0)) continue;
-        for (int32_t dim = 0; dim < DIM; ++dim) results[dim][out_idx] = point[dim];
-        ++out_idx;
+      for (size_t row = 0; row < num_rows; ++row) {
+        const auto offset   = rows.row_offset(row);
+        const size_t length = rows.row_length(row);
+        const auto point    = rect.lo + offset;
+        auto inrow          = inrows[offset];
+        for (size_t idx = 0; idx < length; ++idx) {
+          if (inrow[idx] == VAL(0)) continue;
+          for (int32_t dim = 0; dim < DIM - 1; ++dim) results[dim][out_idx] = point[dim];
+          results[DIM - 1][out_idx] = point[DIM - 1] + idx;
+          ++out_idx;
+        }
       }
     }
   }
@@ -0,0 +1,51 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/set/isin.h"
+#include "cunumeric/set/isin_template.inl"
+
+#include "cunumeric/cuda_help.h"
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <typename Kernel>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  isin_kernel(const Kernel kernel, size_t volume)
+{
+  const size_t idx = global_tid_1d();
+  if (idx >= volume) return;
+  kernel(idx);
+}
+
+template <Type::Code CODE, int32_t DIM>
+struct IsinImplBody<VariantKind::GPU, CODE, DIM> {
+  void operator()(const IsinKernel<CODE, DIM>& kernel, size_t volume) const
+  {
+    auto stream             = get_cached_stream();
+    const size_t num_blocks = (volume + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+    isin_kernel<<<num_blocks, THREADS_PER_BLOCK, 0, stream>>>(kernel, volume);
+    CHECK_CUDA_STREAM(stream);
+  }
+};
+
+/*static*/ void IsinTask::gpu_variant(TaskContext& context)
+{
+  isin_template<VariantKind::GPU>(context);
+}
+
+}  // namespace cunumeric
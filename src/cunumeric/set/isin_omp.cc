@@ -0,0 +1,55 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/set/isin.h"
+#include "cunumeric/set/isin_template.inl"
+#include "cunumeric/set/unique_engine.h"
+
+#include <omp.h>
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <Type::Code CODE, int32_t DIM>
+struct IsinImplBody<VariantKind::OMP, CODE, DIM> {
+  using VAL = legate_type_of<CODE>;
+
+  void operator()(const IsinKernel<CODE, DIM>& kernel, size_t volume) const
+  {
+    // The hash set is built once and then probed by all threads
+    if constexpr (is_hashable_unique<VAL>) {
+      if (kernel.num_test <= volume) {
+        auto set = make_probe_set(kernel.test, kernel.num_test);
+#pragma omp parallel for schedule(static)
+        for (size_t idx = 0; idx < volume; ++idx) {
+          auto p        = kernel.pitches.unflatten(idx, kernel.lo);
+          kernel.out[p] = set.contains(kernel.in[p]) != kernel.invert;
+        }
+        return;
+      }
+    }
+#pragma omp parallel for schedule(static)
+    for (size_t idx = 0; idx < volume; ++idx) kernel(idx);
+  }
+};
+
+/*static*/ void IsinTask::omp_variant(TaskContext& context)
+{
+  isin_template<VariantKind::OMP>(context);
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,103 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/set/isin.h"
+#include "cunumeric/pitches.h"
+#include "cunumeric/unary/isnan.h"
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <VariantKind KIND, Type::Code CODE, int32_t DIM>
+struct IsinImplBody;
+
+template <Type::Code CODE, int32_t DIM>
+struct IsinKernel {
+  using VAL = legate_type_of<CODE>;
+
+  AccessorRO<VAL, DIM> in;
+  const VAL* test;
+  size_t num_test;
+  AccessorWO<bool, DIM> out;
+  bool invert;
+  Pitches<DIM - 1> pitches;
+  Point<DIM> lo;
+
+  __CUDA_HD__ void operator()(size_t idx) const
+  {
+    auto p = pitches.unflatten(idx, lo);
+    // Binary search for the first test value that is not less than the value,
+    // in the NaN-last order the test values are sorted in
+    const VAL value = in[p];
+    size_t first    = 0;
+    size_t count    = num_test;
+    NanLastLess<VAL> less;
+    while (count > 0) {
+      const size_t step = count / 2;
+      if (less(test[first + step], value)) {
+        first += step + 1;
+        count -= step + 1;
+      } else
+        count = step;
+    }
+    // NaNs never compare equal, so they are never found
+    const bool found = first < num_test && test[first] == value;
+    out[p]           = found != invert;
+  }
+};
+
+template <VariantKind KIND>
+struct IsinImpl {
+  template <Type::Code CODE, int32_t DIM>
+  void operator()(IsinArgs& args) const
+  {
+    using VAL = legate_type_of<CODE>;
+    IsinKernel<CODE, DIM> kernel;
+
+    auto rect     = args.input.shape<DIM>();
+    size_t volume = kernel.pitches.flatten(rect);
+    if (volume == 0) return;
+
+    auto test_rect  = args.test.shape<1>();
+    kernel.in       = args.input.read_accessor<VAL, DIM>(rect);
+    kernel.num_test = test_rect.volume();
+    kernel.test     = kernel.num_test > 0
+                        ? args.test.read_accessor<VAL, 1>(test_rect).ptr(test_rect)
+                        : nullptr;
+    kernel.out      = args.output.write_accessor<bool, DIM>(rect);
+    kernel.invert   = args.invert;
+    kernel.lo       = rect.lo;
+
+    IsinImplBody<KIND, CODE, DIM>()(kernel, volume);
+  }
+};
+
+template <VariantKind KIND>
+static void isin_template(TaskContext& context)
+{
+  IsinArgs args{context.inputs()[0],
+                context.inputs()[1],
+                context.outputs()[0],
+                context.scalars()[0].value<bool>()};
+  auto dim = std::max(1, args.input.dim());
+  double_dispatch(dim, args.input.code(), IsinImpl<KIND>{}, args);
+}
+
+}  // namespace cunumeric
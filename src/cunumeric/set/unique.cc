@@ -16,6 +16,9 @@
 
 #include "cunumeric/set/unique.h"
 #include "cunumeric/set/unique_template.inl"
+#include "cunumeric/set/unique_engine.h"
+
+#include <thrust/execution_policy.h>
 
 namespace cunumeric {
 
@@ -34,16 +37,31 @@ struct UniqueImplBody<VariantKind::CPU, CODE, DIM> {
                   const DomainPoint& point,
                   const Domain& launch_domain)
   {
-    std::set<VAL> dedup_set;
+    RowPitches<DIM> rows;
+    const size_t num_rows = rows.flatten(rect);
+    RowAccessor<const VAL, DIM> inrows(in, rect);
 
-    for (size_t idx = 0; idx < volume; ++idx) {
-      auto p = pitches.unflatten(idx, rect.lo);
-      dedup_set.insert(in[p]);
+    std::vector<VAL> values;
+    size_t num_unique = 0;
+    bool hashed       = false;
+    if constexpr (is_hashable_unique<VAL>) {
+      DedupHashSet<VAL> set;
+      hashed = true;
+      for (size_t row = 0; row < num_rows && hashed; ++row)
+        hashed = insert_row(set, inrows, rows, row);
+      if (hashed) {
+        set.append_to(values);
+        num_unique = sort_unique(thrust::host, values.data(), values.size());
+      }
+    }
+    if (!hashed) {
+      values.resize(volume);
+      for (size_t row = 0; row < num_rows; ++row) gather_row(values.data(), inrows, rows, row);
+      num_unique = sort_unique(thrust::host, values.data(), volume);
     }
 
-    auto result = output.create_output_buffer<VAL, 1>(dedup_set.size(), true);
-    size_t pos  = 0;
-    for (auto e : dedup_set) result[pos++] = e;
+    auto result = output.create_output_buffer<VAL, 1>(num_unique, true);
+    for (size_t idx = 0; idx < num_unique; ++idx) result[idx] = values[idx];
   }
 };
 
@@ -16,6 +16,7 @@
 
 #include "cunumeric/set/unique.h"
 #include "cunumeric/set/unique_template.inl"
+#include "cunumeric/set/unique_engine.h"
 #include "cunumeric/utilities/thrust_util.h"
 
 #include "cunumeric/cuda_help.h"
@@ -106,8 +107,10 @@ static Piece<VAL> tree_reduce(Array& output,
                     p_mine + my_piece.second,
                     p_other,
                     p_other + other_piece.second,
-                    p_merged);
-      auto* end = thrust::unique(DEFAULT_POLICY.on(stream), p_merged, p_merged + merged_size);
+                    p_merged,
+                    NanLastLess<VAL>{});
+      auto* end = thrust::unique(
+        DEFAULT_POLICY.on(stream), p_merged, p_merged + merged_size, NanEqual<VAL>{});
 
       // Make sure we release the memory so that we can reuse it
       my_piece.first.destroy();
@@ -171,8 +174,8 @@ struct UniqueImplBody<VariantKind::GPU, CODE, DIM> {
       CHECK_CUDA_STREAM(stream);
 
       // Find unique values
-      thrust::sort(DEFAULT_POLICY.on(stream), ptr, ptr + volume);
-      end = thrust::unique(DEFAULT_POLICY.on(stream), ptr, ptr + volume);
+      thrust::sort(DEFAULT_POLICY.on(stream), ptr, ptr + volume, NanLastLess<VAL>{});
+      end = thrust::unique(DEFAULT_POLICY.on(stream), ptr, ptr + volume, NanEqual<VAL>{});
     }
 
     Piece<VAL> result;
@@ -0,0 +1,169 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cunumeric/cunumeric.h"
+#include "cunumeric/row_pitches.h"
+#include "cunumeric/unary/isnan.h"
+
+#include <thrust/sort.h>
+#include <thrust/unique.h>
+
+#include <type_traits>
+#include <vector>
+
+namespace cunumeric {
+
+// Host-side building blocks for deduplication, shared by the UNIQUE tasks and
+// the UNIQUE_REDUCE task that merges their results. Inputs with few distinct
+// values are deduplicated with hash sets, which touch every element once and
+// keep their state in cache, and everything else by sorting. The ISIN tasks
+// use the same hash sets for membership tests.
+
+// Hash sets are only used for integral values, whose equality is exact
+template <typename VAL>
+constexpr bool is_hashable_unique = std::is_integral<VAL>::value;
+
+// A hash set gives up once it holds this many distinct values, at which point
+// sorting all elements becomes the cheaper option
+constexpr size_t UNIQUE_HASH_MAX_DISTINCT = 1 << 16;
+
+// Open-addressing hash set with linear probing and a load factor of at most
+// one half
+template <typename VAL>
+class DedupHashSet {
+ public:
+  // The table starts out large enough to hold expected_size values without
+  // growing
+  explicit DedupHashSet(size_t max_size = UNIQUE_HASH_MAX_DISTINCT, size_t expected_size = 8)
+    : max_size_(max_size)
+  {
+    size_t capacity = 16;
+    while (capacity < 2 * expected_size) capacity <<= 1;
+    rehash(capacity);
+  }
+
+ public:
+  // Returns false if the value is new and the set is already full
+  bool insert(const VAL& value)
+  {
+    size_t slot = hash(value);
+    for (; used_[slot]; slot = (slot + 1) & mask_)
+      if (values_[slot] == value) return true;
+    if (size_ == max_size_) return false;
+    used_[slot]   = 1;
+    values_[slot] = value;
+    if (2 * ++size_ > values_.size()) rehash(2 * values_.size());
+    return true;
+  }
+  bool contains(const VAL& value) const
+  {
+    for (size_t slot = hash(value); used_[slot]; slot = (slot + 1) & mask_)
+      if (values_[slot] == value) return true;
+    return false;
+  }
+  size_t size() const { return size_; }
+  // Appends the values in the set to out, in no particular order
+  void append_to(std::vector<VAL>& out) const
+  {
+    for (size_t slot = 0; slot < values_.size(); ++slot)
+      if (used_[slot]) out.push_back(values_[slot]);
+  }
+
+ private:
+  // Fibonacci hashing, which spreads consecutive keys over the table
+  size_t hash(const VAL& value) const
+  {
+    return static_cast<size_t>((static_cast<uint64_t>(value) * 0x9E3779B97F4A7C15ULL) >> shift_);
+  }
+  void rehash(size_t capacity)
+  {
+    std::vector<VAL> values;
+    std::vector<uint8_t> used;
+    values.swap(values_);
+    used.swap(used_);
+    values_.resize(capacity);
+    used_.assign(capacity, 0);
+    mask_  = capacity - 1;
+    shift_ = 64;
+    for (size_t cap = capacity; cap > 1; cap >>= 1) --shift_;
+    for (size_t slot = 0; slot < values.size(); ++slot) {
+      if (!used[slot]) continue;
+      size_t target = hash(values[slot]);
+      while (used_[target]) target = (target + 1) & mask_;
+      used_[target]   = 1;
+      values_[target] = values[slot];
+    }
+  }
+
+ private:
+  std::vector<VAL> values_;
+  std::vector<uint8_t> used_;
+  size_t size_{0};
+  size_t max_size_;
+  size_t mask_;
+  int32_t shift_;
+};
+
+// Builds a hash set that holds all of values[0, size), sized up front so that
+// it never rehashes
+template <typename VAL>
+DedupHashSet<VAL> make_probe_set(const VAL* values, size_t size)
+{
+  DedupHashSet<VAL> set(size, size);
+  for (size_t idx = 0; idx < size; ++idx) set.insert(values[idx]);
+  return set;
+}
+
+// Sorts values[0, size) and moves the distinct ones to the front, returning
+// their number. A NaN, if any, is the last of the distinct values.
+template <typename exe_pol_t, typename VAL>
+size_t sort_unique(const exe_pol_t& exe_pol, VAL* values, size_t size)
+{
+  thrust::sort(exe_pol, values, values + size, NanLastLess<VAL>{});
+  return thrust::unique(exe_pol, values, values + size, NanEqual<VAL>{}) - values;
+}
+
+// Inserts the elements of a row into the hash set. Returns false as soon as
+// the set overflows.
+template <typename VAL, int32_t DIM>
+bool insert_row(DedupHashSet<VAL>& set,
+                const RowAccessor<const VAL, DIM>& in,
+                const RowPitches<DIM>& rows,
+                size_t row)
+{
+  auto inrow          = in[rows.row_offset(row)];
+  const size_t length = rows.row_length(row);
+  for (size_t idx = 0; idx < length; ++idx)
+    if (!set.insert(inrow[idx])) return false;
+  return true;
+}
+
+// Copies the elements of a row to their positions in row-major order
+template <typename VAL, int32_t DIM>
+void gather_row(VAL* out,
+                const RowAccessor<const VAL, DIM>& in,
+                const RowPitches<DIM>& rows,
+                size_t row)
+{
+  auto inrow          = in[rows.row_offset(row)];
+  const size_t length = rows.row_length(row);
+  VAL* outrow         = out + rows.row_first(row);
+  for (size_t idx = 0; idx < length; ++idx) outrow[idx] = inrow[idx];
+}
+
+}  // namespace cunumeric
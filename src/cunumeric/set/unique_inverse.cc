@@ -0,0 +1,46 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/set/unique_inverse.h"
+#include "cunumeric/set/unique_inverse_template.inl"
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <>
+struct UniqueInverseImplBody<VariantKind::CPU> {
+  template <typename Kernel>
+  void operator()(const Kernel& kernel, size_t volume) const
+  {
+    for (size_t idx = 0; idx < volume; ++idx) kernel(idx);
+  }
+};
+
+/*static*/ void UniqueInverseTask::cpu_variant(TaskContext& context)
+{
+  unique_inverse_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void)
+{
+  UniqueInverseTask::register_variants();
+}
+}  // namespace
+
+}  // namespace cunumeric
@@ -0,0 +1,52 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cunumeric/cunumeric.h"
+
+namespace cunumeric {
+
+struct UniqueInverseArgs {
+  const Array& input;
+  const Array& unique;
+  const Array& inverse;
+  const Array& counts;
+  const Array& index;
+  bool has_inverse;
+  bool has_counts;
+  bool has_index;
+  legate::DomainPoint shape;
+};
+
+// Maps the elements of an array to their positions in the sorted array of its
+// unique values, and optionally counts the occurrences of the unique values
+// and finds their first occurrences in the flattened array
+class UniqueInverseTask : public CuNumericTask<UniqueInverseTask> {
+ public:
+  static const int TASK_ID = CUNUMERIC_UNIQUE_INVERSE;
+
+ public:
+  static void cpu_variant(legate::TaskContext& context);
+#ifdef LEGATE_USE_OPENMP
+  static void omp_variant(legate::TaskContext& context);
+#endif
+#ifdef LEGATE_USE_CUDA
+  static void gpu_variant(legate::TaskContext& context);
+#endif
+};
+
+}  // namespace cunumeric
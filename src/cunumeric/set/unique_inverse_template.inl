@@ -0,0 +1,145 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/set/unique_inverse.h"
+#include "cunumeric/set/unique_engine.h"
+#include "cunumeric/pitches.h"
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <VariantKind KIND>
+struct UniqueInverseImplBody;
+
+template <VariantKind KIND, Type::Code CODE, int32_t DIM>
+struct UniqueInverseKernel {
+  using VAL    = legate_type_of<CODE>;
+  using COUNTS = AccessorRD<SumReduction<int64_t>, KIND == VariantKind::CPU, 1>;
+  using INDEX  = AccessorRD<MinReduction<int64_t>, KIND == VariantKind::CPU, 1>;
+
+  AccessorRO<VAL, DIM> in;
+  const VAL* unique;
+  int64_t num_unique;
+  AccessorWO<int64_t, DIM> inverse;
+  COUNTS counts;
+  INDEX index;
+  bool has_inverse;
+  bool has_counts;
+  bool has_index;
+  Pitches<DIM - 1> pitches;
+  Point<DIM> lo;
+  // Strides of the flattened array, which may be larger than this piece
+  Point<DIM> strides;
+
+  __CUDA_HD__ void operator()(size_t idx) const
+  {
+    auto p = pitches.unflatten(idx, lo);
+    // Binary search for the position of the value in the unique values,
+    // which are sorted with NaNs last. Every value is among them, so the
+    // search ends at the value itself, or at the single NaN for NaNs.
+    const VAL value = in[p];
+    int64_t first   = 0;
+    int64_t count   = num_unique;
+    while (count > 0) {
+      const int64_t step = count / 2;
+      if (NanLastLess<VAL>{}(unique[first + step], value)) {
+        first += step + 1;
+        count -= step + 1;
+      } else
+        count = step;
+    }
+    const int64_t code = first;
+
+    if (has_inverse) inverse[p] = code;
+    if (has_counts) counts.reduce(code, 1);
+    if (has_index) {
+      int64_t flat = 0;
+      for (int32_t dim = 0; dim < DIM; ++dim) flat += p[dim] * strides[dim];
+      index.reduce(code, flat);
+    }
+  }
+};
+
+template <VariantKind KIND>
+struct UniqueInverseImpl {
+  template <Type::Code CODE, int32_t DIM>
+  void operator()(UniqueInverseArgs& args) const
+  {
+    constexpr bool EXCLUSIVE = KIND == VariantKind::CPU;
+    UniqueInverseKernel<KIND, CODE, DIM> kernel;
+
+    auto rect     = args.input.shape<DIM>();
+    size_t volume = kernel.pitches.flatten(rect);
+    if (volume == 0) return;
+
+    using VAL         = legate_type_of<CODE>;
+    auto unique_rect  = args.unique.shape<1>();
+    kernel.in         = args.input.read_accessor<VAL, DIM>(rect);
+    kernel.unique     = args.unique.read_accessor<VAL, 1>(unique_rect).ptr(unique_rect);
+    kernel.num_unique = unique_rect.volume();
+    kernel.lo         = rect.lo;
+
+    kernel.has_inverse = args.has_inverse;
+    kernel.has_counts  = args.has_counts;
+    kernel.has_index   = args.has_index;
+    if (kernel.has_inverse) kernel.inverse = args.inverse.write_accessor<int64_t, DIM>(rect);
+    if (kernel.has_counts)
+      kernel.counts = args.counts.reduce_accessor<SumReduction<int64_t>, EXCLUSIVE, 1>(unique_rect);
+    if (kernel.has_index)
+      kernel.index = args.index.reduce_accessor<MinReduction<int64_t>, EXCLUSIVE, 1>(unique_rect);
+
+    coord_t stride = 1;
+    for (int32_t dim = DIM - 1; dim >= 0; --dim) {
+      kernel.strides[dim] = stride;
+      stride *= dim < args.shape.dim ? args.shape[dim] : 1;
+    }
+
+    UniqueInverseImplBody<KIND>()(kernel, volume);
+  }
+};
+
+template <VariantKind KIND>
+static void unique_inverse_template(TaskContext& context)
+{
+  auto& inputs     = context.inputs();
+  auto& outputs    = context.outputs();
+  auto& reductions = context.reductions();
+  auto& scalars    = context.scalars();
+
+  bool has_inverse = scalars[0].value<bool>();
+  bool has_counts  = scalars[1].value<bool>();
+  bool has_index   = scalars[2].value<bool>();
+
+  Array dummy;
+  size_t next_reduction = 0;
+  UniqueInverseArgs args{inputs[0],
+                         inputs[1],
+                         has_inverse ? outputs[0] : dummy,
+                         has_counts ? reductions[next_reduction++] : dummy,
+                         has_index ? reductions[next_reduction++] : dummy,
+                         has_inverse,
+                         has_counts,
+                         has_index,
+                         scalars[3].value<DomainPoint>()};
+  auto dim = std::max(1, args.input.dim());
+  double_dispatch(dim, args.input.code(), UniqueInverseImpl<KIND>{}, args);
+}
+
+}  // namespace cunumeric
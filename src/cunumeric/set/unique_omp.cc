@@ -16,8 +16,11 @@
 
 #include "cunumeric/set/unique.h"
 #include "cunumeric/set/unique_template.inl"
+#include "cunumeric/set/unique_engine.h"
 
 #include <omp.h>
+#include <thrust/execution_policy.h>
+#include <thrust/system/omp/execution_policy.h>
 
 namespace cunumeric {
 
@@ -37,38 +40,49 @@ struct UniqueImplBody<VariantKind::OMP, CODE, DIM> {
                   const Domain& launch_domain)
   {
     const auto max_threads = omp_get_max_threads();
-    std::vector<std::set<VAL>> dedup_set(max_threads);
+    RowPitches<DIM> rows;
+    const size_t num_rows = rows.flatten(rect, max_threads);
+    RowAccessor<const VAL, DIM> inrows(in, rect);
 
+    std::vector<VAL> values;
+    size_t num_unique = 0;
+    bool hashed       = false;
+    if constexpr (is_hashable_unique<VAL>) {
+      // Each thread deduplicates its rows into its own hash set, and all
+      // threads stop as soon as one of the sets overflows
+      std::vector<DedupHashSet<VAL>> sets(max_threads);
+      bool overflow = false;
 #pragma omp parallel
-    {
-      const int tid      = omp_get_thread_num();
-      auto& my_dedup_set = dedup_set[tid];
+      {
+        auto& set = sets[omp_get_thread_num()];
 #pragma omp for schedule(static)
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto p = pitches.unflatten(idx, rect.lo);
-        my_dedup_set.insert(in[p]);
-      }
-    }
-
-    size_t remaining = max_threads;
-    size_t radix     = (max_threads + 1) / 2;
-    while (remaining > 1) {
-#pragma omp for schedule(static, 1)
-      for (size_t idx = 0; idx < radix; ++idx) {
-        if (idx + radix < remaining) {
-          auto& my_set    = dedup_set[idx];
-          auto& other_set = dedup_set[idx + radix];
-          my_set.insert(other_set.begin(), other_set.end());
+        for (size_t row = 0; row < num_rows; ++row) {
+          bool stop;
+#pragma omp atomic read
+          stop = overflow;
+          if (stop) continue;
+          if (!insert_row(set, inrows, rows, row)) {
+#pragma omp atomic write
+            overflow = true;
+          }
         }
       }
-      remaining = radix;
-      radix     = (radix + 1) / 2;
+      if (!overflow) {
+        hashed = true;
+        for (auto& set : sets) set.append_to(values);
+        num_unique = sort_unique(thrust::host, values.data(), values.size());
+      }
+    }
+    if (!hashed) {
+      values.resize(volume);
+#pragma omp parallel for schedule(static)
+      for (size_t row = 0; row < num_rows; ++row) gather_row(values.data(), inrows, rows, row);
+      num_unique = sort_unique(thrust::omp::par, values.data(), volume);
     }
 
-    auto& final_dedup_set = dedup_set[0];
-    auto result           = output.create_output_buffer<VAL, 1>(final_dedup_set.size(), true);
-    size_t pos            = 0;
-    for (auto e : final_dedup_set) result[pos++] = e;
+    auto result = output.create_output_buffer<VAL, 1>(num_unique, true);
+#pragma omp parallel for schedule(static)
+    for (size_t idx = 0; idx < num_unique; ++idx) result[idx] = values[idx];
   }
 };
 
@@ -18,11 +18,9 @@
 
 // Useful for IDEs
 #include "cunumeric/set/unique_reduce.h"
-#include "cunumeric/pitches.h"
+#include "cunumeric/set/unique_engine.h"
 
 #include <thrust/copy.h>
-#include <thrust/sort.h>
-#include <thrust/unique.h>
 #include <thrust/execution_policy.h>
 
 namespace cunumeric {
@@ -56,9 +54,7 @@ struct UniqueReduceImpl {
     }
     assert(offset == res_size);
 
-    thrust::sort(exe_pol, res_ptr, res_ptr + res_size);
-    VAL* actual_end = thrust::unique(exe_pol, res_ptr, res_ptr + res_size);
-    output.bind_data(result, Point<1>(actual_end - res_ptr));
+    output.bind_data(result, Point<1>(sort_unique(exe_pol, res_ptr, res_size)));
   }
 };
 
@@ -0,0 +1,52 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/sort/lexsort.h"
+#include "cunumeric/sort/lexsort_cpu.inl"
+#include "cunumeric/sort/lexsort_template.inl"
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <Type::Code CODE>
+struct LexsortImplBody<VariantKind::CPU, CODE> {
+  using VAL = legate_type_of<CODE>;
+
+  void operator()(const VAL* key,
+                  int64_t* perm,
+                  const size_t volume,
+                  const size_t segment_size,
+                  const bool first) const
+  {
+    lexsort_by_key(key, perm, volume, segment_size, first, thrust::host);
+  }
+};
+
+/*static*/ void LexsortTask::cpu_variant(TaskContext& context)
+{
+  lexsort_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void)
+{
+  LexsortTask::register_variants();
+}
+}  // namespace
+
+}  // namespace cunumeric
@@ -0,0 +1,84 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/sort/lexsort.h"
+#include "cunumeric/sort/lexsort_template.inl"
+#include "cunumeric/sort/local_sort.cuh"
+
+#include "cunumeric/cuda_help.h"
+
+namespace cunumeric {
+
+using namespace legate;
+
+// Initializes the permutation of every segment to the identity
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  identity_kernel(int64_t* perm, size_t volume, size_t segment_size)
+{
+  const size_t idx = global_tid_1d();
+  if (idx >= volume) return;
+  perm[idx] = idx % segment_size;
+}
+
+// Gathers the key into the order of the current permutation
+template <typename VAL>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  gather_kernel(VAL* values,
+                const VAL* key,
+                const int64_t* perm,
+                size_t volume,
+                size_t segment_size)
+{
+  const size_t idx = global_tid_1d();
+  if (idx >= volume) return;
+  values[idx] = key[idx - idx % segment_size + perm[idx]];
+}
+
+template <Type::Code CODE>
+struct LexsortImplBody<VariantKind::GPU, CODE> {
+  using VAL = legate_type_of<CODE>;
+
+  void operator()(const VAL* key,
+                  int64_t* perm,
+                  const size_t volume,
+                  const size_t segment_size,
+                  const bool first) const
+  {
+    auto stream         = get_cached_stream();
+    const size_t blocks = (volume + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+
+    auto values = create_buffer<VAL>(volume, Memory::Kind::GPU_FB_MEM);
+    if (first) {
+      // The first key is sorted straight out of the input
+      identity_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(perm, volume, segment_size);
+      local_sort<CODE>(key, values.ptr(0), perm, perm, volume, segment_size, true, stream);
+    } else {
+      gather_kernel<VAL>
+        <<<blocks, THREADS_PER_BLOCK, 0, stream>>>(values.ptr(0), key, perm, volume, segment_size);
+      local_sort<CODE>(
+        values.ptr(0), values.ptr(0), perm, perm, volume, segment_size, true, stream);
+    }
+    CHECK_CUDA_STREAM(stream);
+    values.destroy();
+  }
+};
+
+/*static*/ void LexsortTask::gpu_variant(TaskContext& context)
+{
+  lexsort_template<VariantKind::GPU>(context);
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,65 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/sort/lexsort.h"
+#include "cunumeric/sort/sort_cpu.inl"
+
+#include <thrust/copy.h>
+#include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+namespace cunumeric {
+
+using namespace legate;
+
+// Sorts the permutation of every segment stably by one key, reusing the
+// local sort of SortTask on a copy of the key gathered into the order of the
+// current permutation
+template <typename VAL, typename DerivedPolicy>
+void lexsort_by_key(const VAL* key,
+                    int64_t* perm,
+                    const size_t volume,
+                    const size_t segment_size,
+                    const bool first,
+                    const DerivedPolicy& exec)
+{
+  auto values_buffer = create_buffer<VAL>(volume);
+  VAL* values        = values_buffer.ptr(0);
+  if (first) {
+    thrust::transform(exec,
+                      thrust::make_counting_iterator<int64_t>(0),
+                      thrust::make_counting_iterator<int64_t>(volume),
+                      thrust::make_constant_iterator<int64_t>(segment_size),
+                      perm,
+                      modulusWithOffset(0));
+    thrust::copy(exec, key, key + volume, values);
+  } else {
+    thrust::for_each(exec,
+                     thrust::make_counting_iterator<size_t>(0),
+                     thrust::make_counting_iterator<size_t>(volume),
+                     [=](size_t idx) { values[idx] = key[idx - idx % segment_size + perm[idx]]; });
+  }
+  local_sort_inplace(values, perm, volume, segment_size, true, exec);
+  values_buffer.destroy();
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,85 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/sort/lexsort.h"
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <VariantKind KIND, Type::Code CODE>
+struct LexsortImplBody;
+
+// Stably sorts the permutation of every segment by one key. The first key
+// sorts the identity permutation, and every following key the permutation
+// left behind by the previous one, so elements that compare equal in a key
+// keep the order established by the keys before it.
+template <VariantKind KIND, int32_t DIM>
+struct LexsortKeyImpl {
+  template <Type::Code CODE>
+  void operator()(const Array& key,
+                  const Rect<DIM>& rect,
+                  int64_t* perm,
+                  const size_t volume,
+                  const size_t segment_size,
+                  const bool first) const
+  {
+    using VAL = legate_type_of<CODE>;
+
+    auto acc = key.read_accessor<VAL, DIM>(rect);
+    assert(acc.accessor.is_dense_row_major(rect));
+    LexsortImplBody<KIND, CODE>()(acc.ptr(rect.lo), perm, volume, segment_size, first);
+  }
+};
+
+template <VariantKind KIND>
+struct LexsortImpl {
+  template <int32_t DIM>
+  void operator()(LexsortArgs& args) const
+  {
+    // Segments are never split across tasks, so the last dimension of the
+    // rectangle spans whole segments
+    auto rect = args.output.shape<DIM>();
+    if (rect.empty()) return;
+
+    const size_t volume       = rect.volume();
+    const size_t segment_size = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
+
+    auto output = args.output.write_accessor<int64_t, DIM>(rect);
+    assert(output.accessor.is_dense_row_major(rect));
+    int64_t* perm = output.ptr(rect.lo);
+
+    // Keys are ordered from the least to the most significant one, as in
+    // numpy.lexsort, which is the order in which they are sorted by
+    for (size_t idx = 0; idx < args.keys.size(); ++idx) {
+      auto& key = args.keys[idx];
+      type_dispatch(
+        key.code(), LexsortKeyImpl<KIND, DIM>{}, key, rect, perm, volume, segment_size, idx == 0);
+    }
+  }
+};
+
+template <VariantKind KIND>
+static void lexsort_template(TaskContext& context)
+{
+  LexsortArgs args{context.inputs(), context.outputs()[0]};
+  dim_dispatch(args.output.dim(), LexsortImpl<KIND>{}, args);
+}
+
+}  // namespace cunumeric
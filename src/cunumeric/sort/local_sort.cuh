@@ -0,0 +1,72 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cunumeric/cunumeric.h"
+#include "cunumeric/sort/cub_sort.h"
+#include "cunumeric/sort/thrust_sort.h"
+
+// above this threshold segment sort will be performed
+// by cub::DeviceSegmentedRadixSort instead of thrust::(stable_)sort
+// with tuple keys (not available for complex)
+#define SEGMENT_THRESHOLD_RADIX_SORT 400
+
+namespace cunumeric {
+
+template <Type::Code CODE>
+struct support_cub : std::true_type {};
+template <>
+struct support_cub<Type::Code::COMPLEX64> : std::false_type {};
+template <>
+struct support_cub<Type::Code::COMPLEX128> : std::false_type {};
+
+template <Type::Code CODE, std::enable_if_t<support_cub<CODE>::value>* = nullptr>
+void local_sort(const legate_type_of<CODE>* values_in,
+                legate_type_of<CODE>* values_out,
+                const int64_t* indices_in,
+                int64_t* indices_out,
+                const size_t volume,
+                const size_t sort_dim_size,
+                const bool stable,  // cub sort is always stable
+                cudaStream_t stream)
+{
+  using VAL = legate_type_of<CODE>;
+  // fallback to thrust approach as segmented radix sort is not suited for small segments
+  if (volume == sort_dim_size || sort_dim_size > SEGMENT_THRESHOLD_RADIX_SORT) {
+    cub_local_sort(values_in, values_out, indices_in, indices_out, volume, sort_dim_size, stream);
+  } else {
+    thrust_local_sort(
+      values_in, values_out, indices_in, indices_out, volume, sort_dim_size, stable, stream);
+  }
+}
+
+template <Type::Code CODE, std::enable_if_t<!support_cub<CODE>::value>* = nullptr>
+void local_sort(const legate_type_of<CODE>* values_in,
+                legate_type_of<CODE>* values_out,
+                const int64_t* indices_in,
+                int64_t* indices_out,
+                const size_t volume,
+                const size_t sort_dim_size,
+                const bool stable,
+                cudaStream_t stream)
+{
+  using VAL = legate_type_of<CODE>;
+  thrust_local_sort(
+    values_in, values_out, indices_in, indices_out, volume, sort_dim_size, stable, stream);
+}
+
+}  // namespace cunumeric
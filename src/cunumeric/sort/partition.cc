@@ -0,0 +1,55 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/sort/partition.h"
+#include "cunumeric/sort/partition_template.inl"
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <Type::Code CODE, int32_t DIM>
+struct PartitionImplBody<VariantKind::CPU, CODE, DIM> {
+  using VAL = legate_type_of<CODE>;
+
+  template <bool ARGPARTITION, typename OUT>
+  void operator()(const RowAccessor<const VAL, DIM>& in,
+                  const RowAccessor<OUT, DIM>& out,
+                  const RowPitches<DIM>& rows,
+                  size_t num_rows,
+                  const Span<const int64_t>& kth) const
+  {
+    std::vector<VAL> values;
+    std::vector<int64_t> indices;
+    for (size_t row = 0; row < num_rows; ++row)
+      partition_row<ARGPARTITION>(in, out, rows, row, kth, values, indices);
+  }
+};
+
+/*static*/ void PartitionTask::cpu_variant(TaskContext& context)
+{
+  partition_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void)
+{
+  PartitionTask::register_variants();
+}
+}  // namespace
+
+}  // namespace cunumeric
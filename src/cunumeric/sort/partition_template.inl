@@ -0,0 +1,120 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/sort/partition.h"
+#include "cunumeric/row_pitches.h"
+#include "cunumeric/unary/isnan.h"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <VariantKind KIND, Type::Code CODE, int32_t DIM>
+struct PartitionImplBody;
+
+// Moves each kth element of [begin, end) to its sorted position, with no
+// larger elements before it and no smaller ones after it. As kth is sorted,
+// each selection only needs to look at the elements after the previous one.
+// The comparison must be a strict weak ordering, so NaNs are ordered last.
+template <typename ITER, typename CMP>
+void select_kth(ITER begin, ITER end, const Span<const int64_t>& kth, CMP cmp)
+{
+  ITER first = begin;
+  for (auto k : kth) {
+    std::nth_element(first, begin + k, end, cmp);
+    first = begin + k + 1;
+  }
+}
+
+// Partitions a segment, which is a row along the last dimension, writing
+// either the partitioned values or the indices that partition them
+template <bool ARGPARTITION, typename VAL, typename OUT, int32_t DIM>
+void partition_row(const RowAccessor<const VAL, DIM>& in,
+                   const RowAccessor<OUT, DIM>& out,
+                   const RowPitches<DIM>& rows,
+                   size_t row,
+                   const Span<const int64_t>& kth,
+                   std::vector<VAL>& values,
+                   std::vector<int64_t>& indices)
+{
+  const auto offset   = rows.row_offset(row);
+  auto inrow          = in[offset];
+  auto outrow         = out[offset];
+  const size_t length = rows.row_length(row);
+
+  values.resize(length);
+  for (size_t idx = 0; idx < length; ++idx) values[idx] = inrow[idx];
+
+  if constexpr (ARGPARTITION) {
+    indices.resize(length);
+    std::iota(indices.begin(), indices.end(), 0);
+    select_kth(indices.begin(), indices.end(), kth, [&values](int64_t lhs, int64_t rhs) {
+      return NanLastLess<VAL>{}(values[lhs], values[rhs]);
+    });
+    for (size_t idx = 0; idx < length; ++idx) outrow[idx] = indices[idx];
+  } else {
+    select_kth(values.begin(), values.end(), kth, NanLastLess<VAL>{});
+    for (size_t idx = 0; idx < length; ++idx) outrow[idx] = values[idx];
+  }
+}
+
+template <VariantKind KIND>
+struct PartitionImpl {
+  template <Type::Code CODE, int32_t DIM>
+  void operator()(PartitionArgs& args) const
+  {
+    using VAL = legate_type_of<CODE>;
+
+    // Segments are never split across tasks, so each row of the rectangle
+    // is a whole segment
+    auto rect = args.input.shape<DIM>();
+
+    RowPitches<DIM> rows;
+    const size_t num_rows = rows.flatten(rect);
+    if (num_rows == 0) return;
+
+    RowAccessor<const VAL, DIM> in(args.input.read_accessor<VAL, DIM>(rect), rect);
+    if (args.argpartition) {
+      RowAccessor<int64_t, DIM> out(args.output.write_accessor<int64_t, DIM>(rect), rect);
+      PartitionImplBody<KIND, CODE, DIM>().template operator()<true>(
+        in, out, rows, num_rows, args.kth);
+    } else {
+      RowAccessor<VAL, DIM> out(args.output.write_accessor<VAL, DIM>(rect), rect);
+      PartitionImplBody<KIND, CODE, DIM>().template operator()<false>(
+        in, out, rows, num_rows, args.kth);
+    }
+  }
+};
+
+template <VariantKind KIND>
+static void partition_template(TaskContext& context)
+{
+  auto& scalars = context.scalars();
+  PartitionArgs args{context.inputs()[0],
+                     context.outputs()[0],
+                     scalars[0].value<bool>(),  // argpartition
+                     scalars[1].values<int64_t>()};
+  double_dispatch(args.input.dim(), args.input.code(), PartitionImpl<KIND>{}, args);
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,91 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cunumeric/cunumeric.h"
+#include "cunumeric/unary/isnan.h"
+
+#include <cstring>
+#include <type_traits>
+
+namespace cunumeric {
+
+// Order-preserving mapping of values to unsigned integers of the same width,
+// so that values can be ranked one digit at a time. Signed integers have
+// their sign bit flipped. Floating-point values have their sign bit flipped
+// when positive and all bits flipped when negative. As in NumPy's sort order,
+// -0.0 has the key of +0.0 and all NaNs have the largest key, so that sorts
+// are stable across them and NaNs come after +inf regardless of their sign.
+
+// Number of bits in a radix digit
+constexpr int32_t RADIX_BITS = 8;
+constexpr size_t RADIX_BINS  = size_t{1} << RADIX_BITS;
+
+template <legate::Type::Code CODE>
+struct is_radix_key {
+  static constexpr bool value =
+    legate::is_integral<CODE>::value || legate::is_floating_point<CODE>::value;
+};
+
+template <typename VAL>
+constexpr bool has_radix_key = std::is_integral<VAL>::value ||
+                               std::is_floating_point<VAL>::value ||
+                               std::is_same<VAL, __half>::value;
+
+template <size_t SIZE>
+struct radix_key_type;
+template <>
+struct radix_key_type<1> {
+  using type = uint8_t;
+};
+template <>
+struct radix_key_type<2> {
+  using type = uint16_t;
+};
+template <>
+struct radix_key_type<4> {
+  using type = uint32_t;
+};
+template <>
+struct radix_key_type<8> {
+  using type = uint64_t;
+};
+
+template <typename VAL>
+struct RadixKey {
+  using KEY                     = typename radix_key_type<sizeof(VAL)>::type;
+  static constexpr int32_t BITS = 8 * sizeof(VAL);
+  static constexpr KEY SIGN     = static_cast<KEY>(KEY{1} << (BITS - 1));
+
+  __CUDA_HD__ static inline KEY encode(const VAL& value)
+  {
+    if constexpr (std::is_integral<VAL>::value) {
+      if constexpr (std::is_signed<VAL>::value)
+        return static_cast<KEY>(value) ^ SIGN;
+      else
+        return static_cast<KEY>(value);
+    } else {
+      if (is_nan(value)) return static_cast<KEY>(~KEY{0});
+      KEY bits;
+      memcpy(&bits, &value, sizeof(KEY));
+      if (bits == SIGN) bits = 0;
+      return (bits & SIGN) ? static_cast<KEY>(~bits) : static_cast<KEY>(bits | SIGN);
+    }
+  }
+};
+
+}  // namespace cunumeric
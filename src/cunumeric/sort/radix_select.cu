@@ -0,0 +1,111 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/sort/radix_select.h"
+#include "cunumeric/sort/radix_select_template.inl"
+
+#include "cunumeric/cuda_help.h"
+
+namespace cunumeric {
+
+using namespace legate;
+
+// Each block counts its elements in shared memory and then adds its counts to
+// the output, so that only one atomic per bin and block goes to global memory
+
+static __device__ inline void clear_bins(unsigned long long* bins)
+{
+  for (size_t bin = threadIdx.x; bin < RADIX_BINS; bin += blockDim.x) bins[bin] = 0;
+  __syncthreads();
+}
+
+static __device__ inline void flush_bins(AccessorRD<SumReduction<int64_t>, false, 1> counts,
+                                         const unsigned long long* bins)
+{
+  __syncthreads();
+  for (size_t bin = threadIdx.x; bin < RADIX_BINS; bin += blockDim.x)
+    if (bins[bin] > 0) counts.reduce(bin, static_cast<int64_t>(bins[bin]));
+}
+
+template <typename VAL>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  dense_kernel(AccessorRD<SumReduction<int64_t>, false, 1> counts,
+               const VAL* in,
+               RadixDigit<VAL> digit,
+               size_t volume)
+{
+  __shared__ unsigned long long bins[RADIX_BINS];
+  clear_bins(bins);
+  const size_t stride = static_cast<size_t>(blockDim.x) * gridDim.x;
+  for (size_t idx = global_tid_1d(); idx < volume; idx += stride) {
+    const auto bin = digit(in[idx]);
+    if (bin >= 0) atomicAdd(&bins[bin], 1ULL);
+  }
+  flush_bins(counts, bins);
+}
+
+template <typename VAL, int DIM>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  generic_kernel(AccessorRD<SumReduction<int64_t>, false, 1> counts,
+                 AccessorRO<VAL, DIM> in,
+                 RadixDigit<VAL> digit,
+                 Pitches<DIM - 1> pitches,
+                 Point<DIM> origin,
+                 size_t volume)
+{
+  __shared__ unsigned long long bins[RADIX_BINS];
+  clear_bins(bins);
+  const size_t stride = static_cast<size_t>(blockDim.x) * gridDim.x;
+  for (size_t idx = global_tid_1d(); idx < volume; idx += stride) {
+    auto p         = pitches.unflatten(idx, origin);
+    const auto bin = digit(in[p]);
+    if (bin >= 0) atomicAdd(&bins[bin], 1ULL);
+  }
+  flush_bins(counts, bins);
+}
+
+template <Type::Code CODE, int32_t DIM>
+struct RadixSelectImplBody<VariantKind::GPU, CODE, DIM> {
+  using VAL = legate_type_of<CODE>;
+
+  void operator()(AccessorRD<SumReduction<int64_t>, false, 1> counts,
+                  const AccessorRO<VAL, DIM>& in,
+                  const RadixDigit<VAL>& digit,
+                  const Pitches<DIM - 1>& pitches,
+                  const Rect<DIM>& rect,
+                  size_t volume,
+                  bool dense) const
+  {
+    auto stream         = get_cached_stream();
+    const size_t blocks = std::min<size_t>((volume + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK,
+                                           MAX_REDUCTION_CTAS);
+    if (dense) {
+      auto inptr = in.ptr(rect);
+      dense_kernel<VAL><<<blocks, THREADS_PER_BLOCK, 0, stream>>>(counts, inptr, digit, volume);
+    } else {
+      generic_kernel<VAL, DIM>
+        <<<blocks, THREADS_PER_BLOCK, 0, stream>>>(counts, in, digit, pitches, rect.lo, volume);
+    }
+    CHECK_CUDA_STREAM(stream);
+  }
+};
+
+/*static*/ void RadixSelectTask::gpu_variant(TaskContext& context)
+{
+  radix_select_template<VariantKind::GPU>(context);
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,67 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cunumeric/cunumeric.h"
+#include "cunumeric/sort/radix_key.h"
+
+namespace cunumeric {
+
+struct RadixSelectArgs {
+  const Array& input;
+  const Array& counts;
+  uint64_t prefix;
+  int32_t shift;
+};
+
+// Digit of the key of a value at the given shift, or -1 if the digits of the
+// key above it don't match the prefix
+template <typename VAL>
+struct RadixDigit {
+  using KEY = typename RadixKey<VAL>::KEY;
+
+  __CUDA_HD__ inline int32_t operator()(const VAL& value) const
+  {
+    const KEY key = RadixKey<VAL>::encode(value);
+    if (shift + RADIX_BITS < RadixKey<VAL>::BITS && (key >> (shift + RADIX_BITS)) != prefix)
+      return -1;
+    return static_cast<int32_t>((key >> shift) & (RADIX_BINS - 1));
+  }
+
+  uint64_t prefix;
+  int32_t shift;
+};
+
+// Counts the elements by one digit of their radix keys, among the elements
+// whose keys start with a given prefix. This is one round of a radix select
+// that finds the element of a given rank in a distributed array one digit at
+// a time, without moving any data.
+class RadixSelectTask : public CuNumericTask<RadixSelectTask> {
+ public:
+  static const int TASK_ID = CUNUMERIC_RADIX_SELECT;
+
+ public:
+  static void cpu_variant(legate::TaskContext& context);
+#ifdef LEGATE_USE_OPENMP
+  static void omp_variant(legate::TaskContext& context);
+#endif
+#ifdef LEGATE_USE_CUDA
+  static void gpu_variant(legate::TaskContext& context);
+#endif
+};
+
+}  // namespace cunumeric
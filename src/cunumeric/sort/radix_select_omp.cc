@@ -0,0 +1,72 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/sort/radix_select.h"
+#include "cunumeric/sort/radix_select_template.inl"
+
+#include <omp.h>
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <Type::Code CODE, int32_t DIM>
+struct RadixSelectImplBody<VariantKind::OMP, CODE, DIM> {
+  using VAL = legate_type_of<CODE>;
+
+  void operator()(AccessorRD<SumReduction<int64_t>, true, 1> counts,
+                  const AccessorRO<VAL, DIM>& in,
+                  const RadixDigit<VAL>& digit,
+                  const Pitches<DIM - 1>& pitches,
+                  const Rect<DIM>& rect,
+                  size_t volume,
+                  bool dense) const
+  {
+    const auto max_threads = omp_get_max_threads();
+    std::vector<int64_t> all_bins(max_threads * RADIX_BINS, 0);
+#pragma omp parallel
+    {
+      int64_t* bins = all_bins.data() + omp_get_thread_num() * RADIX_BINS;
+      if (dense) {
+        auto inptr = in.ptr(rect);
+#pragma omp for schedule(static)
+        for (size_t idx = 0; idx < volume; ++idx) {
+          const auto bin = digit(inptr[idx]);
+          if (bin >= 0) ++bins[bin];
+        }
+      } else {
+#pragma omp for schedule(static)
+        for (size_t idx = 0; idx < volume; ++idx) {
+          auto p         = pitches.unflatten(idx, rect.lo);
+          const auto bin = digit(in[p]);
+          if (bin >= 0) ++bins[bin];
+        }
+      }
+    }
+    for (size_t bin = 0; bin < RADIX_BINS; ++bin) {
+      int64_t count = 0;
+      for (int32_t tid = 0; tid < max_threads; ++tid) count += all_bins[tid * RADIX_BINS + bin];
+      if (count > 0) counts.reduce(bin, count);
+    }
+  }
+};
+
+/*static*/ void RadixSelectTask::omp_variant(TaskContext& context)
+{
+  radix_select_template<VariantKind::OMP>(context);
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,78 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/sort/radix_select.h"
+#include "cunumeric/pitches.h"
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <VariantKind KIND, Type::Code CODE, int32_t DIM>
+struct RadixSelectImplBody;
+
+template <VariantKind KIND>
+struct RadixSelectImpl {
+  template <Type::Code CODE, int32_t DIM, std::enable_if_t<is_radix_key<CODE>::value>* = nullptr>
+  void operator()(RadixSelectArgs& args) const
+  {
+    using VAL = legate_type_of<CODE>;
+
+    auto rect = args.input.shape<DIM>();
+
+    Pitches<DIM - 1> pitches;
+    size_t volume = pitches.flatten(rect);
+    if (volume == 0) return;
+
+    auto in = args.input.read_accessor<VAL, DIM>(rect);
+    auto counts_rect = args.counts.shape<1>();
+    auto counts =
+      args.counts.reduce_accessor<SumReduction<int64_t>, KIND != VariantKind::GPU, 1>(counts_rect);
+
+#ifndef LEGATE_BOUNDS_CHECKS
+    // Check to see if this is dense or not
+    bool dense = in.accessor.is_dense_row_major(rect);
+#else
+    // No dense execution if we're doing bounds checks
+    bool dense = false;
+#endif
+
+    RadixDigit<VAL> digit{args.prefix, args.shift};
+    RadixSelectImplBody<KIND, CODE, DIM>()(counts, in, digit, pitches, rect, volume, dense);
+  }
+
+  template <Type::Code CODE, int32_t DIM, std::enable_if_t<!is_radix_key<CODE>::value>* = nullptr>
+  void operator()(RadixSelectArgs& args) const
+  {
+    assert(false);
+  }
+};
+
+template <VariantKind KIND>
+static void radix_select_template(TaskContext& context)
+{
+  auto& scalars = context.scalars();
+  RadixSelectArgs args{context.inputs()[0],
+                       context.reductions()[0],
+                       scalars[0].value<uint64_t>(),  // prefix
+                       scalars[1].value<int32_t>()};  // shift
+  double_dispatch(args.input.dim(), args.input.code(), RadixSelectImpl<KIND>{}, args);
+}
+
+}  // namespace cunumeric
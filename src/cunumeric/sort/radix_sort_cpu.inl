@@ -0,0 +1,124 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cunumeric/sort/radix_key.h"
+
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace cunumeric {
+
+// Segments shorter than this are sorted by comparisons, as the fixed cost of
+// the histograms of a radix sort doesn't pay off for them
+constexpr size_t RADIX_SORT_MIN_SIZE = 1 << 12;
+// Each pass of a radix sort splits the data into chunks of about this many
+// elements, up to a maximum number of chunks, which are counted and
+// scattered in parallel
+constexpr size_t RADIX_SORT_CHUNK_SIZE = 1 << 11;
+constexpr size_t RADIX_SORT_MAX_CHUNKS = 256;
+
+// Stable least significant digit radix sort of values[0, size), which
+// permutes the indices along if they are not null. The temporaries provide
+// scratch space for size values and indices. Passes in which all keys have
+// the same digit, such as the upper bytes of timestamps, are skipped.
+template <typename VAL, typename DerivedPolicy>
+void radix_sort_inplace(VAL* values,
+                        int64_t* indices,
+                        const size_t size,
+                        VAL* values_tmp,
+                        int64_t* indices_tmp,
+                        const DerivedPolicy& exec)
+{
+  using Key = RadixKey<VAL>;
+
+  // Rounded up, so that segments just above the minimum size are split too
+  const size_t num_chunks =
+    std::min(std::max<size_t>((size + RADIX_SORT_CHUNK_SIZE - 1) / RADIX_SORT_CHUNK_SIZE, 1),
+             RADIX_SORT_MAX_CHUNKS);
+  const size_t chunk_size = (size + num_chunks - 1) / num_chunks;
+
+  // Digit counts of each chunk, which are then turned into the positions
+  // where each chunk writes its elements with each digit
+  std::vector<size_t> positions(num_chunks * RADIX_BINS);
+  size_t* positions_ptr = positions.data();
+
+  VAL* src_values      = values;
+  VAL* dst_values      = values_tmp;
+  int64_t* src_indices = indices;
+  int64_t* dst_indices = indices_tmp;
+
+  for (int32_t shift = 0; shift < Key::BITS; shift += RADIX_BITS) {
+    auto digit = [shift](const VAL& value) {
+      return static_cast<size_t>((Key::encode(value) >> shift) & (RADIX_BINS - 1));
+    };
+
+    thrust::for_each(exec,
+                     thrust::make_counting_iterator<size_t>(0),
+                     thrust::make_counting_iterator<size_t>(num_chunks),
+                     [=](size_t chunk) {
+                       size_t* counts = positions_ptr + chunk * RADIX_BINS;
+                       std::fill(counts, counts + RADIX_BINS, 0);
+                       const size_t lo = chunk * chunk_size;
+                       const size_t hi = std::min(lo + chunk_size, size);
+                       for (size_t idx = lo; idx < hi; ++idx) ++counts[digit(src_values[idx])];
+                     });
+
+    // Elements with smaller digits go first, and among those with the same
+    // digit, elements of earlier chunks do
+    bool skip       = false;
+    size_t position = 0;
+    for (size_t bin = 0; bin < RADIX_BINS; ++bin) {
+      const size_t first = position;
+      for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+        size_t& slot       = positions[chunk * RADIX_BINS + bin];
+        const size_t count = slot;
+        slot               = position;
+        position += count;
+      }
+      skip = skip || position - first == size;
+    }
+    if (skip) continue;
+
+    thrust::for_each(exec,
+                     thrust::make_counting_iterator<size_t>(0),
+                     thrust::make_counting_iterator<size_t>(num_chunks),
+                     [=](size_t chunk) {
+                       size_t* chunk_positions = positions_ptr + chunk * RADIX_BINS;
+                       const size_t lo         = chunk * chunk_size;
+                       const size_t hi         = std::min(lo + chunk_size, size);
+                       for (size_t idx = lo; idx < hi; ++idx) {
+                         const size_t pos = chunk_positions[digit(src_values[idx])]++;
+                         dst_values[pos]  = src_values[idx];
+                         if (src_indices != nullptr) dst_indices[pos] = src_indices[idx];
+                       }
+                     });
+    std::swap(src_values, dst_values);
+    std::swap(src_indices, dst_indices);
+  }
+
+  if (src_values != values) {
+    thrust::copy(exec, src_values, src_values + size, values);
+    if (indices != nullptr) thrust::copy(exec, src_indices, src_indices + size, indices);
+  }
+}
+
+}  // namespace cunumeric
@@ -52,7 +52,8 @@ struct SearchSortedImplBody<VariantKind::CPU, CODE, DIM> {
       for (size_t idx = 0; idx < num_values; ++idx) {
         VAL key             = input_v_ptr[idx];
         auto v_point        = pitches.unflatten(idx, rect_values.lo);
-        int64_t lower_bound = std::lower_bound(input_ptr, input_ptr + volume, key) - input_ptr;
+        int64_t lower_bound =
+          std::lower_bound(input_ptr, input_ptr + volume, key, NanLastLess<VAL>{}) - input_ptr;
         if (lower_bound < volume) { output_reduction.reduce(v_point, lower_bound + offset); }
       }
     } else {
@@ -61,7 +62,8 @@ struct SearchSortedImplBody<VariantKind::CPU, CODE, DIM> {
       for (size_t idx = 0; idx < num_values; ++idx) {
         VAL key             = input_v_ptr[idx];
         auto v_point        = pitches.unflatten(idx, rect_values.lo);
-        int64_t upper_bound = std::upper_bound(input_ptr, input_ptr + volume, key) - input_ptr;
+        int64_t upper_bound =
+          std::upper_bound(input_ptr, input_ptr + volume, key, NanLastLess<VAL>{}) - input_ptr;
         if (upper_bound > 0) { output_reduction.reduce(v_point, upper_bound + offset); }
       }
     }
@@ -16,7 +16,8 @@
 
 #include "cunumeric/sort/searchsorted.h"
 #include "cunumeric/sort/searchsorted_template.inl"
-#include <cub/thread/thread_search.cuh>
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
 
 #include "cunumeric/cuda_help.h"
 
@@ -38,7 +39,10 @@ static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
   if (v_idx >= num_values) return;
 
   auto v_point        = pitches.unflatten(v_idx, lo);
-  int64_t lower_bound = cub::LowerBound(sorted_array.ptr(global_offset), volume, values[v_point]);
+  const VAL* sorted   = sorted_array.ptr(global_offset);
+  const VAL key       = values[v_point];
+  int64_t lower_bound =
+    thrust::lower_bound(thrust::seq, sorted, sorted + volume, key, NanLastLess<VAL>{}) - sorted;
 
   if (lower_bound < volume) { output_reduction.reduce(v_point, lower_bound + global_offset); }
 }
@@ -59,7 +63,10 @@ static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
   if (v_idx >= num_values) return;
 
   auto v_point        = pitches.unflatten(v_idx, lo);
-  int64_t upper_bound = cub::UpperBound(sorted_array.ptr(global_offset), volume, values[v_point]);
+  const VAL* sorted   = sorted_array.ptr(global_offset);
+  const VAL key       = values[v_point];
+  int64_t upper_bound =
+    thrust::upper_bound(thrust::seq, sorted, sorted + volume, key, NanLastLess<VAL>{}) - sorted;
 
   if (upper_bound > 0) { output_reduction.reduce(v_point, upper_bound + global_offset); }
 }
@@ -0,0 +1,49 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "cunumeric/sort/searchsorted_merge.h"
+#include "cunumeric/sort/searchsorted_merge_template.inl"
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <Type::Code CODE>
+struct SearchSortedMergeImplBody<VariantKind::CPU, CODE> {
+  using VAL = legate_type_of<CODE>;
+
+  void operator()(const MergeRows<VAL>& rows, size_t num_rows) const
+  {
+    for (size_t row = 0; row < num_rows; ++row) {
+      auto merge = rows[row];
+      merge.merge(0, merge.size());
+    }
+  }
+};
+
+/*static*/ void SearchSortedMergeTask::cpu_variant(TaskContext& context)
+{
+  searchsorted_merge_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void)
+{
+  SearchSortedMergeTask::register_variants();
+}
+}  // namespace
+
+}  // namespace cunumeric
@@ -0,0 +1,65 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "cunumeric/sort/searchsorted_merge.h"
+#include "cunumeric/sort/searchsorted_merge_template.inl"
+
+#include "cunumeric/cuda_help.h"
+
+namespace cunumeric {
+
+// Number of elements of the merged order that a thread walks
+constexpr int64_t MERGE_ITEMS_PER_THREAD = 16;
+
+template <typename VAL>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  searchsorted_merge_kernel(const MergeRows<VAL> rows, size_t row_chunks, size_t total_chunks)
+{
+  const size_t idx = global_tid_1d();
+  if (idx >= total_chunks) return;
+
+  auto merge          = rows[idx / row_chunks];
+  const int64_t size  = merge.size();
+  const int64_t first = (idx % row_chunks) * MERGE_ITEMS_PER_THREAD;
+  const int64_t last  = first + MERGE_ITEMS_PER_THREAD;
+  if (first < size) merge.merge(first, last < size ? last : size);
+}
+
+template <Type::Code CODE>
+struct SearchSortedMergeImplBody<VariantKind::GPU, CODE> {
+  using VAL = legate_type_of<CODE>;
+
+  void operator()(const MergeRows<VAL>& rows, size_t num_rows) const
+  {
+    // Every row is cut along its merge path into runs of the same length,
+    // each of which a thread locates by a binary search and then merges
+    const int64_t max_size    = 2 * rows.width;
+    const size_t row_chunks   = (max_size + MERGE_ITEMS_PER_THREAD - 1) / MERGE_ITEMS_PER_THREAD;
+    const size_t total_chunks = num_rows * row_chunks;
+    const size_t blocks       = (total_chunks + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+
+    auto stream = get_cached_stream();
+    searchsorted_merge_kernel<VAL>
+      <<<blocks, THREADS_PER_BLOCK, 0, stream>>>(rows, row_chunks, total_chunks);
+    CHECK_CUDA_STREAM(stream);
+  }
+};
+
+/*static*/ void SearchSortedMergeTask::gpu_variant(TaskContext& context)
+{
+  searchsorted_merge_template<VariantKind::GPU>(context);
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,48 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#pragma once
+
+#include "cunumeric/cunumeric.h"
+
+namespace cunumeric {
+
+struct SearchSortedMergeArgs {
+  const Array& haystack;
+  const Array& needles;
+  const Array& offsets;
+  const Array& lengths;
+  const Array& output;
+  bool left;
+};
+
+// Finds the insertion points of sorted needles in a sorted array by merging
+// them. Each row holds a window of the sorted array and the needles whose
+// insertion points fall in it, so rows are merged independently.
+class SearchSortedMergeTask : public CuNumericTask<SearchSortedMergeTask> {
+ public:
+  static const int TASK_ID = CUNUMERIC_SEARCHSORTED_MERGE;
+
+ public:
+  static void cpu_variant(legate::TaskContext& context);
+#ifdef LEGATE_USE_OPENMP
+  static void omp_variant(legate::TaskContext& context);
+#endif
+#ifdef LEGATE_USE_CUDA
+  static void gpu_variant(legate::TaskContext& context);
+#endif
+};
+
+}  // namespace cunumeric
@@ -0,0 +1,56 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "cunumeric/sort/searchsorted_merge.h"
+#include "cunumeric/sort/searchsorted_merge_template.inl"
+
+#include <omp.h>
+
+#include <algorithm>
+
+namespace cunumeric {
+
+using namespace legate;
+
+// Number of elements of the merged order that an OpenMP thread walks at once
+constexpr int64_t MERGE_CHUNK_SIZE = 1 << 14;
+
+template <Type::Code CODE>
+struct SearchSortedMergeImplBody<VariantKind::OMP, CODE> {
+  using VAL = legate_type_of<CODE>;
+
+  void operator()(const MergeRows<VAL>& rows, size_t num_rows) const
+  {
+    // Every row is cut along its merge path into chunks of the same size,
+    // which threads merge independently after locating their start
+    const int64_t max_size    = 2 * rows.width;
+    const size_t row_chunks   = (max_size + MERGE_CHUNK_SIZE - 1) / MERGE_CHUNK_SIZE;
+    const size_t total_chunks = num_rows * row_chunks;
+#pragma omp parallel for schedule(dynamic)
+    for (size_t idx = 0; idx < total_chunks; ++idx) {
+      auto merge          = rows[idx / row_chunks];
+      const int64_t first = (idx % row_chunks) * MERGE_CHUNK_SIZE;
+      const int64_t last  = std::min(first + MERGE_CHUNK_SIZE, merge.size());
+      if (first < last) merge.merge(first, last);
+    }
+  }
+};
+
+/*static*/ void SearchSortedMergeTask::omp_variant(TaskContext& context)
+{
+  searchsorted_merge_template<VariantKind::OMP>(context);
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,150 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/sort/searchsorted_merge.h"
+#include "cunumeric/row_pitches.h"
+#include "cunumeric/unary/isnan.h"
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <VariantKind KIND, Type::Code CODE>
+struct SearchSortedMergeImplBody;
+
+// Merge of one row: a window of the sorted array, which starts at the given
+// offset in it and whose first length elements are valid, and a run of
+// sorted needles. In the merged order, a needle goes before the elements of
+// the window equal to it for side="left" and after them for side="right",
+// and its insertion point is the number of window elements before it. NaNs
+// are ordered last, as in NumPy.
+template <typename VAL>
+struct MergeRow {
+  RowView<const VAL> haystack;
+  int64_t hay_size;
+  RowView<const VAL> needles;
+  int64_t num_needles;
+  RowView<int64_t> points;
+  int64_t offset;
+  bool left;
+
+  // Whether an element of the window goes before a needle
+  __CUDA_HD__ inline bool hay_first(const VAL& hay, const VAL& needle) const
+  {
+    return left ? NanLastLess<VAL>{}(hay, needle) : !NanLastLess<VAL>{}(needle, hay);
+  }
+
+  __CUDA_HD__ inline int64_t size() const { return hay_size + num_needles; }
+
+  // Number of needles among the first diag elements of the merged order,
+  // found by a binary search along the diagonal of the merge path
+  __CUDA_HD__ inline int64_t split(int64_t diag) const
+  {
+    int64_t lo = diag > hay_size ? diag - hay_size : 0;
+    int64_t hi = diag < num_needles ? diag : num_needles;
+    while (lo < hi) {
+      const int64_t mid = (lo + hi) / 2;
+      if (hay_first(haystack[diag - 1 - mid], needles[mid]))
+        hi = mid;
+      else
+        lo = mid + 1;
+    }
+    return lo;
+  }
+
+  // Walks the elements [first, last) of the merged order, writing the
+  // insertion points of the needles among them
+  __CUDA_HD__ inline void merge(int64_t first, int64_t last) const
+  {
+    int64_t needle = split(first);
+    int64_t hay    = first - needle;
+    for (int64_t diag = first; diag < last; ++diag) {
+      if (needle < num_needles && (hay >= hay_size || !hay_first(haystack[hay], needles[needle])))
+        points[needle++] = offset + hay;
+      else
+        ++hay;
+    }
+  }
+};
+
+template <typename VAL>
+struct MergeRows {
+  RowAccessor<const VAL, 2> haystack;
+  RowAccessor<const VAL, 2> needles;
+  RowAccessor<const int64_t, 2> offsets;
+  RowAccessor<const int64_t, 2> lengths;
+  RowAccessor<int64_t, 2> points;
+  RowPitches<2> pitches;
+  int64_t width;
+  bool left;
+
+  __CUDA_HD__ inline MergeRow<VAL> operator[](size_t row) const
+  {
+    const auto offset = pitches.row_offset(row);
+    return MergeRow<VAL>{haystack[offset],
+                         lengths[offset][0],
+                         needles[offset],
+                         width,
+                         points[offset],
+                         offsets[offset][0],
+                         left};
+  }
+};
+
+template <VariantKind KIND>
+struct SearchSortedMergeImpl {
+  template <Type::Code CODE>
+  void operator()(SearchSortedMergeArgs& args) const
+  {
+    using VAL = legate_type_of<CODE>;
+
+    // Rows are never split across tasks
+    auto rect = args.needles.shape<2>();
+
+    MergeRows<VAL> rows;
+    const size_t num_rows = rows.pitches.flatten(rect);
+    if (num_rows == 0) return;
+
+    rows.haystack = RowAccessor<const VAL, 2>(args.haystack.read_accessor<VAL, 2>(rect), rect);
+    rows.needles  = RowAccessor<const VAL, 2>(args.needles.read_accessor<VAL, 2>(rect), rect);
+    rows.offsets =
+      RowAccessor<const int64_t, 2>(args.offsets.read_accessor<int64_t, 2>(rect), rect);
+    rows.lengths =
+      RowAccessor<const int64_t, 2>(args.lengths.read_accessor<int64_t, 2>(rect), rect);
+    rows.points = RowAccessor<int64_t, 2>(args.output.write_accessor<int64_t, 2>(rect), rect);
+    rows.width  = rect.hi[1] - rect.lo[1] + 1;
+    rows.left   = args.left;
+
+    SearchSortedMergeImplBody<KIND, CODE>()(rows, num_rows);
+  }
+};
+
+template <VariantKind KIND>
+static void searchsorted_merge_template(TaskContext& context)
+{
+  auto& inputs = context.inputs();
+  SearchSortedMergeArgs args{inputs[0],
+                             inputs[1],
+                             inputs[2],
+                             inputs[3],
+                             context.outputs()[0],
+                             context.scalars()[0].value<bool>()};
+  type_dispatch(args.needles.code(), SearchSortedMergeImpl<KIND>{}, args);
+}
+
+}  // namespace cunumeric
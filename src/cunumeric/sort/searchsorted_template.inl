@@ -19,6 +19,7 @@
 // Useful for IDEs
 #include "cunumeric/sort/searchsorted.h"
 #include "cunumeric/pitches.h"
+#include "cunumeric/unary/isnan.h"
 
 namespace cunumeric {
 
@@ -28,6 +28,10 @@ namespace cunumeric {
 
 using namespace legate;
 
+static Logger log_sort("cunumeric.sort");
+
+Logger& sort_log() { return log_sort; }
+
 template <Type::Code CODE, int32_t DIM>
 struct SortImplBody<VariantKind::CPU, CODE, DIM> {
   using VAL = legate_type_of<CODE>;
@@ -45,6 +49,7 @@ struct SortImplBody<VariantKind::CPU, CODE, DIM> {
                   const size_t local_rank,
                   const size_t num_ranks,
                   const size_t num_sort_ranks,
+                  const size_t oversampling,
                   const std::vector<comm::Communicator>& comms)
   {
     SortImplBodyCpu<CODE, DIM>()(input_array,
@@ -60,6 +65,7 @@ struct SortImplBody<VariantKind::CPU, CODE, DIM> {
                                  local_rank,
                                  num_ranks,
                                  num_sort_ranks,
+                                 oversampling,
                                  thrust::host,
                                  comms);
   }
@@ -15,9 +15,9 @@
  */
 
 #include "cunumeric/sort/sort.h"
+#include "cunumeric/sort/sort_stats.h"
 #include "cunumeric/sort/sort_template.inl"
-#include "cunumeric/sort/cub_sort.h"
-#include "cunumeric/sort/thrust_sort.h"
+#include "cunumeric/sort/local_sort.cuh"
 #include "cunumeric/utilities/thrust_allocator.h"
 #include "cunumeric/utilities/thrust_util.h"
 
@@ -35,55 +35,8 @@
 
 #include "cunumeric/cuda_help.h"
 
-// above this threshold segment sort will be performed
-// by cub::DeviceSegmentedRadixSort instead of thrust::(stable_)sort
-// with tuple keys (not available for complex)
-#define SEGMENT_THRESHOLD_RADIX_SORT 400
-
 namespace cunumeric {
 
-template <Type::Code CODE>
-struct support_cub : std::true_type {};
-template <>
-struct support_cub<Type::Code::COMPLEX64> : std::false_type {};
-template <>
-struct support_cub<Type::Code::COMPLEX128> : std::false_type {};
-
-template <Type::Code CODE, std::enable_if_t<support_cub<CODE>::value>* = nullptr>
-void local_sort(const legate_type_of<CODE>* values_in,
-                legate_type_of<CODE>* values_out,
-                const int64_t* indices_in,
-                int64_t* indices_out,
-                const size_t volume,
-                const size_t sort_dim_size,
-                const bool stable,  // cub sort is always stable
-                cudaStream_t stream)
-{
-  using VAL = legate_type_of<CODE>;
-  // fallback to thrust approach as segmented radix sort is not suited for small segments
-  if (volume == sort_dim_size || sort_dim_size > SEGMENT_THRESHOLD_RADIX_SORT) {
-    cub_local_sort(values_in, values_out, indices_in, indices_out, volume, sort_dim_size, stream);
-  } else {
-    thrust_local_sort(
-      values_in, values_out, indices_in, indices_out, volume, sort_dim_size, stable, stream);
-  }
-}
-
-template <Type::Code CODE, std::enable_if_t<!support_cub<CODE>::value>* = nullptr>
-void local_sort(const legate_type_of<CODE>* values_in,
-                legate_type_of<CODE>* values_out,
-                const int64_t* indices_in,
-                int64_t* indices_out,
-                const size_t volume,
-                const size_t sort_dim_size,
-                const bool stable,
-                cudaStream_t stream)
-{
-  using VAL = legate_type_of<CODE>;
-  thrust_local_sort(
-    values_in, values_out, indices_in, indices_out, volume, sort_dim_size, stable, stream);
-}
-
 // auto align to multiples of 16 bytes
 auto get_16b_aligned = [](auto bytes) { return std::max<size_t>(16, (bytes + 15) / 16 * 16); };
 auto get_16b_aligned_count = [](auto count, auto element_bytes) {
@@ -764,6 +717,7 @@ void rebalance_data(SegmentMergePiece<VAL>& merge_buffer,
                     size_t num_segments_l,
                     /* other */
                     bool argsort,
+                    SampleSortStats& stats,
                     ThrustAllocator& alloc,
                     cudaStream_t stream,
                     ncclComm_t* comm)
@@ -928,6 +882,10 @@ void rebalance_data(SegmentMergePiece<VAL>& merge_buffer,
                                                       negative_value(),
                                                       0,
                                                       thrust::plus<int64_t>());
+    const size_t bytesize = argsort ? sizeof(int64_t) : sizeof(VAL);
+    stats.exchanged((send_left_size + send_right_size) * bytesize,
+                    (recv_left_size + recv_right_size) * bytesize);
+
     SortPiece<VAL> send_left_data, recv_left_data, send_right_data, recv_right_data;
     send_left_data.size  = send_left_size;
     recv_left_data.size  = recv_left_size;
@@ -1200,6 +1158,7 @@ void sample_sort_nccl_nd(SortPiece<legate_type_of<CODE>> local_sorted,
                          size_t num_sort_ranks,  // #ranks that share a sort dimension
                          size_t* sort_ranks,     // rank ids that share a sort dimension with us
                          size_t segment_size_l,  // (local) segment size
+                         size_t oversampling,    // samples per sort rank in every segment
                          /* other */
                          bool rebalance,
                          bool argsort,
@@ -1211,6 +1170,13 @@ void sample_sort_nccl_nd(SortPiece<legate_type_of<CODE>> local_sorted,
   size_t volume              = local_sorted.size;
   bool is_unbound_1d_storage = output_array_unbound.is_unbound_store();
 
+  // phase times are only meaningful once the work queued on the stream is done
+  SampleSortStats stats(my_rank);
+  auto end_phase = [&](SampleSortPhase phase) {
+    if (stats.enabled()) CHECK_CUDA(cudaStreamSynchronize(stream));
+    stats.end_phase(phase);
+  };
+
   /////////////////////////////////////////////////////////////////////////////////////////////////
   /////////////// Part 0: detection of empty nodes
   /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1255,10 +1221,12 @@ void sample_sort_nccl_nd(SortPiece<legate_type_of<CODE>> local_sorted,
   /////////////// Part 1: select and share samples accross sort domain
   /////////////////////////////////////////////////////////////////////////////////////////////////
 
-  // collect local samples - for now we take num_sort_ranks samples for every node/line
-  // worst case this leads to imbalance of x2
+  // collect local samples - we take oversampling * num_sort_ranks samples for every node/line.
+  // With one sample per sort rank the worst case imbalance is x2, more samples narrow it down.
+  // Ties between samples are broken by (rank, position), i.e., by the global index, so that
+  // splitters can fall in the middle of runs of duplicate keys
   size_t num_segments_l            = volume / segment_size_l;
-  size_t num_samples_per_segment_l = num_sort_ranks;
+  size_t num_samples_per_segment_l = num_sort_ranks * oversampling;
   size_t num_samples_l             = num_samples_per_segment_l * num_segments_l;
   size_t num_samples_per_segment_g = num_samples_per_segment_l * num_sort_ranks;
   size_t num_samples_g             = num_samples_per_segment_g * num_segments_l;
@@ -1329,8 +1297,13 @@ void sample_sort_nccl_nd(SortPiece<legate_type_of<CODE>> local_sorted,
     recv_buffer.destroy();
 
     CHECK_CUDA_STREAM(stream);
+
+    const size_t bytes = (num_sort_ranks - 1) * aligned_count * sizeof(SegmentSample<VAL>);
+    stats.exchanged(bytes, bytes);
   }
 
+  end_phase(SampleSortPhase::SAMPLE);
+
   /////////////////////////////////////////////////////////////////////////////////////////////////
   /////////////// Part 2: select splitters from samples and collect positions in local data
   /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1401,6 +1374,8 @@ void sample_sort_nccl_nd(SortPiece<legate_type_of<CODE>> local_sorted,
   samples.destroy();
   split_positions.destroy();
 
+  end_phase(SampleSortPhase::SPLIT);
+
   /////////////////////////////////////////////////////////////////////////////////////////////////
   /////////////// Part 3: communicate data in sort domain
   /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1561,6 +1536,18 @@ void sample_sort_nccl_nd(SortPiece<legate_type_of<CODE>> local_sorted,
     CHECK_CUDA_STREAM(stream);
   }
 
+  if (stats.enabled()) {
+    // data that stays on this rank is not exchanged
+    const size_t element_size = sizeof(VAL) + (argsort ? sizeof(int64_t) : 0);
+    size_t sent = 0, received = 0;
+    for (size_t r = 0; r < num_sort_ranks; r++) {
+      if (r == my_sort_rank) continue;
+      sent += size_send_total[r];
+      received += size_recv_total[r];
+    }
+    stats.exchanged(element_size * sent, element_size * received);
+  }
+
   // communicate all2all (in sort dimension)
   CHECK_NCCL(ncclGroupStart());
   for (size_t r = 0; r < num_sort_ranks; r++) {
@@ -1609,6 +1596,8 @@ void sample_sort_nccl_nd(SortPiece<legate_type_of<CODE>> local_sorted,
   }
   CHECK_CUDA_STREAM(stream);
 
+  end_phase(SampleSortPhase::EXCHANGE);
+
   /////////////////////////////////////////////////////////////////////////////////////////////////
   /////////////// Part 4: merge data
   /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1617,6 +1606,9 @@ void sample_sort_nccl_nd(SortPiece<legate_type_of<CODE>> local_sorted,
   SegmentMergePiece<VAL> merged_result =
     merge_all_buffers<CODE>(merge_buffers, num_segments_l > 1, argsort, alloc, stream);
 
+  stats.balance(merged_result.size, double(segment_size_g) * num_segments_l / num_sort_ranks);
+  end_phase(SampleSortPhase::MERGE);
+
   /////////////////////////////////////////////////////////////////////////////////////////////////
   /////////////// Part 5: re-balance data to match input/output dimensions
   /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1632,6 +1624,7 @@ void sample_sort_nccl_nd(SortPiece<legate_type_of<CODE>> local_sorted,
                    segment_size_l,
                    num_segments_l,
                    argsort,
+                   stats,
                    alloc,
                    stream,
                    comm);
@@ -1645,6 +1638,9 @@ void sample_sort_nccl_nd(SortPiece<legate_type_of<CODE>> local_sorted,
       output_array_unbound.bind_data(merged_result.values, Point<1>(merged_result.size));
     }
   }
+
+  end_phase(SampleSortPhase::REBALANCE);
+  stats.report();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1675,6 +1671,7 @@ struct SortImplBody<VariantKind::GPU, CODE, DIM> {
                   const size_t local_rank,
                   const size_t num_ranks,
                   const size_t num_sort_ranks,
+                  const size_t oversampling,
                   const std::vector<comm::Communicator>& comms)
   {
     auto input = input_array.read_accessor<VAL, DIM>(rect);
@@ -1784,6 +1781,7 @@ struct SortImplBody<VariantKind::GPU, CODE, DIM> {
                                   num_sort_ranks,
                                   sort_ranks.data(),
                                   segment_size_l,
+                                  oversampling,
                                   rebalance,
                                   argsort,
                                   stream,
@@ -17,8 +17,10 @@
 #pragma once
 
 #include "cunumeric/cunumeric.h"
+#include "cunumeric/unary/isnan.h"
 
 #include <thrust/sort.h>
+#include <thrust/tuple.h>
 
 namespace cunumeric {
 
@@ -32,6 +34,7 @@ struct SortArgs {
   size_t local_rank;
   size_t num_ranks;
   size_t num_sort_ranks;
+  size_t oversampling;  // samples per sort rank in the sample sort
 };
 
 template <typename VAL>
@@ -68,8 +71,11 @@ struct SegmentSampleComparator
       // special case for unused samples
       if (lhs.rank < 0 || rhs.rank < 0) { return rhs.rank < 0 && lhs.rank >= 0; }
 
-      if (lhs.value != rhs.value) {
-        return lhs.value < rhs.value;
+      NanLastLess<VAL> less;
+      if (less(lhs.value, rhs.value)) {
+        return true;
+      } else if (less(rhs.value, lhs.value)) {
+        return false;
       } else if (lhs.rank != rhs.rank) {
         return lhs.rank < rhs.rank;
       } else {
@@ -79,6 +85,19 @@ struct SegmentSampleComparator
   }
 };
 
+// Orders (segment, value) pairs by segment first and then by value, with
+// NaNs last as in the local sorts
+template <typename VAL>
+struct SegmentValueLess {
+  __CUDA_HD__ bool operator()(const thrust::tuple<size_t, VAL>& lhs,
+                              const thrust::tuple<size_t, VAL>& rhs) const
+  {
+    if (thrust::get<0>(lhs) != thrust::get<0>(rhs))
+      return thrust::get<0>(lhs) < thrust::get<0>(rhs);
+    return NanLastLess<VAL>{}(thrust::get<1>(lhs), thrust::get<1>(rhs));
+  }
+};
+
 struct modulusWithOffset : public thrust::binary_function<int64_t, int64_t, int64_t> {
   const size_t constant;
 
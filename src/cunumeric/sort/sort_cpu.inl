@@ -18,6 +18,8 @@
 
 // Useful for IDEs
 #include "cunumeric/sort/sort.h"
+#include "cunumeric/sort/sort_stats.h"
+#include "cunumeric/sort/radix_sort_cpu.inl"
 #include "cunumeric/pitches.h"
 #include "core/comm/coll.h"
 
@@ -29,29 +31,149 @@
 #include <thrust/sort.h>
 #include <thrust/system/omp/execution_policy.h>
 
+#ifdef LEGATE_USE_OPENMP
+#include <omp.h>
+#endif
+
 #include <functional>
 #include <numeric>
+#include <type_traits>
+#include <vector>
 
 namespace cunumeric {
 
 using namespace legate;
 
+// segments up to this size are sorted by insertion
+constexpr size_t INSERTION_SORT_MAX_SIZE = 16;
+// segments up to this size are sorted in parallel across segments, each by a
+// single thread, rather than one after another by all threads. segments too
+// short to be radix sorted always are, as the fork/join of a parallel sort
+// per segment would dominate. longer ones only are if there are at least as
+// many segments as threads, as otherwise threads would sit idle while all of
+// them could split each radix sort.
+constexpr size_t SEGMENTED_SORT_MAX_SIZE = 1 << 14;
+static_assert(SEGMENTED_SORT_MAX_SIZE >= RADIX_SORT_MIN_SIZE);
+
+// number of threads that sort with the given execution policy
+template <typename DerivedPolicy>
+size_t sort_threads(const DerivedPolicy&)
+{
+#ifdef LEGATE_USE_OPENMP
+  if constexpr (std::is_same_v<DerivedPolicy, std::remove_cv_t<decltype(thrust::omp::par)>>)
+    return omp_get_max_threads();
+#endif
+  return 1;
+}
+
+// stable insertion sort of a tiny segment, permuting indices along if not null
+template <typename VAL>
+void insertion_sort(VAL* values, int64_t* indices, const size_t size)
+{
+  NanLastLess<VAL> less;
+  for (size_t i = 1; i < size; ++i) {
+    const VAL value     = values[i];
+    const int64_t index = indices != nullptr ? indices[i] : 0;
+    size_t j            = i;
+    for (; j > 0 && less(value, values[j - 1]); --j) {
+      values[j] = values[j - 1];
+      if (indices != nullptr) indices[j] = indices[j - 1];
+    }
+    values[j] = value;
+    if (indices != nullptr) indices[j] = index;
+  }
+}
+
+// sorts a single segment sequentially
+template <typename VAL>
+void sort_segment(VAL* values, int64_t* indices, const size_t size, const bool stable)
+{
+  NanLastLess<VAL> less;
+  if (size <= INSERTION_SORT_MAX_SIZE) {
+    insertion_sort(values, indices, size);
+    return;
+  }
+  if constexpr (has_radix_key<VAL>) {
+    if (size >= RADIX_SORT_MIN_SIZE) {
+      std::vector<VAL> values_tmp(size);
+      std::vector<int64_t> indices_tmp(indices != nullptr ? size : 0);
+      radix_sort_inplace(values,
+                         indices,
+                         size,
+                         values_tmp.data(),
+                         indices != nullptr ? indices_tmp.data() : nullptr,
+                         thrust::seq);
+      return;
+    }
+  }
+  if (indices == nullptr) {
+    if (stable) {
+      thrust::stable_sort(thrust::seq, values, values + size, less);
+    } else {
+      thrust::sort(thrust::seq, values, values + size, less);
+    }
+  } else {
+    if (stable) {
+      thrust::stable_sort_by_key(thrust::seq, values, values + size, indices, less);
+    } else {
+      thrust::sort_by_key(thrust::seq, values, values + size, indices, less);
+    }
+  }
+}
+
 // sorts inptr in-place, if argptr not nullptr it returns sort indices
 template <typename VAL, typename DerivedPolicy>
-void thrust_local_sort_inplace(VAL* inptr,
-                               int64_t* argptr,
-                               const size_t volume,
-                               const size_t sort_dim_size,
-                               const bool stable_argsort,
-                               const DerivedPolicy& exec)
+void local_sort_inplace(VAL* inptr,
+                        int64_t* argptr,
+                        const size_t volume,
+                        const size_t sort_dim_size,
+                        const bool stable_argsort,
+                        const DerivedPolicy& exec)
 {
+  // many short segments are distributed across threads
+  const size_t num_segments = sort_dim_size > 0 ? volume / sort_dim_size : 0;
+  if (num_segments > 1 && sort_dim_size <= SEGMENTED_SORT_MAX_SIZE &&
+      (sort_dim_size < RADIX_SORT_MIN_SIZE || num_segments >= sort_threads(exec))) {
+    thrust::for_each(exec,
+                     thrust::make_counting_iterator<size_t>(0),
+                     thrust::make_counting_iterator<size_t>(num_segments),
+                     [=](size_t segment) {
+                       const size_t start_idx = segment * sort_dim_size;
+                       sort_segment(inptr + start_idx,
+                                    argptr != nullptr ? argptr + start_idx : nullptr,
+                                    sort_dim_size,
+                                    stable_argsort);
+                     });
+    return;
+  }
+
+  // long segments of numbers are radix sorted, which is stable either way
+  if constexpr (has_radix_key<VAL>) {
+    if (sort_dim_size >= RADIX_SORT_MIN_SIZE) {
+      auto values_tmp  = create_buffer<VAL>(sort_dim_size);
+      auto indices_tmp = create_buffer<int64_t>(argptr != nullptr ? sort_dim_size : 0);
+      for (size_t start_idx = 0; start_idx < volume; start_idx += sort_dim_size) {
+        radix_sort_inplace(inptr + start_idx,
+                           argptr != nullptr ? argptr + start_idx : nullptr,
+                           sort_dim_size,
+                           values_tmp.ptr(0),
+                           argptr != nullptr ? indices_tmp.ptr(0) : nullptr,
+                           exec);
+      }
+      values_tmp.destroy();
+      indices_tmp.destroy();
+      return;
+    }
+  }
+
+  NanLastLess<VAL> less;
   if (argptr == nullptr) {
     // sort (in place)
     for (size_t start_idx = 0; start_idx < volume; start_idx += sort_dim_size) {
       if (stable_argsort) {
-        thrust::stable_sort(exec, inptr + start_idx, inptr + start_idx + sort_dim_size);
+        thrust::stable_sort(exec, inptr + start_idx, inptr + start_idx + sort_dim_size, less);
       } else {
-        thrust::sort(exec, inptr + start_idx, inptr + start_idx + sort_dim_size);
+        thrust::sort(exec, inptr + start_idx, inptr + start_idx + sort_dim_size, less);
       }
     }
   } else {
@@ -60,9 +182,10 @@ void thrust_local_sort_inplace(VAL* inptr,
       int64_t* segmentValues = argptr + start_idx;
       VAL* segmentKeys       = inptr + start_idx;
       if (stable_argsort) {
-        thrust::stable_sort_by_key(exec, segmentKeys, segmentKeys + sort_dim_size, segmentValues);
+        thrust::stable_sort_by_key(
+          exec, segmentKeys, segmentKeys + sort_dim_size, segmentValues, less);
       } else {
-        thrust::sort_by_key(exec, segmentKeys, segmentKeys + sort_dim_size, segmentValues);
+        thrust::sort_by_key(exec, segmentKeys, segmentKeys + sort_dim_size, segmentValues, less);
       }
     }
   }
@@ -82,6 +205,7 @@ void rebalance_data(SegmentMergePiece<VAL>& merge_buffer,
                     size_t num_segments_l,
                     /* other */
                     bool argsort,
+                    SampleSortStats& stats,
                     const DerivedPolicy& exec,
                     comm::coll::CollComm comm)
 {
@@ -305,6 +429,8 @@ void rebalance_data(SegmentMergePiece<VAL>& merge_buffer,
       std::fill(rdispls.ptr(0), rdispls.ptr(0) + num_ranks, 0);
 
       size_t bytesize = argsort ? sizeof(int64_t) : sizeof(VAL);
+      stats.exchanged((send_left_size + send_right_size) * bytesize,
+                      (recv_left_size + recv_right_size) * bytesize);
 
       // left-comm
       if (send_left_size > 0) {
@@ -454,6 +580,7 @@ void sample_sort_nd(SortPiece<legate_type_of<CODE>> local_sorted,
                     size_t num_sort_ranks,  // #ranks that share a sort dimension
                     size_t* sort_ranks,     // rank ids that share a sort dimension with us
                     size_t segment_size_l,  // (local) segment size
+                    size_t oversampling,    // samples per sort rank in every segment
                     /* other */
                     bool rebalance,
                     bool argsort,
@@ -467,6 +594,8 @@ void sample_sort_nd(SortPiece<legate_type_of<CODE>> local_sorted,
 
   assert((volume > 0 && segment_size_l > 0) || volume == segment_size_l);
 
+  SampleSortStats stats(my_rank);
+
   /////////////////////////////////////////////////////////////////////////////////////////////////
   /////////////// Part 0: detection of empty nodes
   /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -503,10 +632,12 @@ void sample_sort_nd(SortPiece<legate_type_of<CODE>> local_sorted,
   /////////////// Part 1: select and share samples accross sort domain
   /////////////////////////////////////////////////////////////////////////////////////////////////
 
-  // collect local samples - for now we take num_sort_ranks samples for every node/line
-  // worst case this leads to imbalance of x2
+  // collect local samples - we take oversampling * num_sort_ranks samples for every node/line.
+  // With one sample per sort rank the worst case imbalance is x2, more samples narrow it down.
+  // Ties between samples are broken by (rank, position), i.e., by the global index, so that
+  // splitters can fall in the middle of runs of duplicate keys
   size_t num_segments_l            = segment_size_l > 0 ? volume / segment_size_l : 0;
-  size_t num_samples_per_segment_l = num_sort_ranks;
+  size_t num_samples_per_segment_l = num_sort_ranks * oversampling;
   size_t num_samples_l             = num_samples_per_segment_l * num_segments_l;
   size_t num_samples_per_segment_g = num_samples_per_segment_l * num_sort_ranks;
   size_t num_samples_g             = num_samples_per_segment_g * num_segments_l;
@@ -576,6 +707,10 @@ void sample_sort_nd(SortPiece<legate_type_of<CODE>> local_sorted,
                                 rdispls.ptr(0),    // exclusive_scan of recv size
                                 comm::coll::CollDataType::CollUint8,
                                 comm);
+      if (num_sort_ranks > 0) {
+        const size_t bytes = (num_sort_ranks - 1) * num_samples_l * sizeof(SegmentSample<VAL>);
+        stats.exchanged(bytes, bytes);
+      }
 
       samples_l.destroy();
       comm_size.destroy();
@@ -584,6 +719,8 @@ void sample_sort_nd(SortPiece<legate_type_of<CODE>> local_sorted,
     }
   }
 
+  stats.end_phase(SampleSortPhase::SAMPLE);
+
   /////////////////////////////////////////////////////////////////////////////////////////////////
   /////////////// Part 2: select splitters from samples and collect positions in local data
   /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -630,14 +767,18 @@ void sample_sort_nd(SortPiece<legate_type_of<CODE>> local_sorted,
           if (my_sort_rank > splitter.rank) {
             // position of the last position with smaller value than splitter.value + 1
             end_position =
-              std::lower_bound(
-                local_values + start_position, local_values + end_position, splitter.value) -
+              std::lower_bound(local_values + start_position,
+                               local_values + end_position,
+                               splitter.value,
+                               NanLastLess<VAL>{}) -
               local_values;
           } else if (my_sort_rank < splitter.rank) {
             // position of the first position with value larger than splitter.value
             end_position =
-              std::upper_bound(
-                local_values + start_position, local_values + end_position, splitter.value) -
+              std::upper_bound(local_values + start_position,
+                               local_values + end_position,
+                               splitter.value,
+                               NanLastLess<VAL>{}) -
               local_values;
           } else {
             end_position = splitter.position + 1;
@@ -671,6 +812,8 @@ void sample_sort_nd(SortPiece<legate_type_of<CODE>> local_sorted,
   }
 #endif
 
+  stats.end_phase(SampleSortPhase::SPLIT);
+
   /////////////////////////////////////////////////////////////////////////////////////////////////
   /////////////// Part 3: communicate data in sort domain
   /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -784,6 +927,12 @@ void sample_sort_nd(SortPiece<legate_type_of<CODE>> local_sorted,
       recv_size_total[sort_ranks[sort_rank]] =
         sizeof(VAL) * size_recv[sort_rank * (num_segments_l + 1) + num_segments_l];
     }
+    if (stats.enabled() && num_sort_ranks > 0) {
+      // data that stays on this rank is not exchanged
+      const size_t element_size = sizeof(VAL) + (argsort ? sizeof(int64_t) : 0);
+      const size_t kept = size_send[my_sort_rank * (num_segments_l + 1) + num_segments_l];
+      stats.exchanged(element_size * (volume - kept), element_size * (merge_buffer.size - kept));
+    }
     auto p_send_size_total = send_size_total.ptr(0);
     auto p_recv_size_total = recv_size_total.ptr(0);
     thrust::exclusive_scan(
@@ -834,6 +983,8 @@ void sample_sort_nd(SortPiece<legate_type_of<CODE>> local_sorted,
   val_send_buffer.destroy();
   if (argsort) idc_send_buffer.destroy();
 
+  stats.end_phase(SampleSortPhase::EXCHANGE);
+
   /////////////////////////////////////////////////////////////////////////////////////////////////
   /////////////// Part 4: merge data
   /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -844,26 +995,25 @@ void sample_sort_nd(SortPiece<legate_type_of<CODE>> local_sorted,
     if (num_segments_l == 1) {
       auto* p_values  = merge_buffer.values.ptr(0);
       auto* p_indices = argsort ? merge_buffer.indices.ptr(0) : nullptr;
-      thrust_local_sort_inplace(
-        p_values, p_indices, merge_buffer.size, merge_buffer.size, true, exec);
+      local_sort_inplace(p_values, p_indices, merge_buffer.size, merge_buffer.size, true, exec);
     } else {
       // we need to consider segments as well
       auto combined = thrust::make_zip_iterator(
         thrust::make_tuple(merge_buffer.segments.ptr(0), merge_buffer.values.ptr(0)));
       if (argsort) {
         auto* p_indices = merge_buffer.indices.ptr(0);
-        thrust::stable_sort_by_key(exec,
-                                   combined,
-                                   combined + merge_buffer.size,
-                                   p_indices,
-                                   thrust::less<thrust::tuple<size_t, VAL>>());
+        thrust::stable_sort_by_key(
+          exec, combined, combined + merge_buffer.size, p_indices, SegmentValueLess<VAL>());
       } else {
-        thrust::stable_sort(
-          exec, combined, combined + merge_buffer.size, thrust::less<thrust::tuple<size_t, VAL>>());
+        thrust::stable_sort(exec, combined, combined + merge_buffer.size, SegmentValueLess<VAL>());
       }
     }
   }
 
+  stats.balance(merge_buffer.size,
+                num_sort_ranks > 0 ? double(segment_size_g) * num_segments_l / num_sort_ranks : 0);
+  stats.end_phase(SampleSortPhase::MERGE);
+
   /////////////////////////////////////////////////////////////////////////////////////////////////
   /////////////// Part 5: re-balance data to match input/output dimensions
   /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -880,6 +1030,7 @@ void sample_sort_nd(SortPiece<legate_type_of<CODE>> local_sorted,
                    segment_size_l,
                    num_segments_l,
                    argsort,
+                   stats,
                    exec,
                    comm);
   } else {
@@ -892,6 +1043,9 @@ void sample_sort_nd(SortPiece<legate_type_of<CODE>> local_sorted,
       output_array_unbound.bind_data(merge_buffer.values, Point<1>(merge_buffer.size));
     }
   }
+
+  stats.end_phase(SampleSortPhase::REBALANCE);
+  stats.report();
 }
 
 template <Type::Code CODE, int32_t DIM>
@@ -912,6 +1066,7 @@ struct SortImplBodyCpu {
                   const size_t local_rank,
                   const size_t num_ranks,
                   const size_t num_sort_ranks,
+                  const size_t oversampling,
                   const DerivedPolicy& exec,
                   const std::vector<comm::Communicator>& comms)
   {
@@ -978,7 +1133,7 @@ struct SortImplBodyCpu {
       // sort data (locally)
       auto* src = input.ptr(rect.lo);
       if (src != values_ptr) std::copy(src, src + volume, values_ptr);
-      thrust_local_sort_inplace(values_ptr, indices_ptr, volume, segment_size_l, stable, exec);
+      local_sort_inplace(values_ptr, indices_ptr, volume, segment_size_l, stable, exec);
     }
 
     if (need_distributed_sort) {
@@ -1013,6 +1168,7 @@ struct SortImplBodyCpu {
                              num_sort_ranks,
                              sort_ranks.data(),
                              segment_size_l,
+                             oversampling,
                              rebalance,
                              argsort,
                              exec,
@@ -46,6 +46,7 @@ struct SortImplBody<VariantKind::OMP, CODE, DIM> {
                   const size_t local_rank,
                   const size_t num_ranks,
                   const size_t num_sort_ranks,
+                  const size_t oversampling,
                   const std::vector<comm::Communicator>& comms)
   {
     SortImplBodyCpu<CODE, DIM>()(input_array,
@@ -61,6 +62,7 @@ struct SortImplBody<VariantKind::OMP, CODE, DIM> {
                                  local_rank,
                                  num_ranks,
                                  num_sort_ranks,
+                                 oversampling,
                                  thrust::omp::par,
                                  comms);
   }
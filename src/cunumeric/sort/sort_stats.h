@@ -0,0 +1,96 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cunumeric/cunumeric.h"
+
+#include <chrono>
+
+namespace cunumeric {
+
+// Logger of the distributed sorts. Their counters are reported at the info
+// level, e.g., with -level cunumeric.sort=2.
+legate::Logger& sort_log();
+
+// Phases of a distributed sample sort
+enum class SampleSortPhase : int32_t {
+  SAMPLE    = 0,  // Selection and exchange of the samples
+  SPLIT     = 1,  // Selection of the splitters and of the pieces to send
+  EXCHANGE  = 2,  // All-to-all exchange of the pieces
+  MERGE     = 3,  // Sort of the received pieces
+  REBALANCE = 4,  // Redistribution of the result to match the output
+  COUNT     = 5,
+};
+
+// Counters of a distributed sample sort on one rank. Nothing is measured
+// unless the logger wants info messages. Phase times are host-side, so
+// device work has to be synchronized before a phase is ended.
+class SampleSortStats {
+  using clock = std::chrono::steady_clock;
+
+ public:
+  explicit SampleSortStats(size_t rank) : enabled_(sort_log().want_info()), rank_(rank)
+  {
+    if (enabled_) start_ = clock::now();
+  }
+
+ public:
+  bool enabled() const { return enabled_; }
+  void end_phase(SampleSortPhase phase)
+  {
+    if (!enabled_) return;
+    const auto now = clock::now();
+    seconds_[static_cast<int32_t>(phase)] += std::chrono::duration<double>(now - start_).count();
+    start_ = now;
+  }
+  // Counts the bytes sent to and received from other ranks
+  void exchanged(size_t sent, size_t received)
+  {
+    bytes_sent_ += sent;
+    bytes_received_ += received;
+  }
+  // Records the number of elements this rank received for merging, against
+  // the number it would have received if the data was split evenly
+  void balance(size_t received, double even)
+  {
+    elements_ = received;
+    even_     = even;
+  }
+  void report() const
+  {
+    if (!enabled_) return;
+    static const char* names[] = {"sample", "split", "exchange", "merge", "rebalance"};
+    auto message = sort_log().info();
+    message << "sample sort on rank " << rank_ << ": sent " << bytes_sent_ << " B, received "
+            << bytes_received_ << " B, merged " << elements_ << " elements (imbalance "
+            << (even_ > 0 ? elements_ / even_ : 1.0) << ")";
+    for (int32_t phase = 0; phase < static_cast<int32_t>(SampleSortPhase::COUNT); ++phase)
+      message << ", " << names[phase] << " " << seconds_[phase] * 1e3 << " ms";
+  }
+
+ private:
+  bool enabled_;
+  size_t rank_;
+  clock::time_point start_;
+  double seconds_[static_cast<int32_t>(SampleSortPhase::COUNT)] = {};
+  size_t bytes_sent_{0};
+  size_t bytes_received_{0};
+  size_t elements_{0};
+  double even_{0};
+};
+
+}  // namespace cunumeric
@@ -79,6 +79,7 @@ struct SortImpl {
                                     args.local_rank,
                                     args.num_ranks,
                                     args.num_sort_ranks,
+                                    args.oversampling,
                                     comms);
   }
 };
@@ -92,6 +93,7 @@ static void sort_template(TaskContext& context)
   size_t local_rank     = get_rank(domain, context.get_task_index());
   size_t num_ranks      = domain.get_volume();
   size_t num_sort_ranks = domain.hi()[domain.get_dim() - 1] - domain.lo()[domain.get_dim() - 1] + 1;
+  size_t oversampling   = context.scalars()[3].value<int32_t>();
 
   SortArgs args{context.inputs()[0],
                 context.outputs()[0],
@@ -101,7 +103,8 @@ static void sort_template(TaskContext& context)
                 !context.is_single_task(),
                 local_rank,
                 num_ranks,
-                num_sort_ranks};
+                num_sort_ranks,
+                oversampling};
   double_dispatch(
     args.input.dim(), args.input.code(), SortImpl<KIND>{}, args, context.communicators());
 }
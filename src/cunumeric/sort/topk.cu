@@ -0,0 +1,102 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/sort/topk.h"
+#include "cunumeric/sort/topk_template.inl"
+#include "cunumeric/sort/local_sort.cuh"
+
+#include "cunumeric/cuda_help.h"
+
+namespace cunumeric {
+
+using namespace legate;
+
+// Copies the elements along with their positions into contiguous buffers
+template <typename VAL>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  gather_kernel(VAL* values,
+                int64_t* indices,
+                AccessorRO<VAL, 1> in,
+                const int64_t* positions,
+                Point<1> origin,
+                size_t volume)
+{
+  const size_t idx = global_tid_1d();
+  if (idx >= volume) return;
+  const coord_t point = origin[0] + idx;
+  values[idx]         = in[point];
+  indices[idx]        = positions != nullptr ? positions[idx] : point;
+}
+
+// Copies the best elements out of the sorted ones, from the best one down
+template <typename VAL>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  select_kernel(VAL* out_values,
+                int64_t* out_indices,
+                const VAL* values,
+                const int64_t* indices,
+                size_t size,
+                size_t volume,
+                bool largest)
+{
+  const size_t idx = global_tid_1d();
+  if (idx >= size) return;
+  const size_t src = largest ? volume - 1 - idx : idx;
+  out_values[idx]  = values[src];
+  out_indices[idx] = indices[src];
+}
+
+template <Type::Code CODE>
+struct TopkImplBody<VariantKind::GPU, CODE> {
+  using VAL = legate_type_of<CODE>;
+
+  void operator()(VAL* out_values,
+                  int64_t* out_indices,
+                  size_t size,
+                  const AccessorRO<VAL, 1>& in,
+                  const int64_t* positions,
+                  const Rect<1>& rect,
+                  size_t volume,
+                  bool largest) const
+  {
+    // The radix sort of the whole piece is already faster on GPUs than a
+    // selection would be, so the best elements are simply read off the ends
+    // of the sorted piece
+    auto stream = get_cached_stream();
+
+    auto values   = create_buffer<VAL>(volume, Memory::Kind::GPU_FB_MEM);
+    auto indices  = create_buffer<int64_t>(volume, Memory::Kind::GPU_FB_MEM);
+    size_t blocks = (volume + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+    gather_kernel<VAL><<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+      values.ptr(0), indices.ptr(0), in, positions, rect.lo, volume);
+    local_sort<CODE>(
+      values.ptr(0), values.ptr(0), indices.ptr(0), indices.ptr(0), volume, volume, true, stream);
+
+    blocks = (size + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+    select_kernel<VAL><<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+      out_values, out_indices, values.ptr(0), indices.ptr(0), size, volume, largest);
+    CHECK_CUDA_STREAM(stream);
+    values.destroy();
+    indices.destroy();
+  }
+};
+
+/*static*/ void TopkTask::gpu_variant(TaskContext& context)
+{
+  topk_template<VariantKind::GPU>(context);
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,64 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/sort/topk.h"
+#include "cunumeric/sort/topk_select.h"
+#include "cunumeric/sort/topk_template.inl"
+
+#include <omp.h>
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <Type::Code CODE>
+struct TopkImplBody<VariantKind::OMP, CODE> {
+  using VAL = legate_type_of<CODE>;
+
+  void operator()(VAL* values,
+                  int64_t* indices,
+                  size_t size,
+                  const AccessorRO<VAL, 1>& in,
+                  const int64_t* positions,
+                  const Rect<1>& rect,
+                  size_t volume,
+                  bool largest) const
+  {
+    // Each thread selects out of its own chunk of the elements, and the
+    // candidates of all threads are then merged
+    const auto max_threads = omp_get_max_threads();
+    std::vector<TopkSelector<VAL>> selectors(max_threads, TopkSelector<VAL>(size, largest));
+#pragma omp parallel
+    {
+      auto& selector = selectors[omp_get_thread_num()];
+#pragma omp for schedule(static)
+      for (size_t idx = 0; idx < volume; ++idx) {
+        const coord_t point = rect.lo[0] + idx;
+        selector.push(positions != nullptr ? positions[idx] : point, in[point]);
+      }
+    }
+    TopkSelector<VAL> merged(size, largest);
+    for (auto& selector : selectors) merged.merge(selector);
+    merged.finish(values, indices);
+  }
+};
+
+/*static*/ void TopkTask::omp_variant(TaskContext& context)
+{
+  topk_template<VariantKind::OMP>(context);
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,91 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cunumeric/sort/radix_key.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace cunumeric {
+
+// Streaming selection of the k best elements, i.e., the k largest or the k
+// smallest ones. Elements are compared by their radix keys, which order NaNs
+// after all other values as NumPy's sort does, and ties go to the element
+// at the lower position. Candidates are buffered until there are 2k of them,
+// at which point the worse half is dropped, so that selecting out of n
+// elements takes O(n) time and O(k) space. Host-only.
+template <typename VAL>
+class TopkSelector {
+ public:
+  using KEY = typename RadixKey<VAL>::KEY;
+
+  struct Candidate {
+    KEY key;
+    int64_t position;
+    VAL value;
+  };
+
+ public:
+  TopkSelector(size_t k, bool largest) : k_(k), largest_(largest) { buffer_.reserve(2 * k); }
+
+ public:
+  void push(int64_t position, const VAL& value)
+  {
+    buffer_.push_back(Candidate{RadixKey<VAL>::encode(value), position, value});
+    if (buffer_.size() == 2 * k_) prune();
+  }
+  // Pushes the candidates of another selector
+  void merge(const TopkSelector& other)
+  {
+    for (auto& candidate : other.buffer_) push(candidate.position, candidate.value);
+  }
+  // Writes the selected elements, from the best one down, and returns their
+  // number, which is k unless fewer elements were pushed
+  size_t finish(VAL* values, int64_t* positions)
+  {
+    prune();
+    std::sort(buffer_.begin(), buffer_.end(), better());
+    for (size_t idx = 0; idx < buffer_.size(); ++idx) {
+      values[idx]    = buffer_[idx].value;
+      positions[idx] = buffer_[idx].position;
+    }
+    return buffer_.size();
+  }
+
+ private:
+  auto better() const
+  {
+    return [largest = largest_](const Candidate& lhs, const Candidate& rhs) {
+      if (lhs.key != rhs.key) return largest ? lhs.key > rhs.key : lhs.key < rhs.key;
+      return lhs.position < rhs.position;
+    };
+  }
+  void prune()
+  {
+    if (buffer_.size() <= k_) return;
+    std::nth_element(buffer_.begin(), buffer_.begin() + k_, buffer_.end(), better());
+    buffer_.resize(k_);
+  }
+
+ private:
+  size_t k_;
+  bool largest_;
+  std::vector<Candidate> buffer_;
+};
+
+}  // namespace cunumeric
@@ -0,0 +1,80 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/sort/topk.h"
+#include "cunumeric/sort/radix_key.h"
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <VariantKind KIND, Type::Code CODE>
+struct TopkImplBody;
+
+template <VariantKind KIND>
+struct TopkImpl {
+  template <Type::Code CODE, std::enable_if_t<is_radix_key<CODE>::value>* = nullptr>
+  void operator()(TopkArgs& args) const
+  {
+    using VAL = legate_type_of<CODE>;
+
+    auto rect           = args.input.shape<1>();
+    const size_t volume = rect.empty() ? 0 : rect.volume();
+    const size_t size   = std::min<size_t>(args.k, volume);
+
+    auto values  = args.values.create_output_buffer<VAL, 1>(Point<1>(size), true);
+    auto indices = args.indices.create_output_buffer<int64_t, 1>(Point<1>(size), true);
+    if (size == 0) return;
+
+    auto in = args.input.read_accessor<VAL, 1>(rect);
+    // Elements are identified by their positions in the input, unless it
+    // holds candidates that come with their positions
+    const int64_t* positions = nullptr;
+    if (args.positions != nullptr) {
+      auto acc = args.positions->read_accessor<int64_t, 1>(rect);
+      assert(acc.accessor.is_dense_row_major(rect));
+      positions = acc.ptr(rect);
+    }
+    TopkImplBody<KIND, CODE>()(
+      values.ptr(0), indices.ptr(0), size, in, positions, rect, volume, args.largest);
+  }
+
+  template <Type::Code CODE, std::enable_if_t<!is_radix_key<CODE>::value>* = nullptr>
+  void operator()(TopkArgs& args) const
+  {
+    assert(false);
+  }
+};
+
+template <VariantKind KIND>
+static void topk_template(TaskContext& context)
+{
+  auto& inputs  = context.inputs();
+  auto& outputs = context.outputs();
+  auto& scalars = context.scalars();
+  TopkArgs args{inputs[0],
+                inputs.size() > 1 ? &inputs[1] : nullptr,
+                outputs[0],
+                outputs[1],
+                scalars[0].value<int64_t>(),  // k
+                scalars[1].value<bool>()};    // largest
+  type_dispatch(args.input.code(), TopkImpl<KIND>{}, args);
+}
+
+}  // namespace cunumeric
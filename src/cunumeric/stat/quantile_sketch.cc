@@ -0,0 +1,60 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "cunumeric/stat/quantile_sketch.h"
+#include "cunumeric/stat/quantile_sketch_template.inl"
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <Type::Code CODE, int32_t DIM>
+struct QuantileSketchImplBody<VariantKind::CPU, CODE, DIM> {
+  using VAL = legate_type_of<CODE>;
+
+  void operator()(Array& output,
+                  const AccessorRO<VAL, DIM>& in,
+                  const Rect<DIM>& rect,
+                  double compression) const
+  {
+    RowPitches<DIM> rows;
+    const size_t num_rows = rows.flatten(rect);
+    RowAccessor<const VAL, DIM> inrows(in, rect);
+
+    TDigest digest(compression);
+    for (size_t row = 0; row < num_rows; ++row) {
+      auto inrow          = inrows[rows.row_offset(row)];
+      const size_t length = rows.row_length(row);
+      for (size_t idx = 0; idx < length; ++idx) digest.add(static_cast<double>(inrow[idx]));
+    }
+    digest.compress();
+    bind_digest(output, digest);
+  }
+};
+
+/*static*/ void QuantileSketchTask::cpu_variant(TaskContext& context)
+{
+  quantile_sketch_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void)
+{
+  QuantileSketchTask::register_variants();
+}
+}  // namespace
+
+}  // namespace cunumeric
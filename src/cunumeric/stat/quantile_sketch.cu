@@ -0,0 +1,163 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "cunumeric/stat/quantile_sketch.h"
+#include "cunumeric/stat/quantile_sketch_template.inl"
+#include "cunumeric/pitches.h"
+#include "cunumeric/utilities/thrust_util.h"
+
+#include "cunumeric/cuda_help.h"
+
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/sort.h>
+
+namespace cunumeric {
+
+using namespace legate;
+
+// Number of values that are copied and sorted at once, which bounds the
+// temporary memory of a task regardless of the size of its piece
+constexpr size_t SKETCH_CHUNK_SIZE = 1 << 24;
+
+template <typename VAL, int32_t DIM>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  copy_as_double(double* out,
+                 const AccessorRO<VAL, DIM> in,
+                 const Point<DIM> lo,
+                 const Pitches<DIM - 1> pitches,
+                 const size_t start,
+                 const size_t volume)
+{
+  const size_t idx = global_tid_1d();
+  if (idx >= volume) return;
+  out[idx] = static_cast<double>(in[pitches.unflatten(start + idx, lo)]);
+}
+
+struct IsNan {
+  __device__ bool operator()(double value) const { return isnan(value); }
+};
+
+// Maps positions in the sorted values to clusters that span half a unit of
+// the scale function of the digest, except for the first and the last
+// position, which get clusters of their own
+struct ClusterOf {
+  double compression;
+  size_t size;
+
+  __device__ size_t operator()(size_t idx) const
+  {
+    if (idx == 0) return 0;
+    if (idx == size - 1) return static_cast<size_t>(compression) + 2;
+    const double q = (idx + 0.5) / size;
+    return 1 + static_cast<size_t>(compression / M_PI * asin(2.0 * q - 1.0) + compression / 2.0);
+  }
+};
+
+template <Type::Code CODE, int32_t DIM>
+struct QuantileSketchImplBody<VariantKind::GPU, CODE, DIM> {
+  using VAL = legate_type_of<CODE>;
+
+  void operator()(Array& output,
+                  const AccessorRO<VAL, DIM>& in,
+                  const Rect<DIM>& rect,
+                  double compression) const
+  {
+    auto stream = get_cached_stream();
+
+    Pitches<DIM - 1> pitches;
+    const size_t volume = pitches.flatten(rect);
+
+    // The values are not streamed one by one as on the CPU. Each chunk of
+    // them is copied, sorted, and cut into at most twice as many clusters as
+    // the digest can hold, which the host merges into the digest.
+    TDigest digest(compression);
+    if (volume > 0) {
+      const size_t chunk_size   = std::min(volume, SKETCH_CHUNK_SIZE);
+      const size_t max_clusters = static_cast<size_t>(compression) + 3;
+      auto temp                 = create_buffer<double>(chunk_size);
+      auto out_keys             = create_buffer<size_t>(max_clusters);
+      auto sums                 = create_buffer<double>(max_clusters);
+      auto counts               = create_buffer<double>(max_clusters);
+      double* ptr               = temp.ptr(0);
+      std::vector<double> host_sums(max_clusters);
+      std::vector<double> host_counts(max_clusters);
+      std::vector<Centroid> clusters;
+
+      for (size_t start = 0; start < volume; start += chunk_size) {
+        const size_t num_values = std::min(chunk_size, volume - start);
+        const size_t num_blocks = (num_values + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+        copy_as_double<VAL, DIM><<<num_blocks, THREADS_PER_BLOCK, 0, stream>>>(
+          ptr, in, rect.lo, pitches, start, num_values);
+        CHECK_CUDA_STREAM(stream);
+
+        const size_t size =
+          thrust::remove_if(DEFAULT_POLICY.on(stream), ptr, ptr + num_values, IsNan{}) - ptr;
+        if (size == 0) continue;
+        thrust::sort(DEFAULT_POLICY.on(stream), ptr, ptr + size);
+
+        auto keys = thrust::make_transform_iterator(thrust::make_counting_iterator<size_t>(0),
+                                                    ClusterOf{compression, size});
+        auto end  = thrust::reduce_by_key(
+          DEFAULT_POLICY.on(stream), keys, keys + size, ptr, out_keys.ptr(0), sums.ptr(0));
+        thrust::reduce_by_key(DEFAULT_POLICY.on(stream),
+                              keys,
+                              keys + size,
+                              thrust::make_constant_iterator<double>(1.0),
+                              out_keys.ptr(0),
+                              counts.ptr(0));
+        const size_t num_clusters = end.first - out_keys.ptr(0);
+
+        CHECK_CUDA(cudaMemcpyAsync(host_sums.data(),
+                                   sums.ptr(0),
+                                   sizeof(double) * num_clusters,
+                                   cudaMemcpyDeviceToHost,
+                                   stream));
+        CHECK_CUDA(cudaMemcpyAsync(host_counts.data(),
+                                   counts.ptr(0),
+                                   sizeof(double) * num_clusters,
+                                   cudaMemcpyDeviceToHost,
+                                   stream));
+        CHECK_CUDA(cudaStreamSynchronize(stream));
+
+        clusters.resize(num_clusters);
+        for (size_t idx = 0; idx < num_clusters; ++idx)
+          clusters[idx] = Centroid{host_sums[idx] / host_counts[idx], host_counts[idx]};
+        digest.merge(clusters.data(), num_clusters);
+      }
+    }
+    digest.compress();
+
+    std::vector<double> serialized(digest.serialized_size());
+    digest.serialize(serialized.data());
+    auto result = output.create_output_buffer<double, 1>(serialized.size(), true);
+    CHECK_CUDA(cudaMemcpyAsync(result.ptr(0),
+                               serialized.data(),
+                               sizeof(double) * serialized.size(),
+                               cudaMemcpyHostToDevice,
+                               stream));
+    CHECK_CUDA(cudaStreamSynchronize(stream));
+  }
+};
+
+/*static*/ void QuantileSketchTask::gpu_variant(TaskContext& context)
+{
+  quantile_sketch_template<VariantKind::GPU>(context);
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,67 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "cunumeric/stat/quantile_sketch.h"
+#include "cunumeric/stat/quantile_sketch_template.inl"
+
+#include <omp.h>
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <Type::Code CODE, int32_t DIM>
+struct QuantileSketchImplBody<VariantKind::OMP, CODE, DIM> {
+  using VAL = legate_type_of<CODE>;
+
+  void operator()(Array& output,
+                  const AccessorRO<VAL, DIM>& in,
+                  const Rect<DIM>& rect,
+                  double compression) const
+  {
+    const auto max_threads = omp_get_max_threads();
+    RowPitches<DIM> rows;
+    const size_t num_rows = rows.flatten(rect, max_threads);
+    RowAccessor<const VAL, DIM> inrows(in, rect);
+
+    // Each thread streams its rows into its own digest, which are then merged
+    // in the order of the threads so that the result is deterministic
+    std::vector<TDigest> digests(max_threads, TDigest(compression));
+#pragma omp parallel
+    {
+      TDigest local(compression);
+#pragma omp for schedule(static) nowait
+      for (size_t row = 0; row < num_rows; ++row) {
+        auto inrow          = inrows[rows.row_offset(row)];
+        const size_t length = rows.row_length(row);
+        for (size_t idx = 0; idx < length; ++idx) local.add(static_cast<double>(inrow[idx]));
+      }
+      local.compress();
+      digests[omp_get_thread_num()] = std::move(local);
+    }
+
+    TDigest digest(compression);
+    for (auto& local : digests) digest.merge(local);
+    digest.compress();
+    bind_digest(output, digest);
+  }
+};
+
+/*static*/ void QuantileSketchTask::omp_variant(TaskContext& context)
+{
+  quantile_sketch_template<VariantKind::OMP>(context);
+}
+
+}  // namespace cunumeric
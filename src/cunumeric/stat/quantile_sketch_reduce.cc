@@ -0,0 +1,34 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "cunumeric/stat/quantile_sketch_reduce.h"
+#include "cunumeric/stat/quantile_sketch_reduce_template.inl"
+
+namespace cunumeric {
+
+/*static*/ void QuantileSketchReduceTask::cpu_variant(TaskContext& context)
+{
+  quantile_sketch_reduce_template(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void)
+{
+  QuantileSketchReduceTask::register_variants();
+}
+}  // namespace
+
+}  // namespace cunumeric
@@ -0,0 +1,52 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/stat/quantile_sketch_reduce.h"
+#include "cunumeric/stat/tdigest.h"
+
+namespace cunumeric {
+
+using namespace legate;
+
+// Merges the serialized digests in the inputs into one. Digests are small,
+// so this is done sequentially in all variants.
+static void quantile_sketch_reduce_template(TaskContext& context)
+{
+  auto& inputs = context.inputs();
+  auto& output = context.outputs()[0];
+
+  std::vector<std::pair<const double*, size_t>> digests;
+  double compression = 1.0;
+  for (auto& input : inputs) {
+    auto shape = input.shape<1>();
+    if (shape.empty()) continue;
+    const double* ptr = input.read_accessor<double, 1>(shape).ptr(shape);
+    const size_t size = shape.volume();
+    compression       = std::max(compression, serialized_compression(ptr, size));
+    digests.emplace_back(ptr, size);
+  }
+
+  TDigest digest(compression);
+  for (auto& [ptr, size] : digests) merge_serialized(digest, ptr, size);
+  digest.compress();
+
+  auto result = output.create_output_buffer<double, 1>(digest.serialized_size(), true);
+  digest.serialize(result.ptr(0));
+}
+
+}  // namespace cunumeric
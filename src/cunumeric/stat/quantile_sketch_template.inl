@@ -0,0 +1,70 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/stat/quantile_sketch.h"
+#include "cunumeric/stat/tdigest.h"
+#include "cunumeric/row_pitches.h"
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <VariantKind KIND, Type::Code CODE, int32_t DIM>
+struct QuantileSketchImplBody;
+
+// Binds a digest to the output in serialized form
+static void bind_digest(Array& output, const TDigest& digest)
+{
+  auto result = output.create_output_buffer<double, 1>(digest.serialized_size(), true);
+  digest.serialize(result.ptr(0));
+}
+
+template <VariantKind KIND>
+struct QuantileSketchImpl {
+  template <Type::Code CODE, int32_t DIM, std::enable_if_t<!is_complex<CODE>::value>* = nullptr>
+  void operator()(Array& output, Array& input, double compression) const
+  {
+    using VAL = legate_type_of<CODE>;
+
+    auto rect = input.shape<DIM>();
+    auto in   = input.read_accessor<VAL, DIM>(rect);
+    QuantileSketchImplBody<KIND, CODE, DIM>()(output, in, rect, compression);
+  }
+
+  template <Type::Code CODE, int32_t DIM, std::enable_if_t<is_complex<CODE>::value>* = nullptr>
+  void operator()(Array& output, Array& input, double compression) const
+  {
+    assert(false);
+  }
+};
+
+template <VariantKind KIND>
+static void quantile_sketch_template(TaskContext& context)
+{
+  auto& input      = context.inputs()[0];
+  auto& output     = context.outputs()[0];
+  auto compression = context.scalars()[0].value<int32_t>();
+  double_dispatch(std::max(1, input.dim()),
+                  input.code(),
+                  QuantileSketchImpl<KIND>{},
+                  output,
+                  input,
+                  static_cast<double>(compression));
+}
+
+}  // namespace cunumeric
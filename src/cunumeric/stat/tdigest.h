@@ -0,0 +1,153 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace cunumeric {
+
+// Host-side merging t-digest, shared by the QUANTILE_SKETCH tasks and the
+// QUANTILE_SKETCH_REDUCE task that merges their results. A digest summarizes
+// a set of values by clusters of adjacent values, each kept as its mean and
+// weight. Clusters are small near both ends of the distribution and at most
+// a fraction 1 / compression of all values in the middle, so a digest holds
+// O(compression) clusters and estimates extreme quantiles most accurately.
+//
+// A digest is serialized as a sequence of (mean, weight) pairs in the order
+// of their means, preceded by the pair (compression, 0).
+
+struct Centroid {
+  double mean;
+  double weight;
+};
+
+class TDigest {
+ public:
+  explicit TDigest(double compression)
+    : compression_(std::max(compression, 1.0)),
+      capacity_(static_cast<size_t>(std::ceil(compression_)) * 5)
+  {
+    buffer_.reserve(capacity_);
+  }
+
+ public:
+  // NaNs are ignored
+  void add(double value)
+  {
+    if (std::isnan(value)) return;
+    buffer_.push_back(Centroid{value, 1.0});
+    if (buffer_.size() >= capacity_) compress();
+  }
+  void merge(const Centroid& centroid)
+  {
+    if (centroid.weight <= 0.0) return;
+    buffer_.push_back(centroid);
+    if (buffer_.size() >= capacity_) compress();
+  }
+  void merge(const Centroid* centroids, size_t size)
+  {
+    for (size_t idx = 0; idx < size; ++idx) merge(centroids[idx]);
+  }
+  void merge(const TDigest& other)
+  {
+    merge(other.centroids_.data(), other.centroids_.size());
+    merge(other.buffer_.data(), other.buffer_.size());
+  }
+  // Folds the buffered values into the clusters
+  void compress()
+  {
+    if (buffer_.empty()) return;
+    buffer_.insert(buffer_.end(), centroids_.begin(), centroids_.end());
+    std::sort(buffer_.begin(), buffer_.end(), [](const Centroid& a, const Centroid& b) {
+      return a.mean < b.mean;
+    });
+    double total = 0.0;
+    for (auto& centroid : buffer_) total += centroid.weight;
+
+    // Adjacent clusters are merged for as long as the merged cluster spans at
+    // most one unit of the scale function. The first and the last cluster are
+    // never merged, so that the extreme values are kept exactly.
+    centroids_.clear();
+    double so_far   = 0.0;
+    double limit    = total * inverse_scale(scale(0.0) + 1.0);
+    Centroid merged = buffer_.front();
+    const size_t last = buffer_.size() - 1;
+    for (size_t idx = 1; idx <= last; ++idx) {
+      const Centroid& next = buffer_[idx];
+      if (idx > 1 && idx < last && so_far + merged.weight + next.weight <= limit) {
+        merged.weight += next.weight;
+        merged.mean   += (next.mean - merged.mean) * next.weight / merged.weight;
+      } else {
+        centroids_.push_back(merged);
+        so_far += merged.weight;
+        limit  = total * inverse_scale(scale(so_far / total) + 1.0);
+        merged = next;
+      }
+    }
+    centroids_.push_back(merged);
+    buffer_.clear();
+  }
+  // Returns the number of values written by serialize. Only valid after
+  // compress.
+  size_t serialized_size() const { return 2 * (centroids_.size() + 1); }
+  void serialize(double* out) const
+  {
+    out[0] = compression_;
+    out[1] = 0.0;
+    for (size_t idx = 0; idx < centroids_.size(); ++idx) {
+      out[2 * idx + 2] = centroids_[idx].mean;
+      out[2 * idx + 3] = centroids_[idx].weight;
+    }
+  }
+
+ private:
+  // The k1 scale function, which maps quantiles in [0, 1] to
+  // [-compression / 4, compression / 4]
+  double scale(double q) const
+  {
+    return compression_ / (2.0 * M_PI) * std::asin(2.0 * std::min(q, 1.0) - 1.0);
+  }
+  double inverse_scale(double k) const
+  {
+    if (k >= compression_ / 4.0) return 1.0;
+    return (std::sin(k * 2.0 * M_PI / compression_) + 1.0) / 2.0;
+  }
+
+ private:
+  double compression_;
+  size_t capacity_;
+  std::vector<Centroid> centroids_;
+  std::vector<Centroid> buffer_;
+};
+
+// Reads the serialized digest at values[0, size) into the given one
+inline void merge_serialized(TDigest& digest, const double* values, size_t size)
+{
+  // Skip the header, whose weight is zero
+  for (size_t idx = 2; idx + 1 < size; idx += 2)
+    digest.merge(Centroid{values[idx], values[idx + 1]});
+}
+
+// Reads the compression from the header of a serialized digest
+inline double serialized_compression(const double* values, size_t size)
+{
+  return size >= 2 ? values[0] : 1.0;
+}
+
+}  // namespace cunumeric
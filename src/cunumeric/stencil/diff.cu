@@ -0,0 +1,75 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/stencil/diff.h"
+#include "cunumeric/stencil/diff_template.inl"
+#include "cunumeric/pitches.h"
+
+#include "cunumeric/cuda_help.h"
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <typename OP, int DIM>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  diff_kernel(const RowAccessor<typename OP::VAL, DIM> out,
+              const RowAccessor<const typename OP::VAL, DIM> in,
+              const Pitches<DIM - 1> pitches,
+              size_t volume,
+              size_t step,
+              const typename OP::COEF* coefs,
+              int32_t order)
+{
+  const size_t idx = global_tid_1d();
+  if (idx >= volume) return;
+  auto offset      = pitches.unflatten(idx, Point<DIM>::ZEROES());
+  *out.ptr(offset) = diff_point<OP>(in.ptr(offset), step, coefs, order);
+}
+
+template <Type::Code CODE, int DIM>
+struct DiffImplBody<VariantKind::GPU, CODE, DIM> {
+  using OP   = DiffOp<CODE>;
+  using VAL  = legate_type_of<CODE>;
+  using COEF = typename OP::COEF;
+
+  void operator()(const RowAccessor<VAL, DIM>& out,
+                  const RowAccessor<const VAL, DIM>& in,
+                  const Rect<DIM>& rect,
+                  int32_t axis,
+                  const std::vector<COEF>& coefs,
+                  int32_t order) const
+  {
+    auto stream = get_cached_stream();
+
+    auto device_coefs = create_buffer<COEF>(coefs.size(), Memory::Z_COPY_MEM);
+    for (size_t k = 0; k < coefs.size(); ++k) device_coefs[k] = coefs[k];
+
+    Pitches<DIM - 1> pitches;
+    const size_t volume = pitches.flatten(rect);
+    const size_t blocks = (volume + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+    diff_kernel<OP, DIM><<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+      out, in, pitches, volume, in.stride(axis), device_coefs.ptr(0), order);
+    CHECK_CUDA_STREAM(stream);
+  }
+};
+
+/*static*/ void DiffTask::gpu_variant(TaskContext& context)
+{
+  diff_template<VariantKind::GPU>(context);
+}
+
+}  // namespace cunumeric
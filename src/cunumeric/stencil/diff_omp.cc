@@ -0,0 +1,51 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/stencil/diff.h"
+#include "cunumeric/stencil/diff_template.inl"
+
+#include <omp.h>
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <Type::Code CODE, int DIM>
+struct DiffImplBody<VariantKind::OMP, CODE, DIM> {
+  using OP  = DiffOp<CODE>;
+  using VAL = legate_type_of<CODE>;
+
+  void operator()(const RowAccessor<VAL, DIM>& out,
+                  const RowAccessor<const VAL, DIM>& in,
+                  const Rect<DIM>& rect,
+                  int32_t axis,
+                  const std::vector<typename OP::COEF>& coefs,
+                  int32_t order) const
+  {
+    RowPitches<DIM> rows;
+    const size_t num_rows = rows.flatten(rect, omp_get_max_threads());
+#pragma omp parallel for schedule(static)
+    for (size_t row = 0; row < num_rows; ++row)
+      diff_row<OP>(out, in, rows, row, axis, coefs.data(), order);
+  }
+};
+
+/*static*/ void DiffTask::omp_variant(TaskContext& context)
+{
+  diff_template<VariantKind::OMP>(context);
+}
+
+}  // namespace cunumeric
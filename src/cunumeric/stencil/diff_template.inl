@@ -0,0 +1,176 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/stencil/diff.h"
+#include "cunumeric/row_pitches.h"
+
+#include <vector>
+
+namespace cunumeric {
+
+using namespace legate;
+
+// The n-th order difference at a point is the sum of coefs[k] * in[k] for k
+// in [0, n], where in[k] is k elements further along the axis and coefs[k]
+// is the signed binomial coefficient (-1)^(n - k) * C(n, k). Floating-point
+// values are accumulated in their own type, except for half precision.
+template <Type::Code CODE, typename Enable = void>
+struct DiffOp {
+  using VAL  = legate_type_of<CODE>;
+  using COEF = double;
+  using ACC  = std::conditional_t<CODE == Type::Code::FLOAT16, float, VAL>;
+
+  __CUDA_HD__ static void fold(ACC& acc, COEF coef, const VAL& value)
+  {
+    acc += static_cast<ACC>(value) * static_cast<ACC>(coef);
+  }
+  __CUDA_HD__ static VAL finish(const ACC& acc) { return static_cast<VAL>(acc); }
+};
+
+// Integers are accumulated in 64-bit unsigned arithmetic, which wraps around
+// the same way as NumPy's repeated subtraction does for every integer width
+template <Type::Code CODE>
+struct DiffOp<CODE, std::enable_if_t<is_integral<CODE>::value && CODE != Type::Code::BOOL>> {
+  using VAL  = legate_type_of<CODE>;
+  using COEF = uint64_t;
+  using ACC  = uint64_t;
+
+  __CUDA_HD__ static void fold(ACC& acc, COEF coef, const VAL& value)
+  {
+    acc += static_cast<uint64_t>(value) * coef;
+  }
+  __CUDA_HD__ static VAL finish(const ACC& acc) { return static_cast<VAL>(acc); }
+};
+
+// Booleans are differenced with not_equal as in NumPy, which is subtraction
+// modulo two, so only the parity of the coefficients matters
+template <>
+struct DiffOp<Type::Code::BOOL> {
+  using VAL  = bool;
+  using COEF = uint64_t;
+  using ACC  = bool;
+
+  __CUDA_HD__ static void fold(ACC& acc, COEF coef, const VAL& value)
+  {
+    acc = acc != ((coef & 1) != 0 && value);
+  }
+  __CUDA_HD__ static VAL finish(const ACC& acc) { return acc; }
+};
+
+// Applies the first difference `order` times to the coefficients
+template <typename COEF>
+std::vector<COEF> diff_coefficients(int32_t order)
+{
+  std::vector<COEF> coefs(order + 1, COEF(0));
+  coefs[0] = COEF(1);
+  for (int32_t n = 1; n <= order; ++n)
+    for (int32_t k = n; k >= 0; --k) coefs[k] = (k > 0 ? coefs[k - 1] : COEF(0)) - coefs[k];
+  return coefs;
+}
+
+// Difference at the element `src`, whose successors along the axis are
+// `step` elements apart
+template <typename OP>
+__CUDA_HD__ inline typename OP::VAL diff_point(const typename OP::VAL* src,
+                                               size_t step,
+                                               const typename OP::COEF* coefs,
+                                               int32_t order)
+{
+  typename OP::ACC acc(0);
+  for (int32_t k = 0; k <= order; ++k) OP::fold(acc, coefs[k], src[k * step]);
+  return OP::finish(acc);
+}
+
+// Computes the differences along a row of the output. The offset of the row
+// is the same in the input, as both accessors start at the lower bound of the
+// output tile.
+template <typename OP, int DIM>
+void diff_row(const RowAccessor<typename OP::VAL, DIM>& out,
+              const RowAccessor<const typename OP::VAL, DIM>& in,
+              const RowPitches<DIM>& rows,
+              size_t row,
+              int32_t axis,
+              const typename OP::COEF* coefs,
+              int32_t order)
+{
+  using VAL           = typename OP::VAL;
+  const auto offset   = rows.row_offset(row);
+  const size_t length = rows.row_length(row);
+  auto outrow         = out[offset];
+  const VAL* inp      = in.ptr(offset);
+  const size_t step   = in.stride(axis);
+
+  auto diff = [&](size_t col) {
+    for (size_t j = 0; j < length; ++j)
+      outrow[j] = diff_point<OP>(inp + j * col, step, coefs, order);
+  };
+  // Unit strides are spelled out so that the compiler can vectorize
+  const size_t col = in.stride(DIM - 1);
+  if (col == 1)
+    diff(1);
+  else
+    diff(col);
+}
+
+template <VariantKind KIND, Type::Code CODE, int DIM>
+struct DiffImplBody;
+
+template <VariantKind KIND>
+struct DiffImpl {
+  template <Type::Code CODE, int DIM>
+  void operator()(DiffArgs& args) const
+  {
+    using OP  = DiffOp<CODE>;
+    using VAL = legate_type_of<CODE>;
+
+    auto rect = args.out.shape<DIM>();
+    if (rect.empty()) return;
+
+    // The tiles are only shifted upwards, so their union starts at the lower
+    // bound of the output tile
+    auto in_rect = rect;
+    for (size_t idx = 1; idx < args.inputs.size(); ++idx)
+      in_rect = in_rect.union_bbox(args.inputs[idx].shape<DIM>());
+
+    RowAccessor<VAL, DIM> out(args.out.write_accessor<VAL, DIM>(rect), rect);
+    // This is valid only because we colocate all shifted tiles with the main one
+    RowAccessor<const VAL, DIM> in(args.inputs[0].read_accessor<VAL, DIM>(in_rect), in_rect);
+
+    auto coefs = diff_coefficients<typename OP::COEF>(args.order);
+    DiffImplBody<KIND, CODE, DIM>()(out, in, rect, args.axis, coefs, args.order);
+  }
+};
+
+template <VariantKind KIND>
+static void diff_template(TaskContext& context)
+{
+  DiffArgs args;
+
+  auto& inputs  = context.inputs();
+  auto& scalars = context.scalars();
+
+  args.out = std::move(context.outputs()[0]);
+  for (auto& input : inputs) args.inputs.push_back(std::move(input));
+  args.order = scalars[0].value<int32_t>();
+  args.axis  = scalars[1].value<int32_t>();
+
+  double_dispatch(args.out.dim(), args.out.code(), DiffImpl<KIND>{}, args);
+}
+
+}  // namespace cunumeric
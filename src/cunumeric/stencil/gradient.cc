@@ -0,0 +1,59 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/stencil/gradient.h"
+#include "cunumeric/stencil/gradient_template.inl"
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <Type::Code CODE, int DIM>
+struct GradientImplBody<VariantKind::CPU, CODE, DIM> {
+  using OP  = GradientOp<CODE>;
+  using VAL = typename OP::VAL;
+  using OUT = typename OP::OUT;
+
+  void operator()(const RowAccessor<OUT, DIM>& out,
+                  const RowAccessor<const VAL, DIM>& in,
+                  const Rect<DIM>& rect,
+                  const Point<DIM>& in_lo,
+                  int32_t axis,
+                  int64_t extent,
+                  int32_t edge_order,
+                  const GradientSpacing& dx) const
+  {
+    RowPitches<DIM> rows;
+    const size_t num_rows = rows.flatten(rect);
+    for (size_t row = 0; row < num_rows; ++row)
+      gradient_row<OP>(out, in, rows, row, rect.lo, in_lo, axis, extent, edge_order, dx);
+  }
+};
+
+/*static*/ void GradientTask::cpu_variant(TaskContext& context)
+{
+  gradient_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void)
+{
+  GradientTask::register_variants();
+}
+}  // namespace
+
+}  // namespace cunumeric
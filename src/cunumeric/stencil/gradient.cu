@@ -0,0 +1,78 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/stencil/gradient.h"
+#include "cunumeric/stencil/gradient_template.inl"
+#include "cunumeric/pitches.h"
+
+#include "cunumeric/cuda_help.h"
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <typename OP, int DIM>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  gradient_kernel(const RowAccessor<typename OP::OUT, DIM> out,
+                  const RowAccessor<const typename OP::VAL, DIM> in,
+                  const Pitches<DIM - 1> pitches,
+                  size_t volume,
+                  const Point<DIM> lo,
+                  const Point<DIM> in_lo,
+                  int32_t axis,
+                  int64_t extent,
+                  int32_t edge_order,
+                  const GradientSpacing dx)
+{
+  const size_t idx = global_tid_1d();
+  if (idx >= volume) return;
+  auto point           = pitches.unflatten(idx, lo);
+  auto stencil         = gradient_stencil(point[axis], extent, edge_order, dx);
+  *out.ptr(point - lo) = gradient_point<OP>(in, in_lo, point, axis, stencil);
+}
+
+template <Type::Code CODE, int DIM>
+struct GradientImplBody<VariantKind::GPU, CODE, DIM> {
+  using OP  = GradientOp<CODE>;
+  using VAL = typename OP::VAL;
+  using OUT = typename OP::OUT;
+
+  void operator()(const RowAccessor<OUT, DIM>& out,
+                  const RowAccessor<const VAL, DIM>& in,
+                  const Rect<DIM>& rect,
+                  const Point<DIM>& in_lo,
+                  int32_t axis,
+                  int64_t extent,
+                  int32_t edge_order,
+                  const GradientSpacing& dx) const
+  {
+    auto stream = get_cached_stream();
+
+    Pitches<DIM - 1> pitches;
+    const size_t volume = pitches.flatten(rect);
+    const size_t blocks = (volume + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+    gradient_kernel<OP, DIM><<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+      out, in, pitches, volume, rect.lo, in_lo, axis, extent, edge_order, dx);
+    CHECK_CUDA_STREAM(stream);
+  }
+};
+
+/*static*/ void GradientTask::gpu_variant(TaskContext& context)
+{
+  gradient_template<VariantKind::GPU>(context);
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,52 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cunumeric/cunumeric.h"
+
+namespace cunumeric {
+
+struct GradientArgs {
+  Array out;
+  // The input tile aligned with the output, followed by the tiles shifted by
+  // up to `edge_order` elements either way along the axis
+  std::vector<Array> inputs;
+  // Coordinates of the points along the axis, only valid if the spacing is
+  // not uniform
+  Array coords;
+  int32_t axis;
+  int32_t edge_order;
+  int64_t extent;
+  bool uniform;
+  double spacing;
+};
+
+class GradientTask : public CuNumericTask<GradientTask> {
+ public:
+  static const int TASK_ID = CUNUMERIC_GRADIENT;
+
+ public:
+  static void cpu_variant(legate::TaskContext& context);
+#ifdef LEGATE_USE_OPENMP
+  static void omp_variant(legate::TaskContext& context);
+#endif
+#ifdef LEGATE_USE_CUDA
+  static void gpu_variant(legate::TaskContext& context);
+#endif
+};
+
+}  // namespace cunumeric
@@ -0,0 +1,210 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/stencil/gradient.h"
+#include "cunumeric/row_pitches.h"
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <Type::Code CODE>
+struct GradientOp {
+  using VAL = legate_type_of<CODE>;
+  // Integers have double-precision gradients, as in NumPy
+  using OUT = std::conditional_t<is_integral<CODE>::value, double, VAL>;
+  using ACC = std::conditional_t<CODE == Type::Code::FLOAT16, float, OUT>;
+
+  static constexpr bool valid = CODE != Type::Code::BOOL;
+};
+
+// Distance between a point and its successor along the axis
+struct GradientSpacing {
+  __CUDA_HD__ inline double operator()(coord_t idx) const
+  {
+    return uniform ? spacing : coords[idx + 1] - coords[idx];
+  }
+
+  bool uniform;
+  double spacing;
+  AccessorRO<double, 1> coords;
+};
+
+// The gradient at a point is the sum of weights[k] * in[first + k] along the
+// axis for k in [0, size)
+struct GradientStencil {
+  coord_t first;
+  int32_t size;
+  double weights[3];
+};
+
+// Same as NumPy, the gradient is computed with second-order accurate central
+// differences in the interior and with first or second-order accurate
+// one-sided differences at the boundaries, for arbitrary spacing
+__CUDA_HD__ inline GradientStencil gradient_stencil(coord_t idx,
+                                                    coord_t extent,
+                                                    int32_t edge_order,
+                                                    const GradientSpacing& dx)
+{
+  GradientStencil stencil;
+  if (idx > 0 && idx < extent - 1) {
+    const double dx1   = dx(idx - 1);
+    const double dx2   = dx(idx);
+    stencil.first      = idx - 1;
+    stencil.size       = 3;
+    stencil.weights[0] = -dx2 / (dx1 * (dx1 + dx2));
+    stencil.weights[1] = (dx2 - dx1) / (dx1 * dx2);
+    stencil.weights[2] = dx1 / (dx2 * (dx1 + dx2));
+  } else if (edge_order == 1) {
+    stencil.first      = idx == 0 ? 0 : extent - 2;
+    stencil.size       = 2;
+    stencil.weights[0] = -1.0 / dx(stencil.first);
+    stencil.weights[1] = 1.0 / dx(stencil.first);
+  } else if (idx == 0) {
+    const double dx1   = dx(0);
+    const double dx2   = dx(1);
+    stencil.first      = 0;
+    stencil.size       = 3;
+    stencil.weights[0] = -(2.0 * dx1 + dx2) / (dx1 * (dx1 + dx2));
+    stencil.weights[1] = (dx1 + dx2) / (dx1 * dx2);
+    stencil.weights[2] = -dx1 / (dx2 * (dx1 + dx2));
+  } else {
+    const double dx1   = dx(extent - 3);
+    const double dx2   = dx(extent - 2);
+    stencil.first      = extent - 3;
+    stencil.size       = 3;
+    stencil.weights[0] = dx2 / (dx1 * (dx1 + dx2));
+    stencil.weights[1] = -(dx2 + dx1) / (dx1 * dx2);
+    stencil.weights[2] = (2.0 * dx2 + dx1) / (dx2 * (dx1 + dx2));
+  }
+  return stencil;
+}
+
+// Gradient at the given point. Zero weights are skipped, so that e.g. the
+// central difference for uniform spacing ignores the value at the point
+// itself, as in NumPy.
+template <typename OP, int DIM>
+__CUDA_HD__ inline typename OP::OUT gradient_point(
+  const RowAccessor<const typename OP::VAL, DIM>& in,
+  const Point<DIM>& in_lo,
+  Point<DIM> point,
+  int32_t axis,
+  const GradientStencil& stencil)
+{
+  using ACC         = typename OP::ACC;
+  point[axis]       = stencil.first;
+  const auto* src   = in.ptr(point - in_lo);
+  const size_t step = in.stride(axis);
+  ACC acc(0);
+  for (int32_t k = 0; k < stencil.size; ++k) {
+    if (stencil.weights[k] == 0.0) continue;
+    acc += static_cast<ACC>(src[k * step]) * static_cast<ACC>(stencil.weights[k]);
+  }
+  return static_cast<typename OP::OUT>(acc);
+}
+
+// Computes the gradient along a row of the output. Unless the axis is the
+// last dimension, all elements of the row share the same stencil.
+template <typename OP, int DIM>
+void gradient_row(const RowAccessor<typename OP::OUT, DIM>& out,
+                  const RowAccessor<const typename OP::VAL, DIM>& in,
+                  const RowPitches<DIM>& rows,
+                  size_t row,
+                  const Point<DIM>& lo,
+                  const Point<DIM>& in_lo,
+                  int32_t axis,
+                  int64_t extent,
+                  int32_t edge_order,
+                  const GradientSpacing& dx)
+{
+  const auto offset   = rows.row_offset(row);
+  const size_t length = rows.row_length(row);
+  auto outrow         = out[offset];
+  auto point          = lo + offset;
+
+  auto stencil = gradient_stencil(point[axis], extent, edge_order, dx);
+  for (size_t j = 0; j < length; ++j, ++point[DIM - 1]) {
+    if (axis == DIM - 1 && j > 0) stencil = gradient_stencil(point[axis], extent, edge_order, dx);
+    outrow[j] = gradient_point<OP>(in, in_lo, point, axis, stencil);
+  }
+}
+
+template <VariantKind KIND, Type::Code CODE, int DIM>
+struct GradientImplBody;
+
+template <VariantKind KIND>
+struct GradientImpl {
+  template <Type::Code CODE, int DIM, std::enable_if_t<GradientOp<CODE>::valid>* = nullptr>
+  void operator()(GradientArgs& args) const
+  {
+    using OP  = GradientOp<CODE>;
+    using VAL = typename OP::VAL;
+    using OUT = typename OP::OUT;
+
+    auto rect = args.out.shape<DIM>();
+    if (rect.empty()) return;
+
+    auto in_rect = rect;
+    for (size_t idx = 1; idx < args.inputs.size(); ++idx)
+      in_rect = in_rect.union_bbox(args.inputs[idx].shape<DIM>());
+
+    RowAccessor<OUT, DIM> out(args.out.write_accessor<OUT, DIM>(rect), rect);
+    // This is valid only because we colocate all shifted tiles with the main one
+    RowAccessor<const VAL, DIM> in(args.inputs[0].read_accessor<VAL, DIM>(in_rect), in_rect);
+
+    GradientSpacing dx;
+    dx.uniform = args.uniform;
+    dx.spacing = args.spacing;
+    if (!args.uniform) dx.coords = args.coords.read_accessor<double, 1>(args.coords.shape<1>());
+
+    GradientImplBody<KIND, CODE, DIM>()(
+      out, in, rect, in_rect.lo, args.axis, args.extent, args.edge_order, dx);
+  }
+
+  template <Type::Code CODE, int DIM, std::enable_if_t<!GradientOp<CODE>::valid>* = nullptr>
+  void operator()(GradientArgs& args) const
+  {
+    assert(false);
+  }
+};
+
+template <VariantKind KIND>
+static void gradient_template(TaskContext& context)
+{
+  GradientArgs args;
+
+  auto& inputs  = context.inputs();
+  auto& scalars = context.scalars();
+
+  args.out        = std::move(context.outputs()[0]);
+  args.axis       = scalars[0].value<int32_t>();
+  args.edge_order = scalars[1].value<int32_t>();
+  args.extent     = scalars[2].value<int64_t>();
+  args.uniform    = scalars[3].value<bool>();
+  args.spacing    = scalars[4].value<double>();
+
+  // The coordinates, if any, follow the input tiles
+  const size_t num_tiles = args.uniform ? inputs.size() : inputs.size() - 1;
+  for (size_t idx = 0; idx < num_tiles; ++idx) args.inputs.push_back(std::move(inputs[idx]));
+  if (!args.uniform) args.coords = std::move(inputs.back());
+
+  double_dispatch(args.inputs[0].dim(), args.inputs[0].code(), GradientImpl<KIND>{}, args);
+}
+
+}  // namespace cunumeric
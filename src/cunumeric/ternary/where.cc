@@ -43,9 +43,21 @@ struct WhereImplBody<VariantKind::CPU, CODE, DIM> {
       for (size_t idx = 0; idx < volume; ++idx)
         outptr[idx] = maskptr[idx] ? in1ptr[idx] : in2ptr[idx];
     } else {
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto point = pitches.unflatten(idx, rect.lo);
-        out[point] = mask[point] ? in1[point] : in2[point];
+      RowPitches<DIM> rows;
+      const size_t num_rows = rows.flatten(rect);
+      RowAccessor<VAL, DIM> outrows(out, rect);
+      RowAccessor<const bool, DIM> maskrows(mask, rect);
+      RowAccessor<const VAL, DIM> in1rows(in1, rect);
+      RowAccessor<const VAL, DIM> in2rows(in2, rect);
+      for (size_t row = 0; row < num_rows; ++row) {
+        const auto offset   = rows.row_offset(row);
+        const size_t length = rows.row_length(row);
+        auto outrow         = outrows[offset];
+        auto maskrow        = maskrows[offset];
+        auto in1row         = in1rows[offset];
+        auto in2row         = in2rows[offset];
+        for (size_t idx = 0; idx < length; ++idx)
+          outrow[idx] = maskrow[idx] ? in1row[idx] : in2row[idx];
       }
     }
   }
@@ -17,6 +17,8 @@
 #include "cunumeric/ternary/where.h"
 #include "cunumeric/ternary/where_template.inl"
 
+#include <omp.h>
+
 namespace cunumeric {
 
 using namespace legate;
@@ -44,10 +46,22 @@ struct WhereImplBody<VariantKind::OMP, CODE, DIM> {
       for (size_t idx = 0; idx < volume; ++idx)
         outptr[idx] = maskptr[idx] ? in1ptr[idx] : in2ptr[idx];
     } else {
+      RowPitches<DIM> rows;
+      const size_t num_rows = rows.flatten(rect, omp_get_max_threads());
+      RowAccessor<VAL, DIM> outrows(out, rect);
+      RowAccessor<const bool, DIM> maskrows(mask, rect);
+      RowAccessor<const VAL, DIM> in1rows(in1, rect);
+      RowAccessor<const VAL, DIM> in2rows(in2, rect);
 #pragma omp parallel for schedule(static)
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto point = pitches.unflatten(idx, rect.lo);
-        out[point] = mask[point] ? in1[point] : in2[point];
+      for (size_t row = 0; row < num_rows; ++row) {
+        const auto offset   = rows.row_offset(row);
+        const size_t length = rows.row_length(row);
+        auto outrow         = outrows[offset];
+        auto maskrow        = maskrows[offset];
+        auto in1row         = in1rows[offset];
+        auto in2row         = in2rows[offset];
+        for (size_t idx = 0; idx < length; ++idx)
+          outrow[idx] = maskrow[idx] ? in1row[idx] : in2row[idx];
       }
     }
   }
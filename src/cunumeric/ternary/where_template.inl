@@ -19,6 +19,7 @@
 // Useful for IDEs
 #include "cunumeric/ternary/where.h"
 #include "cunumeric/pitches.h"
+#include "cunumeric/row_pitches.h"
 
 namespace cunumeric {
 
@@ -40,9 +40,16 @@ struct ConvertImplBody<VariantKind::CPU, NAN_OP, DST_TYPE, SRC_TYPE, DIM> {
       auto inptr  = in.ptr(rect);
       for (size_t idx = 0; idx < volume; ++idx) outptr[idx] = func(inptr[idx]);
     } else {
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto p = pitches.unflatten(idx, rect.lo);
-        out[p] = func(in[p]);
+      RowPitches<DIM> rows;
+      const size_t num_rows = rows.flatten(rect);
+      RowAccessor<DST, DIM> outrows(out, rect);
+      RowAccessor<const SRC, DIM> inrows(in, rect);
+      for (size_t row = 0; row < num_rows; ++row) {
+        const auto offset   = rows.row_offset(row);
+        const size_t length = rows.row_length(row);
+        auto outrow         = outrows[offset];
+        auto inrow          = inrows[offset];
+        for (size_t idx = 0; idx < length; ++idx) outrow[idx] = func(inrow[idx]);
       }
     }
   }
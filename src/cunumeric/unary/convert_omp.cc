@@ -17,6 +17,8 @@
 #include "cunumeric/unary/convert.h"
 #include "cunumeric/unary/convert_template.inl"
 
+#include <omp.h>
+
 namespace cunumeric {
 
 using namespace legate;
@@ -41,10 +43,17 @@ struct ConvertImplBody<VariantKind::OMP, NAN_OP, DST_TYPE, SRC_TYPE, DIM> {
 #pragma omp parallel for schedule(static)
       for (size_t idx = 0; idx < volume; ++idx) outptr[idx] = func(inptr[idx]);
     } else {
+      RowPitches<DIM> rows;
+      const size_t num_rows = rows.flatten(rect, omp_get_max_threads());
+      RowAccessor<DST, DIM> outrows(out, rect);
+      RowAccessor<const SRC, DIM> inrows(in, rect);
 #pragma omp parallel for schedule(static)
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto p = pitches.unflatten(idx, rect.lo);
-        out[p] = func(in[p]);
+      for (size_t row = 0; row < num_rows; ++row) {
+        const auto offset   = rows.row_offset(row);
+        const size_t length = rows.row_length(row);
+        auto outrow         = outrows[offset];
+        auto inrow          = inrows[offset];
+        for (size_t idx = 0; idx < length; ++idx) outrow[idx] = func(inrow[idx]);
       }
     }
   }
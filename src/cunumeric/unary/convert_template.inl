@@ -19,6 +19,7 @@
 // Useful for IDEs
 #include "cunumeric/unary/convert.h"
 #include "cunumeric/pitches.h"
+#include "cunumeric/row_pitches.h"
 #include "cunumeric/unary/convert_util.h"
 
 namespace cunumeric {
@@ -44,4 +44,24 @@ __CUDA_HD__ inline bool is_nan(const __half& x)
   return isnan(x);
 }
 
+// Orders NaNs after all other values, as in NumPy. Plain `<` is not a strict
+// weak ordering once NaNs are present.
+template <typename VAL>
+struct NanLastLess {
+  __CUDA_HD__ inline bool operator()(const VAL& a, const VAL& b) const
+  {
+    return !is_nan(a) && (is_nan(b) || a < b);
+  }
+};
+
+// Equality under which all NaNs are equal, so that they are deduplicated into
+// a single NaN as in NumPy
+template <typename VAL>
+struct NanEqual {
+  __CUDA_HD__ inline bool operator()(const VAL& a, const VAL& b) const
+  {
+    return a == b || (is_nan(a) && is_nan(b));
+  }
+};
+
 }  // namespace cunumeric
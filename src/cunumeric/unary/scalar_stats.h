@@ -0,0 +1,48 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cunumeric/cunumeric.h"
+
+namespace cunumeric {
+
+struct ScalarStatsArgs {
+  const Array& in;
+  const Array& min;
+  const Array& max;
+  const Array& sum;
+  const Array& count_nonzero;
+  const Array& nan_count;
+};
+
+// Computes min, max, sum, number of non-zeros and number of NaNs of an array
+// in a single traversal
+class ScalarStatsTask : public CuNumericTask<ScalarStatsTask> {
+ public:
+  static const int TASK_ID = CUNUMERIC_SCALAR_STATS;
+
+ public:
+  static void cpu_variant(legate::TaskContext& context);
+#ifdef LEGATE_USE_OPENMP
+  static void omp_variant(legate::TaskContext& context);
+#endif
+#ifdef LEGATE_USE_CUDA
+  static void gpu_variant(legate::TaskContext& context);
+#endif
+};
+
+}  // namespace cunumeric
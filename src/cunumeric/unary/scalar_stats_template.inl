@@ -0,0 +1,232 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include <core/utilities/typedefs.h>
+#include "cunumeric/cunumeric.h"
+#include "cunumeric/unary/scalar_stats.h"
+#include "cunumeric/unary/unary_red_util.h"
+#include "cunumeric/pitches.h"
+#include "cunumeric/execution_policy/reduction/scalar_reduction.h"
+
+namespace cunumeric {
+
+using namespace legate;
+
+// Integer sums are accumulated in 64 bits like in NumPy
+template <Type::Code CODE>
+constexpr Type::Code stats_sum_code()
+{
+  if constexpr (!is_integral<CODE>::value)
+    return CODE;
+  else if constexpr (CODE != Type::Code::BOOL && std::is_unsigned<legate_type_of<CODE>>::value)
+    return Type::Code::UINT64;
+  else
+    return Type::Code::INT64;
+}
+
+// Each statistic is reduced with the functor of the corresponding single
+// reduction, so that the results match those of the separate reductions
+template <Type::Code CODE>
+struct ScalarStatsOps {
+  using MIN   = UnaryRedOp<UnaryRedCode::MIN, CODE>;
+  using MAX   = UnaryRedOp<UnaryRedCode::MAX, CODE>;
+  using SUM   = UnaryRedOp<UnaryRedCode::SUM, stats_sum_code<CODE>()>;
+  using COUNT = UnaryRedOp<UnaryRedCode::COUNT_NONZERO, CODE>;
+
+  static constexpr bool valid = MIN::valid && MAX::valid;
+};
+
+template <Type::Code CODE>
+struct ScalarStats {
+  using OPS = ScalarStatsOps<CODE>;
+
+  typename OPS::MIN::VAL min;
+  typename OPS::MAX::VAL max;
+  typename OPS::SUM::VAL sum;
+  typename OPS::COUNT::VAL count_nonzero;
+  typename OPS::COUNT::VAL nan_count;
+};
+
+// The statistics don't depend on each other, so the fields can be folded
+// independently, including with atomics when the fold isn't exclusive
+template <Type::Code CODE>
+struct ScalarStatsReduction {
+  using OPS = ScalarStatsOps<CODE>;
+  using LHS = ScalarStats<CODE>;
+  using RHS = ScalarStats<CODE>;
+
+  static inline const ScalarStats<CODE> identity{OPS::MIN::OP::identity,
+                                                 OPS::MAX::OP::identity,
+                                                 OPS::SUM::OP::identity,
+                                                 OPS::COUNT::OP::identity,
+                                                 OPS::COUNT::OP::identity};
+
+  template <bool EXCLUSIVE>
+  __CUDA_HD__ static void apply(LHS& lhs, RHS rhs)
+  {
+    fold<EXCLUSIVE>(lhs, rhs);
+  }
+
+  template <bool EXCLUSIVE>
+  __CUDA_HD__ static void fold(RHS& rhs1, RHS rhs2)
+  {
+    OPS::MIN::template fold<EXCLUSIVE>(rhs1.min, rhs2.min);
+    OPS::MAX::template fold<EXCLUSIVE>(rhs1.max, rhs2.max);
+    OPS::SUM::template fold<EXCLUSIVE>(rhs1.sum, rhs2.sum);
+    OPS::COUNT::template fold<EXCLUSIVE>(rhs1.count_nonzero, rhs2.count_nonzero);
+    OPS::COUNT::template fold<EXCLUSIVE>(rhs1.nan_count, rhs2.nan_count);
+  }
+};
+
+// Scatters the combined statistics to one reduction accessor per output, so
+// that the outputs can be reduced with the built-in reduction operators
+template <Type::Code CODE>
+struct ScalarStatsOutput {
+  using OPS = ScalarStatsOps<CODE>;
+
+  AccessorRD<typename OPS::MIN::OP, true, 1> min;
+  AccessorRD<typename OPS::MAX::OP, true, 1> max;
+  AccessorRD<typename OPS::SUM::OP, true, 1> sum;
+  AccessorRD<typename OPS::COUNT::OP, true, 1> count_nonzero;
+  AccessorRD<typename OPS::COUNT::OP, true, 1> nan_count;
+
+  __CUDA_HD__ void reduce(const Point<1>& p, const ScalarStats<CODE>& stats) const
+  {
+    min.reduce(p, stats.min);
+    max.reduce(p, stats.max);
+    sum.reduce(p, stats.sum);
+    count_nonzero.reduce(p, stats.count_nonzero);
+    nan_count.reduce(p, stats.nan_count);
+  }
+};
+
+template <VariantKind KIND, Type::Code CODE, int DIM>
+struct ScalarStatsRed {
+  using OPS   = ScalarStatsOps<CODE>;
+  using LG_OP = ScalarStatsReduction<CODE>;
+  using LHS   = ScalarStats<CODE>;
+  using RHS   = legate_type_of<CODE>;
+  using IN    = AccessorRO<RHS, DIM>;
+
+  IN in;
+  const RHS* inptr;
+  ScalarStatsOutput<CODE> out;
+  size_t volume;
+  Pitches<DIM - 1> pitches;
+  Rect<DIM> rect;
+  Point<DIM> origin;
+  bool dense;
+
+  struct DenseReduction {};
+  struct SparseReduction {};
+
+  ScalarStatsRed(ScalarStatsArgs& args) : dense(false)
+  {
+    rect   = args.in.shape<DIM>();
+    origin = rect.lo;
+    in     = args.in.read_accessor<RHS, DIM>(rect);
+    volume = pitches.flatten(rect);
+
+    out.min           = args.min.reduce_accessor<typename OPS::MIN::OP, true, 1>();
+    out.max           = args.max.reduce_accessor<typename OPS::MAX::OP, true, 1>();
+    out.sum           = args.sum.reduce_accessor<typename OPS::SUM::OP, true, 1>();
+    out.count_nonzero = args.count_nonzero.reduce_accessor<typename OPS::COUNT::OP, true, 1>();
+    out.nan_count     = args.nan_count.reduce_accessor<typename OPS::COUNT::OP, true, 1>();
+
+#ifndef LEGATE_BOUNDS_CHECKS
+    // Check to see if this is dense or not
+    if (in.accessor.is_dense_row_major(rect)) {
+      dense = true;
+      inptr = in.ptr(rect);
+    }
+#endif
+  }
+
+  __CUDA_HD__ static void fold(LHS& lhs, const RHS& value, const LHS& identity)
+  {
+    using SUM_RHS = typename OPS::SUM::RHS;
+    OPS::MIN::template fold<true>(lhs.min, OPS::MIN::convert(value, identity.min));
+    OPS::MAX::template fold<true>(lhs.max, OPS::MAX::convert(value, identity.max));
+    OPS::SUM::template fold<true>(lhs.sum,
+                                  OPS::SUM::convert(static_cast<SUM_RHS>(value), identity.sum));
+    OPS::COUNT::template fold<true>(lhs.count_nonzero,
+                                    OPS::COUNT::convert(value, identity.count_nonzero));
+    if constexpr (is_floating_point<CODE>::value) lhs.nan_count += is_nan(value);
+  }
+
+  __CUDA_HD__ void operator()(LHS& lhs, size_t idx, LHS identity, DenseReduction) const noexcept
+  {
+    fold(lhs, inptr[idx], identity);
+  }
+
+  __CUDA_HD__ void operator()(LHS& lhs, size_t idx, LHS identity, SparseReduction) const noexcept
+  {
+    auto p = pitches.unflatten(idx, origin);
+    fold(lhs, in[p], identity);
+  }
+
+  void execute() const noexcept
+  {
+    auto identity = LG_OP::identity;
+#ifndef LEGATE_BOUNDS_CHECKS
+    // The constexpr if here prevents the DenseReduction from being instantiated for GPU kernels
+    // which limits compile times and binary sizes.
+    if constexpr (KIND != VariantKind::GPU) {
+      // Check to see if this is dense or not
+      if (dense) {
+        return ScalarReductionPolicy<KIND, LG_OP, DenseReduction>()(volume, out, identity, *this);
+      }
+    }
+#endif
+    return ScalarReductionPolicy<KIND, LG_OP, SparseReduction>()(volume, out, identity, *this);
+  }
+};
+
+template <VariantKind KIND>
+struct ScalarStatsImpl {
+  template <Type::Code CODE, int DIM, std::enable_if_t<ScalarStatsOps<CODE>::valid>* = nullptr>
+  void operator()(ScalarStatsArgs& args) const
+  {
+    ScalarStatsRed<KIND, CODE, DIM> red(args);
+    red.execute();
+  }
+
+  template <Type::Code CODE, int DIM, std::enable_if_t<!ScalarStatsOps<CODE>::valid>* = nullptr>
+  void operator()(ScalarStatsArgs& args) const
+  {
+    assert(false);
+  }
+};
+
+template <VariantKind KIND>
+static void scalar_stats_template(TaskContext& context)
+{
+  auto& reductions = context.reductions();
+
+  ScalarStatsArgs args{context.inputs()[0],
+                       reductions[0],
+                       reductions[1],
+                       reductions[2],
+                       reductions[3],
+                       reductions[4]};
+  auto dim = std::max(1, args.in.dim());
+  double_dispatch(dim, args.in.code(), ScalarStatsImpl<KIND>{}, args);
+}
+
+}  // namespace cunumeric
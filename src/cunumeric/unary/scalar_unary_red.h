@@ -27,6 +27,7 @@ struct ScalarUnaryRedArgs {
   const Array& where;
   UnaryRedCode op_code;
   legate::DomainPoint shape;
+  bool pairwise;
   std::vector<legate::Store> args;
 };
 
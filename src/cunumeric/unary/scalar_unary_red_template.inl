@@ -48,6 +48,7 @@ struct ScalarUnaryRed {
   Point<DIM> shape;
   RHS to_find;
   RHS mu;
+  bool pairwise;
   bool dense;
   WHERE where;
   const bool* whereptr;
@@ -55,7 +56,7 @@ struct ScalarUnaryRed {
   struct DenseReduction {};
   struct SparseReduction {};
 
-  ScalarUnaryRed(ScalarUnaryRedArgs& args) : dense(false)
+  ScalarUnaryRed(ScalarUnaryRedArgs& args) : pairwise(args.pairwise), dense(false)
   {
     rect   = args.in.shape<DIM>();
     origin = rect.lo;
@@ -120,13 +121,28 @@ struct ScalarUnaryRed {
   void execute() const noexcept
   {
     auto identity = LG_OP::identity;
+    if constexpr (KIND != VariantKind::GPU && is_pairwise_sum<OP_CODE, CODE>::value) {
+      if (pairwise) {
+        if (dense)
+          return ScalarReductionPolicy<KIND, LG_OP, Pairwise<DenseReduction>>()(
+            volume, out, identity, *this);
+        else
+          return ScalarReductionPolicy<KIND, LG_OP, Pairwise<SparseReduction>>()(
+            volume, out, identity, *this);
+      }
+    }
 #ifndef LEGATE_BOUNDS_CHECKS
     // The constexpr if here prevents the DenseReduction from being instantiated for GPU kernels
     // which limits compile times and binary sizes.
     if constexpr (KIND != VariantKind::GPU) {
       // Check to see if this is dense or not
       if (dense) {
-        return ScalarReductionPolicy<KIND, LG_OP, DenseReduction>()(volume, out, identity, *this);
+        if constexpr (is_arg_reduce<OP_CODE>::value)
+          return ScalarReductionPolicy<KIND, LG_OP, DenseReduction>()(
+            volume, out, identity, *this);
+        else
+          return ScalarReductionPolicy<KIND, LG_OP, MultiAccumulator<DenseReduction>>()(
+            volume, out, identity, *this);
       }
     }
 #endif
@@ -169,6 +185,7 @@ static void scalar_unary_red_template(TaskContext& context)
   auto op_code     = scalars[0].value<UnaryRedCode>();
   auto shape       = scalars[1].value<DomainPoint>();
   bool has_where   = scalars[2].value<bool>();
+  bool pairwise    = scalars[3].value<bool>();
   size_t start_idx = has_where ? 2 : 1;
   std::vector<Store> extra_args;
   extra_args.reserve(inputs.size() - start_idx);
@@ -186,6 +203,7 @@ static void scalar_unary_red_template(TaskContext& context)
                           has_where ? inputs[1] : dummy_where,
                           op_code,
                           shape,
+                          pairwise,
                           std::move(extra_args)};
   op_dispatch(args.op_code, ScalarUnaryRedDispatch<KIND>{}, args, has_where);
 }
@@ -0,0 +1,74 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/unary/segmented_red.h"
+#include "cunumeric/unary/segmented_red_template.inl"
+
+#include <vector>
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <UnaryRedCode OP_CODE, Type::Code CODE, int DIM>
+struct SegmentedRedImplBody<VariantKind::CPU, OP_CODE, CODE, DIM> {
+  using OP    = UnaryRedOp<OP_CODE, CODE>;
+  using LG_OP = typename OP::OP;
+  using RHS   = legate_type_of<CODE>;
+  using VAL   = typename OP::VAL;
+
+  void operator()(SegmentedRedArgs& args,
+                  const RowAccessor<const RHS, DIM>& rhs,
+                  const AccessorRO<int64_t, 1>& offsets,
+                  coord_t num_segments,
+                  const ScanLines<DIM>& lines,
+                  size_t num_lines,
+                  const Rect<DIM>& rect) const
+  {
+    auto piece = find_piece_segments(offsets, num_segments, args.extent, rect, lines.axis);
+    SegmentResults<VAL, DIM> out;
+    auto head_segment = create_results(args, rect, piece, out);
+
+    head_segment[Point<DIM>::ZEROES()] = piece.head;
+    fill_head(out, num_lines, LG_OP::identity);
+
+    std::vector<VAL> results(lines.width);
+    for (coord_t segment = out.begin(); segment < out.end(); ++segment) {
+      coord_t start, stop;
+      clip_segment(offsets, segment, num_segments, args.extent, rect, lines.axis, start, stop);
+      for (size_t line = 0; line < num_lines; line += lines.width) {
+        auto offset = lines.line_offset(line);
+        fold_segment<OP>(rhs, lines, offset, start, stop, results.data(), lines.width);
+        store_segment(out, offset, segment, results.data(), lines.width);
+      }
+    }
+  }
+};
+
+/*static*/ void SegmentedRedTask::cpu_variant(TaskContext& context)
+{
+  segmented_red_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void)
+{
+  SegmentedRedTask::register_variants();
+}
+}  // namespace
+
+}  // namespace cunumeric
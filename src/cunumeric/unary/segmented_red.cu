@@ -0,0 +1,187 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/unary/segmented_red.h"
+#include "cunumeric/unary/segmented_red_template.inl"
+
+#include <thrust/fill.h>
+#include <thrust/scan.h>
+#include <cub/thread/thread_search.cuh>
+
+#include "cunumeric/cuda_help.h"
+
+namespace cunumeric {
+
+using namespace legate;
+
+// Segments are split into tiles of at most this many elements along the axis,
+// so that long segments are reduced by many threads
+static constexpr coord_t SEGMENT_TILE = 256;
+
+template <int DIM>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  find_segments_kernel(const AccessorRO<int64_t, 1> offsets,
+                       coord_t num_segments,
+                       int64_t extent,
+                       const Rect<DIM> rect,
+                       int32_t axis,
+                       PieceSegments* piece)
+{
+  if (global_tid_1d() > 0) return;
+  *piece = find_piece_segments(offsets, num_segments, extent, rect, axis);
+}
+
+template <int DIM>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  count_tiles_kernel(const AccessorRO<int64_t, 1> offsets,
+                     coord_t first,
+                     coord_t count,
+                     coord_t num_segments,
+                     int64_t extent,
+                     const Rect<DIM> rect,
+                     int32_t axis,
+                     int64_t* tiles)
+{
+  const coord_t idx = global_tid_1d();
+  if (idx >= count) return;
+  coord_t start, stop;
+  clip_segment(offsets, first + idx, num_segments, extent, rect, axis, start, stop);
+  tiles[idx] = (stop - start + SEGMENT_TILE - 1) / SEGMENT_TILE;
+}
+
+// Each thread reduces one tile of one line into the result of its segment.
+// Consecutive threads take adjacent lines, so that their accesses are
+// coalesced unless the axis is the last dimension.
+template <typename OP, typename RHS, int DIM>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  segmented_red_kernel(const SegmentResults<typename OP::VAL, DIM> out,
+                       const RowAccessor<const RHS, DIM> rhs,
+                       const AccessorRO<int64_t, 1> offsets,
+                       coord_t num_segments,
+                       int64_t extent,
+                       const ScanLines<DIM> lines,
+                       size_t num_lines,
+                       const Rect<DIM> rect,
+                       const int64_t* tiles_end,
+                       size_t volume,
+                       typename OP::VAL identity)
+{
+  const size_t idx = global_tid_1d();
+  if (idx >= volume) return;
+  const size_t line  = idx % num_lines;
+  const int64_t tile = idx / num_lines;
+
+  // The first segment whose tiles end after this one
+  const coord_t count   = out.end() - out.begin();
+  const coord_t index   = cub::UpperBound(tiles_end, count, tile);
+  const int64_t first   = index > 0 ? tiles_end[index - 1] : 0;
+  const coord_t segment = out.begin() + index;
+
+  coord_t start, stop;
+  clip_segment(offsets, segment, num_segments, extent, rect, lines.axis, start, stop);
+  const coord_t lo = start + (tile - first) * SEGMENT_TILE;
+  const coord_t hi = lo + SEGMENT_TILE < stop ? lo + SEGMENT_TILE : stop;
+
+  auto offset       = lines.line_offset(line);
+  const RHS* inp    = rhs.ptr(offset);
+  const size_t step = rhs.stride(lines.axis);
+  auto result       = identity;
+  for (coord_t k = lo; k < hi; ++k)
+    OP::template fold<true>(result, OP::convert(inp[k * step], identity));
+
+  OP::template fold<false>(out(offset, segment), result);
+}
+
+template <UnaryRedCode OP_CODE, Type::Code CODE, int DIM>
+struct SegmentedRedImplBody<VariantKind::GPU, OP_CODE, CODE, DIM> {
+  using OP    = UnaryRedOp<OP_CODE, CODE>;
+  using LG_OP = typename OP::OP;
+  using RHS   = legate_type_of<CODE>;
+  using VAL   = typename OP::VAL;
+
+  void operator()(SegmentedRedArgs& args,
+                  const RowAccessor<const RHS, DIM>& rhs,
+                  const AccessorRO<int64_t, 1>& offsets,
+                  coord_t num_segments,
+                  const ScanLines<DIM>& lines,
+                  size_t num_lines,
+                  const Rect<DIM>& rect) const
+  {
+    auto stream = get_cached_stream();
+
+    auto found = create_buffer<PieceSegments>(1);
+    find_segments_kernel<<<1, 1, 0, stream>>>(
+      offsets, num_segments, args.extent, rect, lines.axis, found.ptr(0));
+    PieceSegments piece;
+    CHECK_CUDA(cudaMemcpyAsync(
+      &piece, found.ptr(0), sizeof(PieceSegments), cudaMemcpyDeviceToHost, stream));
+    CHECK_CUDA(cudaStreamSynchronize(stream));
+
+    // Tiles of several lines and segments fold into the results, which start
+    // out as the identity
+    SegmentResults<VAL, DIM> out;
+    auto head_segment = create_results(args, rect, piece, out);
+
+    auto head_ptr         = out.head.ptr(Point<DIM>::ZEROES());
+    auto head_segment_ptr = head_segment.ptr(Point<DIM>::ZEROES());
+    thrust::fill(DEFAULT_POLICY.on(stream), head_segment_ptr, head_segment_ptr + 1, piece.head);
+    thrust::fill(DEFAULT_POLICY.on(stream), head_ptr, head_ptr + num_lines, LG_OP::identity);
+
+    const size_t num_owned = num_lines * (piece.last - piece.first);
+    if (num_owned > 0) {
+      auto owned_ptr = out.owned.ptr(Point<DIM>::ZEROES());
+      thrust::fill(DEFAULT_POLICY.on(stream), owned_ptr, owned_ptr + num_owned, LG_OP::identity);
+    }
+
+    // Lays the tiles of all segments out one after another
+    const coord_t count = out.end() - out.begin();
+    if (count > 0) {
+      auto tiles          = create_buffer<int64_t>(count);
+      const size_t blocks = (count + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+      count_tiles_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+        offsets, out.begin(), count, num_segments, args.extent, rect, lines.axis, tiles.ptr(0));
+      thrust::inclusive_scan(
+        DEFAULT_POLICY.on(stream), tiles.ptr(0), tiles.ptr(0) + count, tiles.ptr(0));
+
+      int64_t num_tiles;
+      CHECK_CUDA(cudaMemcpyAsync(
+        &num_tiles, tiles.ptr(count - 1), sizeof(int64_t), cudaMemcpyDeviceToHost, stream));
+      CHECK_CUDA(cudaStreamSynchronize(stream));
+
+      const size_t volume     = num_tiles * num_lines;
+      const size_t num_blocks = (volume + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+      segmented_red_kernel<OP><<<num_blocks, THREADS_PER_BLOCK, 0, stream>>>(out,
+                                                                             rhs,
+                                                                             offsets,
+                                                                             num_segments,
+                                                                             args.extent,
+                                                                             lines,
+                                                                             num_lines,
+                                                                             rect,
+                                                                             tiles.ptr(0),
+                                                                             volume,
+                                                                             LG_OP::identity);
+    }
+    CHECK_CUDA_STREAM(stream);
+  }
+};
+
+/*static*/ void SegmentedRedTask::gpu_variant(TaskContext& context)
+{
+  segmented_red_template<VariantKind::GPU>(context);
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,54 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cunumeric/cunumeric.h"
+#include "cunumeric/unary/unary_red_util.h"
+
+namespace cunumeric {
+
+struct SegmentedRedArgs {
+  const Array& rhs;
+  const Array& offsets;
+  Array& result;
+  Array& heads;
+  Array& head_segments;
+  UnaryRedCode op_code;
+  int32_t axis;
+  int64_t extent;
+};
+
+// Reductions that ufunc.reduceat maps onto
+template <UnaryRedCode OP_CODE>
+constexpr bool is_segmented_red = OP_CODE == UnaryRedCode::MAX || OP_CODE == UnaryRedCode::MIN ||
+                                  OP_CODE == UnaryRedCode::PROD || OP_CODE == UnaryRedCode::SUM;
+
+class SegmentedRedTask : public CuNumericTask<SegmentedRedTask> {
+ public:
+  static const int TASK_ID = CUNUMERIC_SEGMENTED_RED;
+
+ public:
+  static void cpu_variant(legate::TaskContext& context);
+#ifdef LEGATE_USE_OPENMP
+  static void omp_variant(legate::TaskContext& context);
+#endif
+#ifdef LEGATE_USE_CUDA
+  static void gpu_variant(legate::TaskContext& context);
+#endif
+};
+
+}  // namespace cunumeric
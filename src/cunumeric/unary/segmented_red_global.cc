@@ -0,0 +1,58 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "cunumeric/unary/segmented_red_global.h"
+#include "cunumeric/unary/segmented_red_global_template.inl"
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <UnaryRedCode OP_CODE, Type::Code CODE, int DIM>
+struct SegmentedRedGlobalImplBody<VariantKind::CPU, OP_CODE, CODE, DIM> {
+  using OP  = UnaryRedOp<OP_CODE, CODE>;
+  using VAL = typename OP::VAL;
+
+  void operator()(const AccessorRW<VAL, DIM>& result,
+                  const AccessorRO<VAL, DIM>& heads,
+                  const AccessorRO<int64_t, DIM>& head_segments,
+                  const ScanLines<DIM>& lines,
+                  size_t num_lines,
+                  const Rect<DIM>& rect,
+                  const Point<DIM>& color,
+                  coord_t num_colors) const
+  {
+    for (size_t line = 0; line < num_lines; ++line) {
+      auto point        = rect.lo + lines.line_offset(line);
+      point[lines.axis] = rect.hi[lines.axis];
+      carry_heads<OP>(result, heads, head_segments, point, color, num_colors, lines.axis);
+    }
+  }
+};
+
+/*static*/ void SegmentedRedGlobalTask::cpu_variant(TaskContext& context)
+{
+  segmented_red_global_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void)
+{
+  SegmentedRedGlobalTask::register_variants();
+}
+}  // namespace
+
+}  // namespace cunumeric
@@ -0,0 +1,45 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#pragma once
+
+#include "cunumeric/unary/segmented_red.h"
+
+namespace cunumeric {
+
+struct SegmentedRedGlobalArgs {
+  const Array& heads;
+  const Array& head_segments;
+  const Array& result;
+  UnaryRedCode op_code;
+  int32_t axis;
+  const legate::DomainPoint& partition_index;
+};
+
+class SegmentedRedGlobalTask : public CuNumericTask<SegmentedRedGlobalTask> {
+ public:
+  static const int TASK_ID = CUNUMERIC_SEGMENTED_RED_GLOBAL;
+
+ public:
+  static void cpu_variant(legate::TaskContext& context);
+#ifdef LEGATE_USE_OPENMP
+  static void omp_variant(legate::TaskContext& context);
+#endif
+#ifdef LEGATE_USE_CUDA
+  static void gpu_variant(legate::TaskContext& context);
+#endif
+};
+
+}  // namespace cunumeric
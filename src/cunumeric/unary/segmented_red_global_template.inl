@@ -0,0 +1,119 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/unary/segmented_red_global.h"
+#include "cunumeric/scan/scan_lines.h"
+
+namespace cunumeric {
+
+using namespace legate;
+
+// Folds the heads of the pieces after this one along the axis into the
+// result of the last segment of this piece, for the line at the given point,
+// for as long as that segment runs on into them
+template <typename OP, int DIM>
+__CUDA_HD__ inline void carry_heads(const AccessorRW<typename OP::VAL, DIM>& result,
+                                    const AccessorRO<typename OP::VAL, DIM>& heads,
+                                    const AccessorRO<int64_t, DIM>& head_segments,
+                                    const Point<DIM>& point,
+                                    Point<DIM> color,
+                                    coord_t num_colors,
+                                    int32_t axis)
+{
+  const coord_t segment = point[axis];
+  auto& acc             = result[point];
+  auto head             = point;
+  for (coord_t c = color[axis] + 1; c < num_colors; ++c) {
+    color[axis] = c;
+    if (head_segments[color] != segment) break;
+    head[axis] = c;
+    OP::template fold<true>(acc, heads[head]);
+  }
+}
+
+template <VariantKind KIND, UnaryRedCode OP_CODE, Type::Code CODE, int DIM>
+struct SegmentedRedGlobalImplBody;
+
+template <VariantKind KIND, UnaryRedCode OP_CODE>
+struct SegmentedRedGlobalImpl {
+  template <Type::Code CODE, int DIM, std::enable_if_t<UnaryRedOp<OP_CODE, CODE>::valid>* = nullptr>
+  void operator()(SegmentedRedGlobalArgs& args) const
+  {
+    using OP  = UnaryRedOp<OP_CODE, CODE>;
+    using VAL = typename OP::VAL;
+
+    auto rect               = args.result.shape<DIM>();
+    auto heads_rect         = args.heads.shape<DIM>();
+    auto head_segments_rect = args.head_segments.shape<DIM>();
+
+    // The last piece along the axis has no heads after it
+    const coord_t num_colors = head_segments_rect.hi[args.axis] + 1;
+    if (args.partition_index[args.axis] + 1 >= num_colors) return;
+
+    ScanLines<DIM> lines;
+    size_t num_lines = lines.flatten(rect, args.axis);
+
+    if (num_lines == 0) return;
+
+    Point<DIM> color;
+    for (int32_t dim = 0; dim < DIM; ++dim) color[dim] = args.partition_index[dim];
+
+    auto result        = args.result.read_write_accessor<VAL, DIM>(rect);
+    auto heads         = args.heads.read_accessor<VAL, DIM>(heads_rect);
+    auto head_segments = args.head_segments.read_accessor<int64_t, DIM>(head_segments_rect);
+
+    SegmentedRedGlobalImplBody<KIND, OP_CODE, CODE, DIM>()(
+      result, heads, head_segments, lines, num_lines, rect, color, num_colors);
+  }
+
+  template <Type::Code CODE,
+            int DIM,
+            std::enable_if_t<!UnaryRedOp<OP_CODE, CODE>::valid>* = nullptr>
+  void operator()(SegmentedRedGlobalArgs& args) const
+  {
+    assert(false);
+  }
+};
+
+template <VariantKind KIND>
+struct SegmentedRedGlobalDispatch {
+  template <UnaryRedCode OP_CODE>
+  void operator()(SegmentedRedGlobalArgs& args) const
+  {
+    if constexpr (is_segmented_red<OP_CODE>)
+      double_dispatch(
+        args.result.dim(), args.result.code(), SegmentedRedGlobalImpl<KIND, OP_CODE>{}, args);
+    else
+      assert(false);
+  }
+};
+
+template <VariantKind KIND>
+static void segmented_red_global_template(TaskContext& context)
+{
+  auto task_index = context.get_task_index();
+  SegmentedRedGlobalArgs args{context.inputs()[1],
+                              context.inputs()[2],
+                              context.outputs()[0],
+                              context.scalars()[0].value<UnaryRedCode>(),
+                              context.scalars()[1].value<int32_t>(),
+                              task_index};
+  op_dispatch(args.op_code, SegmentedRedGlobalDispatch<KIND>{}, args);
+}
+
+}  // namespace cunumeric
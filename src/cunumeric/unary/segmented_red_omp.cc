@@ -0,0 +1,128 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/unary/segmented_red.h"
+#include "cunumeric/unary/segmented_red_template.inl"
+
+#include <omp.h>
+#include <algorithm>
+#include <vector>
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <UnaryRedCode OP_CODE, Type::Code CODE, int DIM>
+struct SegmentedRedImplBody<VariantKind::OMP, OP_CODE, CODE, DIM> {
+  using OP    = UnaryRedOp<OP_CODE, CODE>;
+  using LG_OP = typename OP::OP;
+  using RHS   = legate_type_of<CODE>;
+  using VAL   = typename OP::VAL;
+
+  struct Segment {
+    coord_t index;
+    coord_t start;
+    coord_t stop;
+  };
+
+  void operator()(SegmentedRedArgs& args,
+                  const RowAccessor<const RHS, DIM>& rhs,
+                  const AccessorRO<int64_t, 1>& offsets,
+                  coord_t num_segments,
+                  const ScanLines<DIM>& lines,
+                  size_t num_lines,
+                  const Rect<DIM>& rect) const
+  {
+    auto piece = find_piece_segments(offsets, num_segments, args.extent, rect, lines.axis);
+    SegmentResults<VAL, DIM> out;
+    auto head_segment = create_results(args, rect, piece, out);
+
+    head_segment[Point<DIM>::ZEROES()] = piece.head;
+    fill_head(out, num_lines, LG_OP::identity);
+
+    std::vector<Segment> segments;
+    for (coord_t segment = out.begin(); segment < out.end(); ++segment) {
+      coord_t start, stop;
+      clip_segment(offsets, segment, num_segments, args.extent, rect, lines.axis, start, stop);
+      segments.push_back(Segment{segment, start, stop});
+    }
+
+    const size_t num_threads = omp_get_max_threads();
+    const size_t chunk       = lines.chunk_size(num_lines, num_threads);
+    const size_t per_row     = (lines.width + chunk - 1) / chunk;
+    const size_t num_chunks  = num_lines / lines.width * per_row;
+    const size_t num_items   = segments.size() * num_chunks;
+
+    auto locate = [&](size_t idx, Point<DIM>& offset, size_t& count) {
+      const size_t first = (idx % per_row) * chunk;
+      offset             = lines.line_offset(idx / per_row * lines.width + first);
+      count              = std::min(chunk, lines.width - first);
+    };
+
+    // Each thread reduces whole chunks of lines over whole segments, which
+    // write disjoint results
+    if (num_items >= num_threads) {
+#pragma omp parallel
+      {
+        std::vector<VAL> results(chunk);
+#pragma omp for schedule(static)
+        for (size_t item = 0; item < num_items; ++item) {
+          const Segment& segment = segments[item / num_chunks];
+          Point<DIM> offset;
+          size_t count;
+          locate(item % num_chunks, offset, count);
+          fold_segment<OP>(rhs, lines, offset, segment.start, segment.stop, results.data(), count);
+          store_segment(out, offset, segment.index, results.data(), count);
+        }
+      }
+      return;
+    }
+
+    // Otherwise there are few long segments, each of which is split among all
+    // threads, whose partial results are combined in order
+    std::vector<VAL> partials(num_threads * chunk);
+    std::vector<VAL> results(chunk);
+    for (size_t item = 0; item < num_items; ++item) {
+      const Segment& segment = segments[item / num_chunks];
+      Point<DIM> offset;
+      size_t count;
+      locate(item % num_chunks, offset, count);
+      const coord_t length = segment.stop - segment.start;
+      // The region may run on fewer threads than requested
+      std::fill(partials.begin(), partials.end(), LG_OP::identity);
+#pragma omp parallel
+      {
+        const coord_t tid   = omp_get_thread_num();
+        const coord_t parts = omp_get_num_threads();
+        const coord_t start = segment.start + length * tid / parts;
+        const coord_t stop  = segment.start + length * (tid + 1) / parts;
+        fold_segment<OP>(rhs, lines, offset, start, stop, &partials[tid * chunk], count);
+      }
+      for (size_t j = 0; j < count; ++j) results[j] = LG_OP::identity;
+      for (size_t tid = 0; tid < num_threads; ++tid)
+        for (size_t j = 0; j < count; ++j)
+          OP::template fold<true>(results[j], partials[tid * chunk + j]);
+      store_segment(out, offset, segment.index, results.data(), count);
+    }
+  }
+};
+
+/*static*/ void SegmentedRedTask::omp_variant(TaskContext& context)
+{
+  segmented_red_template<VariantKind::OMP>(context);
+}
+
+}  // namespace cunumeric
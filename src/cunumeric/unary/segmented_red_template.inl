@@ -0,0 +1,255 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/unary/segmented_red.h"
+#include "cunumeric/scan/scan_lines.h"
+
+namespace cunumeric {
+
+using namespace legate;
+
+// Segment s spans [offsets[s], offsets[s + 1]) along the axis, or only the
+// element at offsets[s] if the next offset is not greater, as in NumPy. The
+// last segment runs to the end of the axis. Clips the segment to the piece
+// along the axis and returns false if nothing is left. The bounds are
+// relative to the lower bound of the piece.
+template <int DIM>
+__CUDA_HD__ inline bool clip_segment(const AccessorRO<int64_t, 1>& offsets,
+                                     coord_t segment,
+                                     coord_t num_segments,
+                                     int64_t extent,
+                                     const Rect<DIM>& rect,
+                                     int32_t axis,
+                                     coord_t& start,
+                                     coord_t& stop)
+{
+  const int64_t first = offsets[segment];
+  const int64_t next  = segment + 1 < num_segments ? offsets[segment + 1] : extent;
+  const int64_t last  = next > first ? next : first + 1;
+  start               = (first > rect.lo[axis] ? first : rect.lo[axis]) - rect.lo[axis];
+  stop                = (last < rect.hi[axis] + 1 ? last : rect.hi[axis] + 1) - rect.lo[axis];
+  return start < stop;
+}
+
+// Folds elements [start, stop) along the axis of `count` adjacent lines from
+// the given offset into results, which start out as the identity
+template <typename OP, typename RHS, int DIM>
+void fold_segment(const RowAccessor<const RHS, DIM>& rhs,
+                  const ScanLines<DIM>& lines,
+                  const Point<DIM>& offset,
+                  coord_t start,
+                  coord_t stop,
+                  typename OP::VAL* results,
+                  size_t count)
+{
+  using VAL          = typename OP::VAL;
+  const VAL identity = OP::OP::identity;
+  for (size_t j = 0; j < count; ++j) results[j] = identity;
+
+  const RHS* inp    = rhs.ptr(offset);
+  const size_t step = rhs.stride(lines.axis);
+
+  auto fold = [&](size_t col) {
+    for (coord_t k = start; k < stop; ++k) {
+      const RHS* src = inp + k * step;
+      for (size_t j = 0; j < count; ++j)
+        OP::template fold<true>(results[j], OP::convert(src[j * col], identity));
+    }
+  };
+  // Unit strides are spelled out so that the compiler can vectorize
+  const size_t col = rhs.stride(DIM - 1);
+  if (col == 1)
+    fold(1);
+  else
+    fold(col);
+}
+
+// The segments whose results a piece produces. A piece owns the segments
+// [first, last) that start in it, which only form a range if the offsets are
+// sorted, and all of them if it spans the whole axis. If the segment before
+// them runs on into the piece, it is the head segment, and -1 otherwise.
+struct PieceSegments {
+  coord_t first;
+  coord_t last;
+  coord_t head;
+};
+
+template <int DIM>
+__CUDA_HD__ inline PieceSegments find_piece_segments(const AccessorRO<int64_t, 1>& offsets,
+                                                     coord_t num_segments,
+                                                     int64_t extent,
+                                                     const Rect<DIM>& rect,
+                                                     int32_t axis)
+{
+  if (rect.lo[axis] == 0 && rect.hi[axis] == extent - 1) return PieceSegments{0, num_segments, -1};
+  // Returns the number of segments that start before the given position
+  auto count_before = [&](coord_t position) {
+    coord_t lo = 0;
+    coord_t hi = num_segments;
+    while (lo < hi) {
+      const coord_t mid = (lo + hi) / 2;
+      if (offsets[mid] < position)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    return lo;
+  };
+  PieceSegments segments{count_before(rect.lo[axis]), count_before(rect.hi[axis] + 1), -1};
+  coord_t start, stop;
+  if (segments.first > 0 &&
+      clip_segment(offsets, segments.first - 1, num_segments, extent, rect, axis, start, stop))
+    segments.head = segments.first - 1;
+  return segments;
+}
+
+// The results of a piece: those of the owned segments, one after another
+// along the axis, and that of the head segment
+template <typename VAL, int DIM>
+struct SegmentResults {
+  Buffer<VAL, DIM> owned;
+  Buffer<VAL, DIM> head;
+  PieceSegments segments;
+  int32_t axis;
+
+  // Result of the line at the given offset for a segment of the piece
+  __CUDA_HD__ VAL& operator()(Point<DIM> offset, coord_t segment) const
+  {
+    if (segment < segments.first) {
+      offset[axis] = 0;
+      return head[offset];
+    }
+    offset[axis] = segment - segments.first;
+    return owned[offset];
+  }
+  // Returns the first segment that the piece reduces
+  __CUDA_HD__ coord_t begin() const { return segments.head >= 0 ? segments.head : segments.first; }
+  __CUDA_HD__ coord_t end() const { return segments.last; }
+};
+
+// Creates the outputs of the piece. The caller writes the head segment into
+// the returned buffer.
+template <typename VAL, int DIM>
+Buffer<int64_t, DIM> create_results(SegmentedRedArgs& args,
+                                    const Rect<DIM>& rect,
+                                    const PieceSegments& segments,
+                                    SegmentResults<VAL, DIM>& results)
+{
+  Point<DIM> extents = rect.hi - rect.lo + Point<DIM>::ONES();
+  extents[args.axis] = segments.last - segments.first;
+  results.owned      = args.result.create_output_buffer<VAL, DIM>(extents, true);
+  extents[args.axis] = 1;
+  results.head       = args.heads.create_output_buffer<VAL, DIM>(extents, true);
+  results.segments   = segments;
+  results.axis       = args.axis;
+  return args.head_segments.create_output_buffer<int64_t, DIM>(Point<DIM>::ONES(), true);
+}
+
+// A piece without a head segment contributes the identity to the heads
+template <typename VAL, int DIM>
+void fill_head(const SegmentResults<VAL, DIM>& out, size_t num_lines, VAL identity)
+{
+  if (out.segments.head >= 0) return;
+  VAL* head = out.head.ptr(Point<DIM>::ZEROES());
+  for (size_t idx = 0; idx < num_lines; ++idx) head[idx] = identity;
+}
+
+// Writes the results of `count` adjacent lines from the given offset for a
+// segment
+template <typename VAL, int DIM>
+void store_segment(const SegmentResults<VAL, DIM>& out,
+                   Point<DIM> offset,
+                   coord_t segment,
+                   const VAL* values,
+                   size_t count)
+{
+  for (size_t j = 0; j < count; ++j, ++offset[DIM - 1]) out(offset, segment) = values[j];
+}
+
+template <VariantKind KIND, UnaryRedCode OP_CODE, Type::Code CODE, int DIM>
+struct SegmentedRedImplBody;
+
+template <VariantKind KIND, UnaryRedCode OP_CODE>
+struct SegmentedRedImpl {
+  template <Type::Code CODE, int DIM, std::enable_if_t<UnaryRedOp<OP_CODE, CODE>::valid>* = nullptr>
+  void operator()(SegmentedRedArgs& args) const
+  {
+    using OP  = UnaryRedOp<OP_CODE, CODE>;
+    using RHS = legate_type_of<CODE>;
+
+    auto rect         = args.rhs.shape<DIM>();
+    auto offsets_rect = args.offsets.shape<1>();
+
+    ScanLines<DIM> lines;
+    size_t num_lines = lines.flatten(rect, args.axis);
+
+    if (num_lines == 0 || offsets_rect.empty()) {
+      args.result.bind_empty_data();
+      args.heads.bind_empty_data();
+      args.head_segments.bind_empty_data();
+      return;
+    }
+
+    RowAccessor<const RHS, DIM> rhs(args.rhs.read_accessor<RHS, DIM>(rect), rect);
+    auto offsets = args.offsets.read_accessor<int64_t, 1>(offsets_rect);
+
+    const coord_t num_segments = offsets_rect.hi[0] - offsets_rect.lo[0] + 1;
+    SegmentedRedImplBody<KIND, OP_CODE, CODE, DIM>()(
+      args, rhs, offsets, num_segments, lines, num_lines, rect);
+  }
+
+  template <Type::Code CODE,
+            int DIM,
+            std::enable_if_t<!UnaryRedOp<OP_CODE, CODE>::valid>* = nullptr>
+  void operator()(SegmentedRedArgs& args) const
+  {
+    assert(false);
+  }
+};
+
+template <VariantKind KIND>
+struct SegmentedRedDispatch {
+  template <UnaryRedCode OP_CODE>
+  void operator()(SegmentedRedArgs& args) const
+  {
+    if constexpr (is_segmented_red<OP_CODE>)
+      double_dispatch(args.rhs.dim(), args.rhs.code(), SegmentedRedImpl<KIND, OP_CODE>{}, args);
+    else
+      assert(false);
+  }
+};
+
+template <VariantKind KIND>
+static void segmented_red_template(TaskContext& context)
+{
+  auto& inputs  = context.inputs();
+  auto& scalars = context.scalars();
+  auto& outputs = context.outputs();
+  SegmentedRedArgs args{inputs[0],
+                        inputs[1],
+                        outputs[0],
+                        outputs[1],
+                        outputs[2],
+                        scalars[0].value<UnaryRedCode>(),
+                        scalars[1].value<int32_t>(),
+                        scalars[2].value<int64_t>()};
+  op_dispatch(args.op_code, SegmentedRedDispatch<KIND>{}, args);
+}
+
+}  // namespace cunumeric
@@ -40,9 +40,16 @@ struct UnaryOpImplBody<VariantKind::CPU, OP_CODE, CODE, DIM> {
       auto inptr  = in.ptr(rect);
       for (size_t idx = 0; idx < volume; ++idx) outptr[idx] = func(inptr[idx]);
     } else {
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto p = pitches.unflatten(idx, rect.lo);
-        out[p] = func(in[p]);
+      RowPitches<DIM> rows;
+      const size_t num_rows = rows.flatten(rect);
+      RowAccessor<RES, DIM> outrows(out, rect);
+      RowAccessor<const ARG, DIM> inrows(in, rect);
+      for (size_t row = 0; row < num_rows; ++row) {
+        const auto offset   = rows.row_offset(row);
+        const size_t length = rows.row_length(row);
+        auto outrow         = outrows[offset];
+        auto inrow          = inrows[offset];
+        for (size_t idx = 0; idx < length; ++idx) outrow[idx] = func(inrow[idx]);
       }
     }
   }
@@ -62,9 +69,16 @@ struct PointCopyImplBody<VariantKind::CPU, VAL, DIM> {
       auto inptr  = in.ptr(rect);
       for (size_t idx = 0; idx < volume; ++idx) outptr[idx] = inptr[idx];
     } else {
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto p = pitches.unflatten(idx, rect.lo);
-        out[p] = in[p];
+      RowPitches<DIM> rows;
+      const size_t num_rows = rows.flatten(rect);
+      RowAccessor<VAL, DIM> outrows(out, rect);
+      RowAccessor<const VAL, DIM> inrows(in, rect);
+      for (size_t row = 0; row < num_rows; ++row) {
+        const auto offset   = rows.row_offset(row);
+        const size_t length = rows.row_length(row);
+        auto outrow         = outrows[offset];
+        auto inrow          = inrows[offset];
+        for (size_t idx = 0; idx < length; ++idx) outrow[idx] = inrow[idx];
       }
     }
   }
@@ -92,9 +106,18 @@ struct MultiOutUnaryOpImplBody<VariantKind::CPU, OP_CODE, CODE, DIM> {
       auto rhs2ptr = rhs2.ptr(rect);
       for (size_t idx = 0; idx < volume; ++idx) lhsptr[idx] = func(rhs1ptr[idx], &rhs2ptr[idx]);
     } else {
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto p = pitches.unflatten(idx, rect.lo);
-        lhs[p] = func(rhs1[p], rhs2.ptr(p));
+      RowPitches<DIM> rows;
+      const size_t num_rows = rows.flatten(rect);
+      RowAccessor<LHS, DIM> lhsrows(lhs, rect);
+      RowAccessor<const RHS1, DIM> rhs1rows(rhs1, rect);
+      RowAccessor<RHS2, DIM> rhs2rows(rhs2, rect);
+      for (size_t row = 0; row < num_rows; ++row) {
+        const auto offset   = rows.row_offset(row);
+        const size_t length = rows.row_length(row);
+        auto lhsrow         = lhsrows[offset];
+        auto rhs1row        = rhs1rows[offset];
+        auto rhs2row        = rhs2rows[offset];
+        for (size_t idx = 0; idx < length; ++idx) lhsrow[idx] = func(rhs1row[idx], &rhs2row[idx]);
       }
     }
   }
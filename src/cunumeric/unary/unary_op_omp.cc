@@ -17,6 +17,8 @@
 #include "cunumeric/unary/unary_op.h"
 #include "cunumeric/unary/unary_op_template.inl"
 
+#include <omp.h>
+
 namespace cunumeric {
 
 using namespace legate;
@@ -41,10 +43,17 @@ struct UnaryOpImplBody<VariantKind::OMP, OP_CODE, CODE, DIM> {
 #pragma omp parallel for schedule(static)
       for (size_t idx = 0; idx < volume; ++idx) outptr[idx] = func(inptr[idx]);
     } else {
+      RowPitches<DIM> rows;
+      const size_t num_rows = rows.flatten(rect, omp_get_max_threads());
+      RowAccessor<RES, DIM> outrows(out, rect);
+      RowAccessor<const ARG, DIM> inrows(in, rect);
 #pragma omp parallel for schedule(static)
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto p = pitches.unflatten(idx, rect.lo);
-        out[p] = func(in[p]);
+      for (size_t row = 0; row < num_rows; ++row) {
+        const auto offset   = rows.row_offset(row);
+        const size_t length = rows.row_length(row);
+        auto outrow         = outrows[offset];
+        auto inrow          = inrows[offset];
+        for (size_t idx = 0; idx < length; ++idx) outrow[idx] = func(inrow[idx]);
       }
     }
   }
@@ -65,10 +74,17 @@ struct PointCopyImplBody<VariantKind::OMP, VAL, DIM> {
 #pragma omp parallel for schedule(static)
       for (size_t idx = 0; idx < volume; ++idx) outptr[idx] = inptr[idx];
     } else {
+      RowPitches<DIM> rows;
+      const size_t num_rows = rows.flatten(rect, omp_get_max_threads());
+      RowAccessor<VAL, DIM> outrows(out, rect);
+      RowAccessor<const VAL, DIM> inrows(in, rect);
 #pragma omp parallel for schedule(static)
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto p = pitches.unflatten(idx, rect.lo);
-        out[p] = in[p];
+      for (size_t row = 0; row < num_rows; ++row) {
+        const auto offset   = rows.row_offset(row);
+        const size_t length = rows.row_length(row);
+        auto outrow         = outrows[offset];
+        auto inrow          = inrows[offset];
+        for (size_t idx = 0; idx < length; ++idx) outrow[idx] = inrow[idx];
       }
     }
   }
@@ -97,10 +113,19 @@ struct MultiOutUnaryOpImplBody<VariantKind::OMP, OP_CODE, CODE, DIM> {
 #pragma omp parallel for schedule(static)
       for (size_t idx = 0; idx < volume; ++idx) lhsptr[idx] = func(rhs1ptr[idx], &rhs2ptr[idx]);
     } else {
+      RowPitches<DIM> rows;
+      const size_t num_rows = rows.flatten(rect, omp_get_max_threads());
+      RowAccessor<LHS, DIM> lhsrows(lhs, rect);
+      RowAccessor<const RHS1, DIM> rhs1rows(rhs1, rect);
+      RowAccessor<RHS2, DIM> rhs2rows(rhs2, rect);
 #pragma omp parallel for schedule(static)
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto p = pitches.unflatten(idx, rect.lo);
-        lhs[p] = func(rhs1[p], rhs2.ptr(p));
+      for (size_t row = 0; row < num_rows; ++row) {
+        const auto offset   = rows.row_offset(row);
+        const size_t length = rows.row_length(row);
+        auto lhsrow         = lhsrows[offset];
+        auto rhs1row        = rhs1rows[offset];
+        auto rhs2row        = rhs2rows[offset];
+        for (size_t idx = 0; idx < length; ++idx) lhsrow[idx] = func(rhs1row[idx], &rhs2row[idx]);
       }
     }
   }
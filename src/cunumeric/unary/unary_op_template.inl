@@ -19,6 +19,7 @@
 // Useful for IDEs
 #include "cunumeric/unary/unary_op.h"
 #include "cunumeric/pitches.h"
+#include "cunumeric/row_pitches.h"
 
 namespace cunumeric {
 
@@ -168,7 +169,10 @@ struct UnaryOpDispatch {
       auto& type = static_cast<const FixedArrayType&>(args.in.type());
       cunumeric::double_dispatch(dim, type.num_elements(), UnaryCopyImpl<KIND>{}, args);
     } else {
-      auto code = OP_CODE == UnaryOpCode::GETARG ? args.out.code() : args.in.code();
+      // Extractions from reduction states dispatch on the type of the value
+      auto code = OP_CODE == UnaryOpCode::GETARG || OP_CODE == UnaryOpCode::GETVAR
+                    ? args.out.code()
+                    : args.in.code();
       legate::double_dispatch(dim, code, UnaryOpImpl<KIND, OP_CODE>{}, args);
     }
   }
@@ -16,6 +16,7 @@
 
 #include "cunumeric/unary/unary_red.h"
 #include "cunumeric/unary/unary_red_template.inl"
+#include "cunumeric/pairwise.h"
 
 namespace cunumeric {
 
@@ -26,6 +27,7 @@ struct UnaryRedImplBody<VariantKind::CPU, OP_CODE, CODE, DIM, HAS_WHERE> {
   using OP    = UnaryRedOp<OP_CODE, CODE>;
   using LG_OP = typename OP::OP;
   using RHS   = legate_type_of<CODE>;
+  using VAL   = typename OP::VAL;
 
   void operator()(AccessorRD<LG_OP, true, DIM> lhs,
                   AccessorRO<RHS, DIM> rhs,
@@ -33,15 +35,112 @@ struct UnaryRedImplBody<VariantKind::CPU, OP_CODE, CODE, DIM, HAS_WHERE> {
                   const Rect<DIM>& rect,
                   const Pitches<DIM - 1>& pitches,
                   int collapsed_dim,
-                  size_t volume) const
+                  size_t volume,
+                  bool pairwise) const
   {
-    for (size_t idx = 0; idx < volume; ++idx) {
-      auto point = pitches.unflatten(idx, rect.lo);
-      bool mask  = true;
-      if constexpr (HAS_WHERE) mask = where[point];
-      if (mask) {
-        auto identity = LG_OP::identity;
-        lhs.reduce(point, OP::convert(point, collapsed_dim, identity, rhs[point]));
+    AxisPitches<DIM> axis;
+    const size_t num_rows = axis.flatten(rect, collapsed_dim);
+    const size_t length   = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
+    const coord_t extent  = rect.hi[collapsed_dim] - rect.lo[collapsed_dim] + 1;
+    const VAL identity    = LG_OP::identity;
+
+    RowAccessor<const RHS, DIM> rhsrows(rhs, rect);
+    RowAccessor<const bool, DIM> whererows;
+    if constexpr (HAS_WHERE) whererows = RowAccessor<const bool, DIM>(where, rect);
+
+    // Folds elements [start, stop) of the row at the given offset into the accumulators
+    auto fold_row = [&](auto&& acc, const Point<DIM>& offset, size_t start, size_t stop) {
+      auto rhsrow = rhsrows[offset];
+      auto point  = rect.lo + offset;
+      RowView<const bool> whererow;
+      if constexpr (HAS_WHERE) whererow = whererows[offset];
+      point[DIM - 1] += start;
+      for (size_t idx = start; idx < stop; ++idx, ++point[DIM - 1]) {
+        if constexpr (HAS_WHERE)
+          if (!whererow[idx]) continue;
+        OP::template fold<true>(acc(idx), OP::convert(point, collapsed_dim, identity, rhsrow[idx]));
+      }
+    };
+
+    if constexpr (is_pairwise_sum<OP_CODE, CODE>::value) {
+      if (pairwise) {
+        pairwise_reduction(lhs, rect, axis, num_rows, length, extent, collapsed_dim, fold_row);
+        return;
+      }
+    }
+
+    if (collapsed_dim == DIM - 1) {
+      // Each row reduces to a single value, which we accumulate in a register
+      for (size_t row = 0; row < num_rows; ++row) {
+        const auto offset = axis.row_offset(row, 0);
+        VAL result        = identity;
+        fold_row([&](size_t) -> VAL& { return result; }, offset, 0, length);
+        lhs.reduce(rect.lo + offset, result);
+      }
+    } else {
+      // Sweep the collapsed dimension for one row of outputs at a time, so the
+      // inner loop runs over contiguous inputs and accumulators
+      std::vector<VAL> results(length);
+      for (size_t row = 0; row < num_rows; ++row) {
+        std::fill(results.begin(), results.end(), identity);
+        for (coord_t k = 0; k < extent; ++k)
+          fold_row(
+            [&](size_t idx) -> VAL& { return results[idx]; }, axis.row_offset(row, k), 0, length);
+        auto point = rect.lo + axis.row_offset(row, 0);
+        for (size_t idx = 0; idx < length; ++idx, ++point[DIM - 1])
+          lhs.reduce(point, results[idx]);
+      }
+    }
+  }
+
+  // Same as above, except that the collapsed dimension is accumulated in
+  // blocks of PAIRWISE_BLOCK elements that are then merged pairwise
+  template <typename FoldRow>
+  void pairwise_reduction(AccessorRD<LG_OP, true, DIM>& lhs,
+                          const Rect<DIM>& rect,
+                          const AxisPitches<DIM>& axis,
+                          size_t num_rows,
+                          size_t length,
+                          coord_t extent,
+                          int collapsed_dim,
+                          FoldRow&& fold_row) const
+  {
+    const VAL identity = LG_OP::identity;
+    if (collapsed_dim == DIM - 1) {
+      PairwiseCascade<LG_OP, VAL> cascade;
+      for (size_t row = 0; row < num_rows; ++row) {
+        const auto offset = axis.row_offset(row, 0);
+        cascade.clear();
+        for (size_t start = 0; start < length; start += PAIRWISE_BLOCK) {
+          VAL block = identity;
+          fold_row([&](size_t) -> VAL& { return block; },
+                   offset,
+                   start,
+                   std::min(length, start + PAIRWISE_BLOCK));
+          cascade.push(&block);
+        }
+        VAL result = identity;
+        cascade.finish(&result);
+        lhs.reduce(rect.lo + offset, result);
+      }
+    } else {
+      PairwiseCascade<LG_OP, VAL> cascade(length);
+      std::vector<VAL> results(length);
+      for (size_t row = 0; row < num_rows; ++row) {
+        cascade.clear();
+        for (coord_t lo = 0; lo < extent; lo += PAIRWISE_BLOCK) {
+          const coord_t hi = std::min<coord_t>(extent, lo + PAIRWISE_BLOCK);
+          std::fill(results.begin(), results.end(), identity);
+          for (coord_t k = lo; k < hi; ++k)
+            fold_row(
+              [&](size_t idx) -> VAL& { return results[idx]; }, axis.row_offset(row, k), 0, length);
+          cascade.push(results.data());
+        }
+        std::fill(results.begin(), results.end(), identity);
+        cascade.finish(results.data());
+        auto point = rect.lo + axis.row_offset(row, 0);
+        for (size_t idx = 0; idx < length; ++idx, ++point[DIM - 1])
+          lhs.reduce(point, results[idx]);
       }
     }
   }
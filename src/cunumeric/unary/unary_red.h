@@ -27,6 +27,7 @@ struct UnaryRedArgs {
   const Array& where;
   int32_t collapsed_dim;
   UnaryRedCode op_code;
+  bool pairwise;
 };
 
 class UnaryRedTask : public CuNumericTask<UnaryRedTask> {
@@ -16,67 +16,49 @@
 
 #include "cunumeric/unary/unary_red.h"
 #include "cunumeric/unary/unary_red_template.inl"
+#include "cunumeric/pairwise.h"
+
+#include <omp.h>
 
 namespace cunumeric {
 
 using namespace legate;
 
-struct Split {
-  size_t outer{0};
-  size_t inner{0};
-};
-
-template <int DIM>
-class Splitter {
- public:
-  Split split(const Rect<DIM>& rect, int must_be_inner)
-  {
-    for (int dim = 0; dim < DIM; ++dim)
-      if (dim != must_be_inner) {
-        outer_dim_ = dim;
-        break;
-      }
-
-    size_t outer = 1;
-    size_t inner = 1;
-    size_t pitch = 1;
-    for (int dim = DIM - 1; dim >= 0; --dim) {
-      auto diff = rect.hi[dim] - rect.lo[dim] + 1;
-      if (dim == outer_dim_)
-        outer *= diff;
-      else {
-        inner *= diff;
-        pitches_[dim] = pitch;
-        pitch *= diff;
-      }
-    }
-    return Split{outer, inner};
-  }
-
-  inline Point<DIM> combine(size_t outer_idx, size_t inner_idx, const Point<DIM>& lo) const
-  {
-    Point<DIM> point = lo;
-    for (int dim = 0; dim < DIM; ++dim) {
-      if (dim == outer_dim_)
-        point[dim] += outer_idx;
-      else {
-        point[dim] += inner_idx / pitches_[dim];
-        inner_idx = inner_idx % pitches_[dim];
-      }
-    }
-    return point;
-  }
-
- private:
-  int32_t outer_dim_;
-  size_t pitches_[DIM];
-};
+// Private accumulators of all threads together may not exceed this size
+static constexpr size_t MAX_SLAB_BYTES = 64 << 20;
 
 template <UnaryRedCode OP_CODE, Type::Code CODE, int DIM, bool HAS_WHERE>
 struct UnaryRedImplBody<VariantKind::OMP, OP_CODE, CODE, DIM, HAS_WHERE> {
   using OP    = UnaryRedOp<OP_CODE, CODE>;
   using LG_OP = typename OP::OP;
   using RHS   = legate_type_of<CODE>;
+  using VAL   = typename OP::VAL;
+
+  struct Rows {
+    AxisPitches<DIM> axis;
+    RowAccessor<const RHS, DIM> rhs;
+    RowAccessor<const bool, DIM> where;
+    Point<DIM> lo;
+    int32_t collapsed_dim;
+
+    // Folds elements [start, stop) of a row into the accumulators
+    template <typename ACC>
+    inline void fold(ACC&& acc, size_t row, coord_t k, size_t start, size_t stop) const
+    {
+      const auto offset = axis.row_offset(row, k);
+      auto rhsrow       = rhs[offset];
+      RowView<const bool> whererow;
+      if constexpr (HAS_WHERE) whererow = where[offset];
+      auto point = lo + offset;
+      point[DIM - 1] += start;
+      const VAL identity = LG_OP::identity;
+      for (size_t idx = start; idx < stop; ++idx, ++point[DIM - 1]) {
+        if constexpr (HAS_WHERE)
+          if (!whererow[idx]) continue;
+        OP::template fold<true>(acc(idx), OP::convert(point, collapsed_dim, identity, rhsrow[idx]));
+      }
+    }
+  };
 
   void operator()(AccessorRD<LG_OP, true, DIM> lhs,
                   AccessorRO<RHS, DIM> rhs,
@@ -84,21 +66,172 @@ struct UnaryRedImplBody<VariantKind::OMP, OP_CODE, CODE, DIM, HAS_WHERE> {
                   const Rect<DIM>& rect,
                   const Pitches<DIM - 1>& pitches,
                   int collapsed_dim,
-                  size_t volume) const
+                  size_t volume,
+                  bool pairwise) const
+  {
+    Rows rows;
+    const size_t num_rows = rows.axis.flatten(rect, collapsed_dim);
+    rows.rhs              = RowAccessor<const RHS, DIM>(rhs, rect);
+    if constexpr (HAS_WHERE) rows.where = RowAccessor<const bool, DIM>(where, rect);
+    rows.lo            = rect.lo;
+    rows.collapsed_dim = collapsed_dim;
+
+    const size_t max_threads = omp_get_max_threads();
+    const size_t length      = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
+    const coord_t extent     = rect.hi[collapsed_dim] - rect.lo[collapsed_dim] + 1;
+
+    if constexpr (!is_pairwise_sum<OP_CODE, CODE>::value) pairwise = false;
+
+    // Pairwise sums need the whole collapsed dimension in one thread, so
+    // they never use the slab reduction
+    if (collapsed_dim == DIM - 1)
+      inner_reduction(lhs, rows, num_rows, length, max_threads, pairwise);
+    else if (!pairwise && num_rows < max_threads && extent >= static_cast<coord_t>(max_threads) &&
+             max_threads * num_rows * length * sizeof(VAL) <= MAX_SLAB_BYTES)
+      slab_reduction(lhs, rows, num_rows, length, extent, max_threads);
+    else
+      outer_reduction(lhs, rows, num_rows, length, extent, max_threads, pairwise);
+  }
+
+  // The collapsed dimension is the innermost one. Each thread accumulates a
+  // contiguous run of a row in a register. Rows are split into chunks only
+  // when there are fewer rows than threads, in which case the partial results
+  // are merged once at the end.
+  void inner_reduction(AccessorRD<LG_OP, true, DIM>& lhs,
+                       const Rows& rows,
+                       size_t num_rows,
+                       size_t length,
+                       size_t max_threads,
+                       bool pairwise) const
+  {
+    size_t chunks = 1;
+    if (num_rows < max_threads) chunks = std::min(length, (max_threads + num_rows - 1) / num_rows);
+    const size_t chunk_size = (length + chunks - 1) / chunks;
+
+    std::vector<VAL> partials(num_rows * chunks, LG_OP::identity);
+    if (pairwise) {
+      if constexpr (is_pairwise_sum<OP_CODE, CODE>::value) {
+#pragma omp parallel
+        {
+          PairwiseCascade<LG_OP, VAL> cascade;
+#pragma omp for schedule(static)
+          for (size_t idx = 0; idx < num_rows * chunks; ++idx) {
+            const size_t row   = idx / chunks;
+            const size_t start = (idx % chunks) * chunk_size;
+            const size_t stop  = std::min(start + chunk_size, length);
+            cascade.clear();
+            for (size_t lo = start; lo < stop; lo += PAIRWISE_BLOCK) {
+              VAL block = LG_OP::identity;
+              rows.fold([&](size_t) -> VAL& { return block; },
+                        row,
+                        0,
+                        lo,
+                        std::min(stop, lo + PAIRWISE_BLOCK));
+              cascade.push(&block);
+            }
+            cascade.finish(&partials[idx]);
+          }
+        }
+      }
+    } else {
+#pragma omp parallel for schedule(static)
+      for (size_t idx = 0; idx < num_rows * chunks; ++idx) {
+        const size_t row   = idx / chunks;
+        const size_t start = (idx % chunks) * chunk_size;
+        const size_t stop  = std::min(start + chunk_size, length);
+        VAL result         = LG_OP::identity;
+        rows.fold([&](size_t) -> VAL& { return result; }, row, 0, start, stop);
+        partials[idx] = result;
+      }
+    }
+
+#pragma omp parallel for schedule(static)
+    for (size_t row = 0; row < num_rows; ++row) {
+      VAL result = partials[row * chunks];
+      for (size_t chunk = 1; chunk < chunks; ++chunk)
+        OP::template fold<true>(result, partials[row * chunks + chunk]);
+      lhs.reduce(rows.lo + rows.axis.row_offset(row, 0), result);
+    }
+  }
+
+  // There are too few output rows to go around the threads, but the
+  // collapsed dimension is long. Each thread reduces a range of the collapsed
+  // dimension into a private copy of the output, and the copies are merged
+  // once at the end.
+  void slab_reduction(AccessorRD<LG_OP, true, DIM>& lhs,
+                      const Rows& rows,
+                      size_t num_rows,
+                      size_t length,
+                      coord_t extent,
+                      size_t max_threads) const
   {
-    Splitter<DIM> splitter;
-    auto split = splitter.split(rect, collapsed_dim);
+    const size_t slab_size = num_rows * length;
+    std::vector<VAL> slabs(max_threads * slab_size, LG_OP::identity);
+#pragma omp parallel
+    {
+      VAL* slab = slabs.data() + omp_get_thread_num() * slab_size;
+#pragma omp for schedule(static)
+      for (coord_t k = 0; k < extent; ++k)
+        for (size_t row = 0; row < num_rows; ++row) {
+          VAL* results = slab + row * length;
+          rows.fold([&](size_t idx) -> VAL& { return results[idx]; }, row, k, 0, length);
+        }
+    }
 
 #pragma omp parallel for schedule(static)
-    for (size_t o_idx = 0; o_idx < split.outer; ++o_idx) {
-      for (size_t i_idx = 0; i_idx < split.inner; ++i_idx) {
-        auto point = splitter.combine(o_idx, i_idx, rect.lo);
-        bool mask  = true;
-        if constexpr (HAS_WHERE) mask = where[point];
-        if (mask) {
-          auto identity = LG_OP::identity;
-          lhs.reduce(point, OP::convert(point, collapsed_dim, identity, rhs[point]));
+    for (size_t row = 0; row < num_rows; ++row) {
+      auto point = rows.lo + rows.axis.row_offset(row, 0);
+      for (size_t idx = 0; idx < length; ++idx, ++point[DIM - 1]) {
+        VAL result = slabs[row * length + idx];
+        for (size_t tid = 1; tid < max_threads; ++tid)
+          OP::template fold<true>(result, slabs[tid * slab_size + row * length + idx]);
+        lhs.reduce(point, result);
+      }
+    }
+  }
+
+  // Each thread owns a chunk of a row of outputs and sweeps the collapsed
+  // dimension for it, accumulating into a contiguous buffer
+  void outer_reduction(AccessorRD<LG_OP, true, DIM>& lhs,
+                       const Rows& rows,
+                       size_t num_rows,
+                       size_t length,
+                       coord_t extent,
+                       size_t max_threads,
+                       bool pairwise) const
+  {
+    size_t chunks = 1;
+    if (num_rows < max_threads) chunks = std::min(length, (max_threads + num_rows - 1) / num_rows);
+    const size_t chunk_size = (length + chunks - 1) / chunks;
+    // Without pairwise sums, the whole collapsed dimension is one block
+    const coord_t block_size = pairwise ? PAIRWISE_BLOCK : extent;
+
+#pragma omp parallel
+    {
+      std::vector<VAL> buffer(chunk_size);
+      PairwiseCascade<LG_OP, VAL> cascade(pairwise ? chunk_size : 0);
+#pragma omp for schedule(static)
+      for (size_t unit = 0; unit < num_rows * chunks; ++unit) {
+        const size_t row   = unit / chunks;
+        const size_t start = (unit % chunks) * chunk_size;
+        const size_t stop  = std::min(start + chunk_size, length);
+        cascade.clear();
+        for (coord_t lo = 0; lo < extent; lo += block_size) {
+          const coord_t hi = std::min(extent, lo + block_size);
+          std::fill(buffer.begin(), buffer.end(), VAL(LG_OP::identity));
+          for (coord_t k = lo; k < hi; ++k)
+            rows.fold([&](size_t idx) -> VAL& { return buffer[idx - start]; }, row, k, start, stop);
+          if (pairwise) cascade.push(buffer.data());
+        }
+        if (pairwise) {
+          std::fill(buffer.begin(), buffer.end(), VAL(LG_OP::identity));
+          cascade.finish(buffer.data());
         }
+
+        auto point = rows.lo + rows.axis.row_offset(row, 0);
+        point[DIM - 1] += start;
+        for (size_t idx = start; idx < stop; ++idx, ++point[DIM - 1])
+          lhs.reduce(point, buffer[idx - start]);
       }
     }
   }
@@ -22,6 +22,7 @@
 #include "cunumeric/arg.h"
 #include "cunumeric/arg.inl"
 #include "cunumeric/pitches.h"
+#include "cunumeric/row_pitches.h"
 
 namespace cunumeric {
 
@@ -53,7 +54,7 @@ struct UnaryRedImpl {
     AccessorRO<bool, DIM> where;
     if constexpr (HAS_WHERE) { where = args.where.read_accessor<bool, DIM>(rect); }
     UnaryRedImplBody<KIND, OP_CODE, CODE, DIM, HAS_WHERE>()(
-      lhs, rhs, where, rect, pitches, args.collapsed_dim, volume);
+      lhs, rhs, where, rect, pitches, args.collapsed_dim, volume, args.pairwise);
   }
 
   template <Type::Code CODE,
@@ -87,7 +88,8 @@ static void unary_red_template(TaskContext& context)
                     inputs[0],
                     has_where ? inputs[1] : dummy_where,
                     scalars[0].value<int32_t>(),
-                    scalars[1].value<UnaryRedCode>()};
+                    scalars[1].value<UnaryRedCode>(),
+                    scalars[3].value<bool>()};
   if (has_where) {
     op_dispatch(args.op_code, UnaryRedDispatch<KIND, true>{}, args);
   } else {
@@ -19,6 +19,7 @@
 #include "cunumeric/cunumeric.h"
 #include "cunumeric/arg.h"
 #include "cunumeric/arg.inl"
+#include "cunumeric/welford.h"
 #include "cunumeric/unary/isnan.h"
 
 namespace cunumeric {
@@ -41,7 +42,8 @@ enum class UnaryRedCode : int {
   PROD          = CUNUMERIC_RED_PROD,
   SUM           = CUNUMERIC_RED_SUM,
   SUM_SQUARES   = CUNUMERIC_RED_SUM_SQUARES,
-  VARIANCE      = CUNUMERIC_RED_VARIANCE
+  VARIANCE      = CUNUMERIC_RED_VARIANCE,
+  WELFORD       = CUNUMERIC_RED_WELFORD
 };
 
 template <UnaryRedCode OP_CODE>
@@ -55,6 +57,13 @@ struct is_arg_reduce<UnaryRedCode::NANARGMAX> : std::true_type {};
 template <>
 struct is_arg_reduce<UnaryRedCode::NANARGMIN> : std::true_type {};
 
+// Sums that are accumulated pairwise when requested, to limit the rounding error
+template <UnaryRedCode OP_CODE, legate::Type::Code CODE>
+struct is_pairwise_sum
+  : std::bool_constant<(OP_CODE == UnaryRedCode::SUM || OP_CODE == UnaryRedCode::NANSUM) &&
+                       (legate::is_floating_point<CODE>::value ||
+                        legate::is_complex<CODE>::value)> {};
+
 template <typename Functor, typename... Fnargs>
 constexpr decltype(auto) op_dispatch(UnaryRedCode op_code, Functor f, Fnargs&&... args)
 {
@@ -95,6 +104,8 @@ constexpr decltype(auto) op_dispatch(UnaryRedCode op_code, Functor f, Fnargs&&..
       return f.template operator()<UnaryRedCode::SUM_SQUARES>(std::forward<Fnargs>(args)...);
     case UnaryRedCode::VARIANCE:
       return f.template operator()<UnaryRedCode::VARIANCE>(std::forward<Fnargs>(args)...);
+    case UnaryRedCode::WELFORD:
+      return f.template operator()<UnaryRedCode::WELFORD>(std::forward<Fnargs>(args)...);
     default: break;
   }
   assert(false);
@@ -316,6 +327,33 @@ struct UnaryRedOp<UnaryRedCode::VARIANCE, TYPE_CODE> {
   __CUDA_HD__ static VAL convert(const RHS& rhs, const VAL) { return rhs * rhs; }
 };
 
+// Single-pass variance. Each value becomes a state with a count of one and
+// states are merged with Chan's formula, so the mean and the sum of squared
+// deviations come out of the same reduction.
+template <legate::Type::Code TYPE_CODE>
+struct UnaryRedOp<UnaryRedCode::WELFORD, TYPE_CODE> {
+  static constexpr bool valid =
+    TYPE_CODE == legate::Type::Code::FLOAT32 || TYPE_CODE == legate::Type::Code::FLOAT64;
+
+  using RHS = legate::legate_type_of<TYPE_CODE>;
+  using VAL = WelfordState<RHS>;
+  using OP  = WelfordReduction<RHS>;
+
+  template <bool EXCLUSIVE>
+  __CUDA_HD__ static void fold(VAL& a, VAL b)
+  {
+    OP::template fold<EXCLUSIVE>(a, b);
+  }
+
+  template <int32_t DIM>
+  __CUDA_HD__ static VAL convert(const legate::Point<DIM>&, int32_t, const VAL, const RHS& rhs)
+  {
+    return VAL(rhs);
+  }
+
+  __CUDA_HD__ static VAL convert(const RHS& rhs, const VAL) { return VAL(rhs); }
+};
+
 template <legate::Type::Code TYPE_CODE>
 struct UnaryRedOp<UnaryRedCode::ARGMAX, TYPE_CODE> {
   static constexpr bool valid = !legate::is_complex<TYPE_CODE>::value;
@@ -0,0 +1,94 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "legate.h"
+
+namespace cunumeric {
+
+// Running (count, mean, M2) state of Welford's algorithm, where M2 is the
+// sum of squared deviations from the mean. Partial states are merged with
+// the pairwise formula of Chan et al., so the variance of a set of values
+// can be computed in a single pass regardless of how they are partitioned.
+// The layout must match the struct type created by get_welford_type in
+// runtime.py.
+template <typename T>
+class WelfordState {
+ public:
+  // Calling this constructor manually is unsafe, as the members are left uninitialized.
+  // This constructor exists only to make nvcc happy when we use a shared memory of
+  // WelfordState<T>.
+  __CUDA_HD__
+  WelfordState() {}
+  __CUDA_HD__
+  WelfordState(T value);
+  __CUDA_HD__
+  WelfordState(int64_t count, T mean, T m2);
+  __CUDA_HD__
+  WelfordState(const WelfordState& other);
+
+ public:
+  template <bool EXCLUSIVE>
+  __CUDA_HD__ inline void apply(const WelfordState<T>& rhs);
+  // Merges the other state into this one
+  __CUDA_HD__ inline void merge(const WelfordState<T>& rhs);
+  // Returns M2 / max(count - ddof, 0)
+  __CUDA_HD__ inline T variance(int64_t ddof) const;
+
+ public:
+  __CUDA_HD__ WelfordState& operator=(const WelfordState& other)
+  {
+    count = other.count;
+    mean  = other.mean;
+    m2    = other.m2;
+    return *this;
+  }
+  __CUDA_HD__ bool operator==(const WelfordState& other) const
+  {
+    return count == other.count && mean == other.mean && m2 == other.m2;
+  }
+  __CUDA_HD__ bool operator!=(const WelfordState& other) const { return !(*this == other); }
+
+ public:
+  int64_t count;
+  T mean;
+  T m2;
+};
+
+template <typename T>
+class WelfordReduction {
+ public:
+  using LHS = WelfordState<T>;
+  using RHS = WelfordState<T>;
+
+  static const WelfordState<T> identity;
+
+  template <bool EXCLUSIVE>
+  __CUDA_HD__ inline static void apply(LHS& lhs, RHS rhs)
+  {
+    lhs.template apply<EXCLUSIVE>(rhs);
+  }
+  template <bool EXCLUSIVE>
+  __CUDA_HD__ inline static void fold(RHS& rhs1, RHS rhs2)
+  {
+    rhs1.template apply<EXCLUSIVE>(rhs2);
+  }
+};
+
+}  // namespace cunumeric
+
+#include "cunumeric/welford.inl"
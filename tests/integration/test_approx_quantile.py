@@ -0,0 +1,87 @@
+# Copyright 2023 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import numpy as np
+import pytest
+from utils.comparisons import allclose
+
+import cunumeric as num
+
+QS = (0.0, 0.01, 0.25, 0.5, 0.9, 0.95, 0.99, 1.0)
+
+
+def _rank_error(sorted_np, estimates, qs):
+    ranks = np.searchsorted(sorted_np, estimates) / sorted_np.size
+    return np.max(np.abs(ranks - np.asarray(qs)))
+
+
+@pytest.mark.parametrize("accuracy", (0.1, 0.01))
+@pytest.mark.parametrize("dtype", (np.float64, np.float32, np.int64))
+def test_rank_error(accuracy, dtype):
+    np.random.seed(0)
+    arr_np = (np.random.lognormal(size=200000) * 100).astype(dtype)
+    res = num.approx_quantile(num.array(arr_np), QS, accuracy=accuracy)
+    assert res.shape == (len(QS),)
+    assert res.dtype == np.float64
+    assert _rank_error(np.sort(arr_np), np.asarray(res), QS) <= accuracy
+    assert res[0] == arr_np.min()
+    assert res[-1] == arr_np.max()
+
+
+def test_small_exact():
+    arr_np = np.arange(20, dtype=np.float64).reshape(4, 5)[:, ::-1]
+    res = num.approx_quantile(num.array(arr_np), QS)
+    assert allclose(res, np.quantile(arr_np, QS))
+
+
+def test_scalar_q():
+    arr_np = np.arange(11)
+    res = num.approx_quantile(num.array(arr_np), 0.5)
+    assert res.shape == ()
+    assert res == 5
+
+
+def test_nan():
+    arr_np = np.arange(10, dtype=np.float64)
+    arr_np[3] = np.nan
+    res = num.approx_quantile(num.array(arr_np), QS)
+    assert allclose(res, np.nanquantile(arr_np, QS))
+
+    res = num.approx_quantile(num.full(5, np.nan), QS)
+    assert np.all(np.isnan(res))
+
+
+class TestApproxQuantileErrors:
+    def test_complex(self):
+        with pytest.raises(TypeError):
+            num.approx_quantile(num.ones(5, dtype=np.complex64), 0.5)
+
+    @pytest.mark.parametrize(
+        "q", (-0.1, 1.5, [0.5, 2.0], np.nan, [0.5, np.nan]), ids=str
+    )
+    def test_q_out_of_range(self, q):
+        with pytest.raises(ValueError):
+            num.approx_quantile(num.ones(5), q)
+
+    @pytest.mark.parametrize("accuracy", (0.0, 1.0, -0.5))
+    def test_bad_accuracy(self, accuracy):
+        with pytest.raises(ValueError):
+            num.approx_quantile(num.ones(5), 0.5, accuracy=accuracy)
+
+
+if __name__ == "__main__":
+    import sys
+
+    sys.exit(pytest.main(sys.argv))
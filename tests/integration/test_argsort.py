@@ -200,6 +200,47 @@ class TestArgSort(object):
             arr_num_copy.argsort(axis=axis, kind=sort_type)
             assert np.array_equal(arr_np_copy, arr_num_copy)
 
+    @pytest.mark.parametrize("dtype", (np.int16, np.int64, np.float32))
+    def test_long_segments_stable(self, dtype):
+        # Long segments with many ties, whose order a stable sort keeps
+        arr_np = np.random.randint(-50, 50, (2, 6000)).astype(dtype)
+        arr_num = num.array(arr_np)
+        res_np = np.argsort(arr_np, kind="stable")
+        res_num = num.argsort(arr_num, kind="stable")
+        assert np.array_equal(res_num, res_np)
+
+    @pytest.mark.parametrize("dtype", (np.float16, np.float32, np.float64))
+    @pytest.mark.parametrize("length", (10, 100, 3000, 6000))
+    def test_signed_zeros_nans_stable(self, dtype, length):
+        # -0.0 ties with +0.0, and NaNs of either sign tie after +inf
+        choices = np.array([0.0, -0.0, np.nan, -np.nan, np.inf, -1.0, 1.0])
+        arr_np = np.random.choice(choices, (3, length)).astype(dtype)
+        arr_num = num.array(arr_np)
+        res_np = np.argsort(arr_np, kind="stable")
+        res_num = num.argsort(arr_num, kind="stable")
+        assert np.array_equal(res_num, res_np)
+
+    # Segments of 10000 elements are long enough to be radix sorted, but
+    # short enough to be sorted one per thread if there are enough of them
+    @pytest.mark.parametrize(
+        "size",
+        (
+            (1000, 3),
+            (500, 64),
+            (50, 3000),
+            (20, 5000),
+            (64, 10000),
+            (2, 10000),
+        ),
+        ids=str,
+    )
+    def test_many_segments_stable(self, size):
+        arr_np = np.random.randint(-20, 20, size)
+        arr_num = num.array(arr_np)
+        res_np = np.argsort(arr_np, kind="stable")
+        res_num = num.argsort(arr_num, kind="stable")
+        assert np.array_equal(res_num, res_np)
+
     @pytest.mark.parametrize("size", SIZES)
     def test_basic_complex_axis(self, size):
         arr_np = (
@@ -67,6 +67,31 @@ def test_random(shape, ndim):
             assert num.array_equal(x + y, a + b)
 
 
+# Scalar, row and column broadcasts on either side of non-commutative ops
+BROADCASTS = (
+    ((N, N + 1), ()),
+    ((N, N + 1), (1,)),
+    ((N, N + 1), (N + 1,)),
+    ((N, N + 1), (N, 1)),
+    ((N, N + 1, N + 2), (N + 2,)),
+    ((N, N + 1, N + 2), (N, N + 1, 1)),
+    ((3, N * N), (3, 1)),
+)
+
+
+@pytest.mark.parametrize("shapes", BROADCASTS, ids=str)
+@pytest.mark.parametrize("op", ("subtract", "divide", "power"))
+def test_broadcast_layouts(shapes, op):
+    dense_shape, bcast_shape = shapes
+    a = np.random.random(dense_shape) + 1
+    b = np.random.random(bcast_shape) + 1
+    x = num.array(a)
+    y = num.array(b)
+
+    assert num.allclose(getattr(num, op)(x, y), getattr(np, op)(a, b))
+    assert num.allclose(getattr(num, op)(y, x), getattr(np, op)(b, a))
+
+
 if __name__ == "__main__":
     import sys
 
@@ -0,0 +1,108 @@
+# Copyright 2023 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import numpy as np
+import pytest
+from utils.comparisons import allclose
+
+import cunumeric as num
+
+DTYPES = (np.bool_, np.int8, np.uint16, np.int64, np.float32, np.complex128)
+
+
+@pytest.mark.parametrize("dtype", DTYPES, ids=lambda dt: np.dtype(dt).name)
+@pytest.mark.parametrize("n", (1, 2, 3))
+@pytest.mark.parametrize("axis", (0, 1, -1))
+def test_diff(dtype, n, axis):
+    np.random.seed(0)
+    in_np = (np.random.random((17, 9, 5)) * 100 - 50).astype(dtype)
+    out_np = np.diff(in_np, n=n, axis=axis)
+    out_num = num.diff(num.array(in_np), n=n, axis=axis)
+    assert out_np.dtype == out_num.dtype
+    assert allclose(out_np, out_num)
+
+
+@pytest.mark.parametrize("n", (0, 5, 7, 10))
+def test_order(n):
+    in_np = np.arange(7) ** 2
+    out_np = np.diff(in_np, n=n)
+    out_num = num.diff(num.array(in_np), n=n)
+    assert out_np.shape == out_num.shape
+    assert np.array_equal(out_np, out_num)
+
+
+@pytest.mark.parametrize("dtype", (np.bool_, np.int8, np.int64))
+@pytest.mark.parametrize("n", (8, 9, 20))
+def test_high_order(dtype, n):
+    np.random.seed(2)
+    in_np = np.random.randint(0, 5, size=(3, 50)).astype(dtype)
+    out_np = np.diff(in_np, n=n)
+    out_num = num.diff(num.array(in_np), n=n)
+    assert out_np.dtype == out_num.dtype
+    assert np.array_equal(out_np, out_num)
+
+
+def test_long_axis():
+    np.random.seed(1)
+    in_np = np.random.random(100001)
+    out_np = np.diff(in_np, n=2)
+    out_num = num.diff(num.array(in_np), n=2)
+    assert allclose(out_np, out_num)
+
+
+def test_view():
+    in_np = np.arange(60, dtype=np.float64).reshape(6, 10) ** 2
+    in_num = num.array(in_np)
+    out_np = np.diff(in_np[1:, ::2], axis=1)
+    out_num = num.diff(in_num[1:, ::2], axis=1)
+    assert np.array_equal(out_np, out_num)
+
+
+@pytest.mark.parametrize(
+    "prepend, append",
+    ((0, None), (None, [[1], [2], [3]]), (-1, 1)),
+    ids=str,
+)
+def test_prepend_append(prepend, append):
+    in_np = np.arange(12).reshape(3, 4)
+    out_np = np.diff(
+        in_np,
+        prepend=np._NoValue if prepend is None else prepend,
+        append=np._NoValue if append is None else append,
+    )
+    out_num = num.diff(num.array(in_np), prepend=prepend, append=append)
+    assert np.array_equal(out_np, out_num)
+
+
+class TestDiffErrors:
+    def test_negative_order(self):
+        expected_exc = ValueError
+        with pytest.raises(expected_exc):
+            np.diff(np.arange(4), n=-1)
+        with pytest.raises(expected_exc):
+            num.diff(num.arange(4), n=-1)
+
+    def test_scalar(self):
+        expected_exc = ValueError
+        with pytest.raises(expected_exc):
+            np.diff(np.array(1))
+        with pytest.raises(expected_exc):
+            num.diff(num.array(1))
+
+
+if __name__ == "__main__":
+    import sys
+
+    sys.exit(pytest.main(sys.argv))
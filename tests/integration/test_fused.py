@@ -0,0 +1,149 @@
+# Copyright 2023 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import numpy as np
+import pytest
+from utils.comparisons import allclose
+from utils.generators import mk_seq_array
+
+import cunumeric as num
+
+
+def polynomial(lib, x, y):
+    return 3.0 * x * x + 2.0 * x * y - y / 4.0 + 1.0
+
+
+def transcendental(lib, x, y):
+    return lib.sqrt(lib.exp(-x * x) + lib.abs(lib.sin(y))) ** 2
+
+
+def mixed(lib, x, y):
+    return lib.maximum(lib.tanh(x), lib.hypot(x, y)) - lib.log1p(x * x)
+
+
+EXPRESSIONS = (polynomial, transcendental, mixed)
+
+
+@pytest.mark.parametrize("expr", EXPRESSIONS)
+@pytest.mark.parametrize("dtype", (np.float32, np.float64))
+@pytest.mark.parametrize("shape", ((100,), (8, 13), (3, 4, 5)))
+def test_basic(expr, dtype, shape):
+    x_np = mk_seq_array(np, shape).astype(dtype) / np.prod(shape)
+    y_np = np.cos(x_np)
+    x_num = num.array(x_np)
+    y_num = num.array(y_np)
+
+    fused = num.fuse(lambda x, y: expr(num, x, y))
+    out_num = fused(x_num, y_num)
+    out_np = expr(np, x_np, y_np)
+
+    assert out_num.dtype == out_np.dtype
+    assert allclose(out_np, out_num)
+
+
+def test_broadcast():
+    x_np = np.random.rand(6, 1)
+    y_np = np.random.rand(5)
+    fused = num.fuse(lambda x, y: polynomial(num, x, y))
+    out_num = fused(num.array(x_np), num.array(y_np))
+    out_np = polynomial(np, x_np, y_np)
+
+    assert out_num.shape == out_np.shape
+    assert allclose(out_np, out_num)
+
+
+def test_captured_array():
+    x_np = np.random.rand(10)
+    y_np = np.random.rand(10)
+    y_num = num.array(y_np)
+
+    @num.fuse
+    def fused(x):
+        return x * y_num + 2
+
+    assert allclose(fused(num.array(x_np)), x_np * y_np + 2)
+
+
+def test_scalar_argument():
+    x_np = np.random.rand(10)
+
+    @num.fuse
+    def fused(x, alpha):
+        return alpha * x - x / alpha
+
+    assert allclose(fused(num.array(x_np), 3), 3 * x_np - x_np / 3)
+
+
+def test_reused_subexpression():
+    x_np = np.random.rand(10)
+
+    @num.fuse
+    def fused(x):
+        t = num.exp(x)
+        return t * t + t
+
+    t = np.exp(x_np)
+    assert allclose(fused(num.array(x_np)), t * t + t)
+
+
+@pytest.mark.parametrize(
+    "func",
+    (
+        # integer inputs are not fused
+        lambda x: x * 2 + 1,
+        # reductions end the trace
+        lambda x: num.sum(x) + x,
+        # comparisons produce booleans
+        lambda x: (x > 5) * x,
+        # data-dependent control flow
+        lambda x: x + 1 if x[0] > 0 else x - 1,
+    ),
+)
+def test_fallback_int(func):
+    x_np = np.arange(10)
+    out_num = num.fuse(func)(num.array(x_np))
+    out_np = func(num.array(x_np))
+
+    assert np.array_equal(out_np, out_num)
+
+
+def test_fallback_out():
+    x_np = np.random.rand(10)
+    out = num.zeros(10)
+
+    @num.fuse
+    def fused(x):
+        return num.add(num.sqrt(x), 1.0, out=out)
+
+    fused(num.array(x_np))
+    assert allclose(out, np.sqrt(x_np) + 1.0)
+
+
+def test_fallback_too_many_instructions():
+    x_np = np.random.rand(10)
+
+    @num.fuse
+    def fused(x):
+        for _ in range(40):
+            x = x + 1.0
+        return x
+
+    assert allclose(fused(num.array(x_np)), x_np + 40.0)
+
+
+if __name__ == "__main__":
+    import sys
+
+    sys.exit(pytest.main(sys.argv))
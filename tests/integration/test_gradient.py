@@ -0,0 +1,115 @@
+# Copyright 2023 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import numpy as np
+import pytest
+from utils.comparisons import allclose
+
+import cunumeric as num
+
+DTYPES = (np.int16, np.uint32, np.float32, np.float64, np.complex64)
+
+
+@pytest.mark.parametrize("dtype", DTYPES, ids=lambda dt: np.dtype(dt).name)
+@pytest.mark.parametrize("edge_order", (1, 2))
+def test_all_axes(dtype, edge_order):
+    np.random.seed(0)
+    in_np = (np.random.random((11, 8, 6)) * 100).astype(dtype)
+    out_np = np.gradient(in_np, edge_order=edge_order)
+    out_num = num.gradient(num.array(in_np), edge_order=edge_order)
+    assert len(out_np) == len(out_num)
+    for grad_np, grad_num in zip(out_np, out_num):
+        assert grad_np.dtype == grad_num.dtype
+        assert allclose(grad_np, grad_num)
+
+
+@pytest.mark.parametrize("axis", (0, 1, -1, (0, 1)), ids=str)
+@pytest.mark.parametrize("edge_order", (1, 2))
+def test_spacing(axis, edge_order):
+    np.random.seed(1)
+    in_np = np.random.random((9, 12))
+    coords = np.cumsum(np.random.random(12) + 0.1)
+    if isinstance(axis, tuple):
+        spacings = (0.5, coords)
+    elif axis == 0:
+        spacings = (0.5,)
+    else:
+        spacings = (coords,)
+    out_np = np.gradient(in_np, *spacings, axis=axis, edge_order=edge_order)
+    out_num = num.gradient(
+        num.array(in_np), *spacings, axis=axis, edge_order=edge_order
+    )
+    if isinstance(axis, tuple):
+        for grad_np, grad_num in zip(out_np, out_num):
+            assert allclose(grad_np, grad_num)
+    else:
+        assert allclose(out_np, out_num)
+
+
+def test_even_coordinates():
+    in_np = np.arange(20, dtype=np.float64) ** 3
+    coords = np.arange(20) * 3
+    out_np = np.gradient(in_np, coords)
+    out_num = num.gradient(num.array(in_np), coords)
+    assert allclose(out_np, out_num)
+
+
+def test_long_axis():
+    np.random.seed(2)
+    in_np = np.random.random(100001)
+    out_np = np.gradient(in_np, 0.25, edge_order=2)
+    out_num = num.gradient(num.array(in_np), 0.25, edge_order=2)
+    assert allclose(out_np, out_num)
+
+
+class TestGradientErrors:
+    def test_too_small(self):
+        expected_exc = ValueError
+        with pytest.raises(expected_exc):
+            np.gradient(np.arange(2.0), edge_order=2)
+        with pytest.raises(expected_exc):
+            num.gradient(num.arange(2.0), edge_order=2)
+
+    def test_edge_order(self):
+        expected_exc = ValueError
+        with pytest.raises(expected_exc):
+            np.gradient(np.arange(5.0), edge_order=3)
+        with pytest.raises(expected_exc):
+            num.gradient(num.arange(5.0), edge_order=3)
+
+    @pytest.mark.parametrize("edge_order", (0, -1, 1.5))
+    def test_edge_order_below_one(self, edge_order):
+        with pytest.raises(ValueError):
+            num.gradient(num.arange(5.0), edge_order=edge_order)
+
+    def test_bool(self):
+        expected_exc = TypeError
+        with pytest.raises(expected_exc):
+            np.gradient(np.ones(4, dtype=bool))
+        with pytest.raises(expected_exc):
+            num.gradient(num.ones(4, dtype=bool))
+
+    def test_coordinates_length(self):
+        expected_exc = ValueError
+        with pytest.raises(expected_exc):
+            np.gradient(np.arange(5.0), np.arange(4.0))
+        with pytest.raises(expected_exc):
+            num.gradient(num.arange(5.0), np.arange(4.0))
+
+
+if __name__ == "__main__":
+    import sys
+
+    sys.exit(pytest.main(sys.argv))
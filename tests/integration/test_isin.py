@@ -0,0 +1,101 @@
+# Copyright 2023 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import numpy as np
+import pytest
+from legate.core import LEGATE_MAX_DIM
+
+import cunumeric as num
+
+
+@pytest.mark.parametrize("ndim", range(LEGATE_MAX_DIM + 1))
+@pytest.mark.parametrize("invert", (False, True))
+def test_ndim(ndim, invert):
+    element = np.random.randint(0, 20, size=(4,) * ndim)
+    test = np.random.randint(0, 20, size=10)
+    res_np = np.isin(element, test, invert=invert)
+    res_num = num.isin(num.array(element), num.array(test), invert=invert)
+    assert np.array_equal(res_np, res_num)
+
+
+@pytest.mark.parametrize(
+    "dtype", (np.bool_, np.int8, np.uint32, np.int64, np.float64, np.complex64)
+)
+@pytest.mark.parametrize("test_size", (1, 100, 5000))
+def test_dtypes(dtype, test_size):
+    # Small and large test sets take different paths on CPUs
+    element = np.random.randint(-50, 50, size=1000).astype(dtype)
+    test = np.random.randint(-50, 50, size=test_size).astype(dtype)
+    res_np = np.isin(element, test)
+    res_num = num.isin(num.array(element), num.array(test))
+    assert np.array_equal(res_np, res_num)
+
+
+def test_mixed_dtypes():
+    element = np.arange(-5, 5) * 0.5
+    test = np.arange(-3, 3)
+    res_np = np.isin(element, test)
+    res_num = num.isin(num.array(element), num.array(test))
+    assert np.array_equal(res_np, res_num)
+
+
+@pytest.mark.parametrize("assume_unique", (False, True))
+def test_nan(assume_unique):
+    # NaNs sort after every other test value and never match, while -0.0
+    # matches 0.0
+    element = np.array([1.0, np.nan, 2.0, np.nan, -0.0, 0.0, np.inf, 3.0])
+    test = np.array([np.nan, 2.0, np.nan, 0.0, np.inf, -1.0, np.nan])
+    if assume_unique:
+        test = np.array([np.nan, 2.0, 0.0, np.inf])
+    res_np = np.isin(element, test, assume_unique=assume_unique)
+    res_num = num.isin(
+        num.array(element), num.array(test), assume_unique=assume_unique
+    )
+    assert np.array_equal(res_np, res_num)
+
+
+@pytest.mark.parametrize("invert", (False, True))
+def test_assume_unique(invert):
+    element = np.random.permutation(100)
+    test = np.random.permutation(150)[:30]
+    res_np = np.isin(element, test, assume_unique=True, invert=invert)
+    res_num = num.isin(
+        num.array(element), num.array(test), assume_unique=True, invert=invert
+    )
+    assert np.array_equal(res_np, res_num)
+
+
+@pytest.mark.parametrize("invert", (False, True))
+def test_empty(invert):
+    element = np.arange(10)
+    for a, b in ((element, []), ([], element), ([], [])):
+        res_np = np.isin(a, b, invert=invert)
+        res_num = num.isin(a, b, invert=invert)
+        assert np.array_equal(res_np, res_num)
+
+
+@pytest.mark.parametrize("invert", (False, True))
+def test_in1d(invert):
+    element = np.random.randint(0, 20, size=(3, 4, 5))
+    test = np.random.randint(0, 20, size=(2, 6))
+    res_np = np.in1d(element, test, invert=invert)
+    res_num = num.in1d(num.array(element), num.array(test), invert=invert)
+    assert np.array_equal(res_np, res_num)
+
+
+if __name__ == "__main__":
+    import sys
+
+    sys.exit(pytest.main(sys.argv))
@@ -0,0 +1,120 @@
+# Copyright 2023 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import numpy as np
+import pytest
+
+import cunumeric as num
+
+# cunumeric.lexsort(keys: Any, axis: int = -1) → ndarray
+
+SHAPES = [
+    (0,),
+    (1,),
+    (10,),
+    (5, 6),
+    (4, 0),
+    (3, 4, 5),
+]
+
+
+def _keys(shape):
+    # Few distinct values per key, so that ties have to be broken by the
+    # keys that come before
+    return (
+        np.random.randint(0, 3, shape).astype(np.float32),
+        np.random.randint(-2, 2, shape),
+        np.random.randint(0, 2, shape).astype(bool),
+    )
+
+
+@pytest.mark.parametrize("shape", SHAPES, ids=str)
+def test_keys(shape):
+    keys = _keys(shape)
+    res_np = np.lexsort(keys)
+    res_num = num.lexsort(tuple(num.array(key) for key in keys))
+    assert np.array_equal(res_np, res_num)
+
+
+@pytest.mark.parametrize("shape", SHAPES[2:], ids=str)
+def test_axis(shape):
+    keys = _keys(shape)
+    keys_num = tuple(num.array(key) for key in keys)
+    for axis in range(-len(shape), len(shape)):
+        res_np = np.lexsort(keys, axis=axis)
+        res_num = num.lexsort(keys_num, axis=axis)
+        assert np.array_equal(res_np, res_num)
+
+
+def test_2d_keys():
+    # Each row of a 2-D array is a key
+    keys = np.random.randint(0, 4, (3, 100))
+    res_np = np.lexsort(keys)
+    res_num = num.lexsort(num.array(keys))
+    assert np.array_equal(res_np, res_num)
+
+
+def test_single_key_is_stable_argsort():
+    key = np.random.randint(0, 5, 1000)
+    res_num = num.lexsort((num.array(key),))
+    assert np.array_equal(np.argsort(key, kind="stable"), res_num)
+
+
+def test_long_keys():
+    n = 1 << 15
+    keys = (np.random.rand(n), np.random.randint(0, 100, n))
+    res_np = np.lexsort(keys)
+    res_num = num.lexsort(tuple(num.array(key) for key in keys))
+    assert np.array_equal(res_np, res_num)
+
+
+@pytest.mark.parametrize("high", (1000, 1 << 40), ids=str)
+def test_long_integer_keys(high):
+    # Narrow integer keys are packed into one key when sorted across
+    # processors, wide ones are not
+    n = 1 << 15
+    keys = (
+        np.random.randint(-high, high, n),
+        np.random.randint(0, 2, n).astype(bool),
+        np.random.randint(0, 200, n).astype(np.uint8),
+        np.random.randint(-high, high, n),
+    )
+    res_np = np.lexsort(keys)
+    res_num = num.lexsort(tuple(num.array(key) for key in keys))
+    assert np.array_equal(res_np, res_num)
+
+
+class TestLexsortErrors:
+    def test_no_keys(self):
+        msg = "need sequence of keys"
+        with pytest.raises(TypeError, match=msg):
+            num.lexsort(())
+
+    def test_shape_mismatch(self):
+        msg = "all keys need to be the same shape"
+        with pytest.raises(ValueError, match=msg):
+            num.lexsort((num.arange(3), num.arange(4)))
+
+    @pytest.mark.parametrize("axis", (-2, 1))
+    def test_axis_out_of_bound(self, axis):
+        with pytest.raises(np.AxisError):
+            num.lexsort((num.arange(3),), axis=axis)
+
+
+if __name__ == "__main__":
+    import sys
+
+    np.random.seed(12345)
+    sys.exit(pytest.main(sys.argv))
@@ -0,0 +1,80 @@
+# Copyright 2023 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import numpy as np
+import pytest
+from utils.comparisons import allclose
+
+import cunumeric as num
+
+
+@pytest.mark.parametrize("shape", ((7,), (8,), (3, 5), (4, 6, 2)))
+@pytest.mark.parametrize("axis", (None, 0, -1, (0, -1)))
+@pytest.mark.parametrize("keepdims", (False, True))
+def test_basic(shape, axis, keepdims):
+    np.random.seed(0)
+    arr_np = np.random.randint(-20, 20, size=shape)
+    arr_num = num.array(arr_np)
+    res_np = np.median(arr_np, axis=axis, keepdims=keepdims)
+    res_num = num.median(arr_num, axis=axis, keepdims=keepdims)
+    assert res_np.shape == res_num.shape
+    assert allclose(res_np, res_num)
+
+
+@pytest.mark.parametrize("axis", (None, 1))
+def test_overwrite_input(axis):
+    np.random.seed(1)
+    arr_np = np.random.random((5, 9))
+    arr_num = num.array(arr_np)
+    res_np = np.median(arr_np, axis=axis)
+    res_num = num.median(arr_num, axis=axis, overwrite_input=True)
+    assert allclose(res_np, res_num)
+
+
+def test_nan():
+    arr_np = np.arange(24, dtype=np.float64).reshape(4, 6)
+    arr_np[1, 2] = np.nan
+    arr_np[3, 0] = np.nan
+    arr_num = num.array(arr_np)
+    assert allclose(
+        np.median(arr_np, axis=1), num.median(arr_num, axis=1), equal_nan=True
+    )
+    assert np.isnan(num.median(arr_num))
+
+
+def test_out():
+    arr_np = np.arange(30, dtype=np.float64).reshape(5, 6)
+    arr_num = num.array(arr_np)
+    out_np = np.empty(6)
+    out_num = num.empty(6)
+    np.median(arr_np, axis=0, out=out_np)
+    res_num = num.median(arr_num, axis=0, out=out_num)
+    assert res_num is out_num
+    assert allclose(out_np, out_num)
+
+
+def test_many_ranks():
+    np.random.seed(2)
+    arr_np = np.random.random(100001)
+    arr_num = num.array(arr_np)
+    assert allclose(np.median(arr_np), num.median(arr_num))
+    q = [0.1, 0.25, 0.5, 0.9]
+    assert allclose(np.quantile(arr_np, q), num.quantile(arr_num, q))
+
+
+if __name__ == "__main__":
+    import sys
+
+    sys.exit(pytest.main(sys.argv))
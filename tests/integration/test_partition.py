@@ -163,6 +163,67 @@ def test_dtypes(shape, dtype):
     check_api(generate_random(shape, dtype))
 
 
+def check_kth(a_np, out, kth, axis=-1):
+    # The kth elements are those of the sorted array, with no larger
+    # elements before them and no smaller ones after them
+    expected = np.sort(a_np, axis=axis)
+    out = np.moveaxis(np.asarray(out), axis, -1)
+    expected = np.moveaxis(expected, axis, -1)
+    assert np.array_equal(np.sort(out, axis=-1), expected, equal_nan=True)
+    for k in np.ravel(kth):
+        pivot = out[..., k : k + 1]
+        assert np.array_equal(out[..., k], expected[..., k], equal_nan=True)
+        assert not np.any(out[..., :k] > pivot)
+        assert not np.any(out[..., k + 1 :] < pivot)
+
+
+@pytest.mark.parametrize(
+    "kth", (0, -1, (1, 5, 9), (9, 1, -2), (3, 3)), ids=str
+)
+@pytest.mark.parametrize("axis", (0, -1, None), ids=str)
+def test_multiple_kth(kth, axis):
+    # Few distinct values, so that there are many ties with the kth elements
+    a_np = np.random.randint(0, 5, size=(12, 40))
+    a_num = num.array(a_np)
+
+    flat_np = a_np.ravel() if axis is None else a_np
+    check_kth(flat_np, num.partition(a_num, kth, axis=axis), kth, axis or 0)
+
+    indices = np.asarray(num.argpartition(a_num, kth, axis=axis))
+    gathered = np.take_along_axis(flat_np, indices, axis=axis or 0)
+    check_kth(flat_np, gathered, kth, axis or 0)
+
+
+@pytest.mark.parametrize("dtype", (np.float32, np.float64, np.int16, bool))
+def test_1d_select(dtype):
+    a_np = (np.random.random(1000) * 100 - 50).astype(dtype)
+    if np.issubdtype(dtype, np.floating):
+        a_np[::97] = np.nan
+        a_np[1::89] = -0.0
+    a_num = num.array(a_np)
+    kth = (0, 17, 500, 990, 999)
+
+    check_kth(a_np, num.partition(a_num, kth), kth)
+
+    indices = np.asarray(num.argpartition(a_num, kth))
+    assert np.array_equal(np.sort(indices), np.arange(a_np.size))
+    check_kth(a_np, a_np[indices], kth)
+
+
+@pytest.mark.parametrize("axis", (0, -1), ids=str)
+def test_nan_rows(axis):
+    a_np = np.random.random((30, 50))
+    a_np[np.random.random(a_np.shape) < 0.2] = np.nan
+    a_num = num.array(a_np)
+    kth = (0, 7, 28)
+
+    check_kth(a_np, num.partition(a_num, kth, axis=axis), kth, axis)
+
+    indices = np.asarray(num.argpartition(a_num, kth, axis=axis))
+    gathered = np.take_along_axis(a_np, indices, axis=axis)
+    check_kth(a_np, gathered, kth, axis)
+
+
 class TestPartitionErrors:
     def setup_method(self):
         shape = (3, 4, 5)
@@ -179,12 +240,8 @@ class TestPartitionErrors:
         with pytest.raises(expected_exc):
             num.partition(self.a_num, kth=kth, axis=axis)
 
-    @pytest.mark.xfail
     @pytest.mark.parametrize("kth", (-4, 3, (-4, 0), (0, 3), (3, 3)))
     def test_kth_out_of_bound(self, kth):
-        # For all cases,
-        # In numpy, it raises ValueError
-        # In cunumeric, it pass
         expected_exc = ValueError
         axis = 0
         with pytest.raises(expected_exc):
@@ -209,12 +266,8 @@ class TestArgPartitionErrors:
         with pytest.raises(expected_exc):
             num.argpartition(self.a_num, kth=kth, axis=axis)
 
-    @pytest.mark.xfail
     @pytest.mark.parametrize("kth", (-4, 3, (-4, 0), (0, 3), (3, 3)))
     def test_kth_out_of_bound(self, kth):
-        # For all cases,
-        # In numpy, it raises ValueError
-        # In cunumeric, it pass
         expected_exc = ValueError
         axis = 0
         with pytest.raises(expected_exc):
@@ -0,0 +1,128 @@
+# Copyright 2023 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import numpy as np
+import pytest
+from utils.comparisons import allclose
+
+import cunumeric as num
+
+UFUNCS = ("add", "multiply", "maximum", "minimum")
+
+INDICES = (
+    [0, 4, 9, 30],
+    [0, 0, 5, 5, 39],
+    [10, 3, 20, 7],
+    [39],
+    [2],
+)
+
+
+@pytest.mark.parametrize("name", UFUNCS)
+@pytest.mark.parametrize("indices", INDICES, ids=str)
+@pytest.mark.parametrize("dtype", (np.int32, np.float64))
+def test_1d(name, indices, dtype):
+    np.random.seed(0)
+    in_np = (np.random.random(40) * 4 + 1).astype(dtype)
+    out_np = getattr(np, name).reduceat(in_np, indices)
+    out_num = getattr(num, name).reduceat(num.array(in_np), indices)
+    assert out_np.dtype == out_num.dtype
+    assert allclose(out_np, out_num)
+
+
+@pytest.mark.parametrize("name", UFUNCS)
+@pytest.mark.parametrize("axis", (0, 1, -1))
+def test_axis(name, axis):
+    np.random.seed(1)
+    in_np = np.random.random((40, 12, 7)) + 0.5
+    indices = [0, 3, 3, 11, 2, 6]
+    out_np = getattr(np, name).reduceat(in_np, indices, axis=axis)
+    out_num = getattr(num, name).reduceat(
+        num.array(in_np), indices, axis=axis
+    )
+    assert allclose(out_np, out_num)
+
+
+def test_long_segments():
+    np.random.seed(2)
+    in_np = np.random.randint(0, 10, size=(3, 100001))
+    indices = np.array([0, 7, 50000, 50001, 99999])
+    out_np = np.add.reduceat(in_np, indices, axis=1)
+    out_num = num.add.reduceat(num.array(in_np), num.array(indices), axis=1)
+    assert np.array_equal(out_np, out_num)
+
+
+def test_unsorted_long_segments():
+    np.random.seed(3)
+    in_np = np.random.randint(0, 10, size=(100001, 3))
+    indices = np.array([99999, 7, 50001, 50000, 0])
+    out_np = np.add.reduceat(in_np, indices)
+    out_num = num.add.reduceat(num.array(in_np), num.array(indices))
+    assert np.array_equal(out_np, out_num)
+
+
+@pytest.mark.parametrize("name", ("add", "multiply", "maximum"))
+@pytest.mark.parametrize("dtype", (np.bool_, np.int8, np.uint16))
+def test_small_dtypes(name, dtype):
+    in_np = (np.arange(20) % 3 + 1).astype(dtype)
+    indices = [0, 10, 15]
+    out_np = getattr(np, name).reduceat(in_np, indices)
+    out_num = getattr(num, name).reduceat(num.array(in_np), indices)
+    assert out_np.dtype == out_num.dtype
+    assert np.array_equal(out_np, out_num)
+
+
+def test_dtype_out():
+    in_np = np.arange(20, dtype=np.int8)
+    indices = [0, 10, 15]
+    out_np = np.add.reduceat(in_np, indices, dtype=np.int64)
+    out_num = num.add.reduceat(num.array(in_np), indices, dtype=np.int64)
+    assert out_np.dtype == out_num.dtype
+    assert np.array_equal(out_np, out_num)
+
+    out_np = np.zeros(3)
+    out_num = num.zeros(3)
+    np.maximum.reduceat(in_np, indices, out=out_np)
+    res_num = num.maximum.reduceat(num.array(in_np), indices, out=out_num)
+    assert res_num is out_num
+    assert np.array_equal(out_np, out_num)
+
+
+class TestReduceatErrors:
+    def test_no_reduction(self):
+        with pytest.raises(NotImplementedError):
+            num.subtract.reduceat(num.arange(10), [0, 5])
+
+    @pytest.mark.parametrize("indices", ([0, 10], [-1, 3]), ids=str)
+    def test_index_out_of_bound(self, indices):
+        expected_exc = IndexError
+        with pytest.raises(expected_exc):
+            np.add.reduceat(np.arange(10), indices)
+        with pytest.raises(expected_exc):
+            num.add.reduceat(num.arange(10), indices)
+
+    def test_scalar(self):
+        with pytest.raises(TypeError):
+            num.add.reduceat(num.array(1), [0])
+
+    def test_indices_ndim(self):
+        with pytest.raises(ValueError):
+            num.add.reduceat(num.arange(10), [[0, 5]])
+
+
+if __name__ == "__main__":
+    import sys
+
+    sys.exit(pytest.main(sys.argv))
@@ -17,6 +17,7 @@ import pytest
 from utils.comparisons import allclose
 
 import cunumeric as num
+from cunumeric.settings import settings
 
 # numpy.sum(a, axis=None, dtype=None, out=None, keepdims=<no value>,
 # initial=<no value>, where=<no value>)
@@ -314,6 +315,100 @@ def test_indexed():
     assert allclose(num.sum(x), np.sum(x_np))
 
 
+# Shapes with few/many rows and short/long collapsed dimensions
+AXIS_SHAPES = [(2, 1000), (1000, 2), (3, 50, 40), (400, 3, 7), (7, 3, 400)]
+
+
+@pytest.mark.parametrize("shape", AXIS_SHAPES, ids=str)
+@pytest.mark.parametrize("op", ("sum", "max", "argmin"))
+def test_axis_strategies(shape, op):
+    x_np = np.random.random(shape)
+    x = num.array(x_np)
+    for axis in range(len(shape)):
+        out_np = getattr(np, op)(x_np, axis=axis)
+        out_num = getattr(num, op)(x, axis=axis)
+        assert allclose(out_np, out_num)
+        # Transposed inputs are not dense
+        out_np = getattr(np, op)(x_np.T, axis=axis)
+        out_num = getattr(num, op)(x.T, axis=axis)
+        assert allclose(out_np, out_num)
+
+
+@pytest.mark.parametrize("shape", AXIS_SHAPES, ids=str)
+def test_axis_where(shape):
+    x_np = np.random.random(shape)
+    where_np = x_np > 0.5
+    x = num.array(x_np)
+    where = num.array(where_np)
+    for axis in range(len(shape)):
+        out_np = np.sum(x_np, axis=axis, where=where_np)
+        out_num = num.sum(x, axis=axis, where=where)
+        assert allclose(out_np, out_num)
+
+
+# Sizes around multiples of the number of accumulators used for dense inputs
+@pytest.mark.parametrize("size", (1, 7, 8, 9, 63, 1001))
+@pytest.mark.parametrize("op", ("sum", "prod", "max", "argmax", "all"))
+def test_dense_scalar(size, op):
+    x_np = np.random.uniform(0.5, 1.5, size)
+    x = num.array(x_np)
+    assert allclose(getattr(np, op)(x_np), getattr(num, op)(x))
+    # Ties must still resolve to the first occurrence
+    if op == "argmax":
+        x_np[:] = 1.0
+        assert num.argmax(num.array(x_np)) == 0
+
+
+@pytest.mark.parametrize("size", (5, 16, 1001))
+def test_dense_scalar_float32(size):
+    x_np = np.random.random(size).astype(np.float32)
+    x = num.array(x_np)
+    assert allclose(num.sum(x), np.sum(x_np.astype(np.float64)))
+    assert allclose(num.dot(x, x), np.dot(x_np.astype(np.float64), x_np))
+    assert num.array_equal(x, num.array(x_np))
+    y_np = x_np.copy()
+    y_np[-1] += 1
+    assert not num.array_equal(x, num.array(y_np))
+
+
+@pytest.fixture
+def pairwise_sum():
+    settings.pairwise_sum = True
+    yield
+    settings.pairwise_sum.unset_value()
+
+
+@pytest.mark.parametrize("axis", (None, 0, 1))
+def test_pairwise_sum(pairwise_sum, axis):
+    x_np = np.random.uniform(0.0, 0.2, (1000, 600)).astype(np.float32)
+    x_np[::7, ::5] = np.nan
+    x = num.array(x_np)
+    expected = np.nansum(x_np.astype(np.float64), axis=axis)
+    # Sums should stay close to the ones accumulated in float64
+    assert np.allclose(num.nansum(x, axis=axis), expected, rtol=1e-5)
+
+    y_np = np.nan_to_num(x_np)
+    y = num.array(y_np)
+    expected = np.sum(y_np.astype(np.float64), axis=axis)
+    assert np.allclose(num.sum(y, axis=axis), expected, rtol=1e-5)
+    t_axis = None if axis is None else 1 - axis
+    assert np.allclose(y.T.sum(axis=t_axis), expected, rtol=1e-5)
+    expected = np.mean(y_np.astype(np.float64), axis=axis)
+    assert np.allclose(num.mean(y, axis=axis), expected, rtol=1e-5)
+
+
+@pytest.mark.parametrize("axis", (None, 0))
+def test_pairwise_sum_precision(pairwise_sum, axis):
+    # Accumulating this many values of 0.1 in float32 one after another is
+    # off by around one percent, whereas pairwise summation stays within a
+    # few ulps
+    x_np = np.full((1000000, 10), 0.1, dtype=np.float32)
+    expected = np.sum(x_np.astype(np.float64), axis=axis)
+    result = np.asarray(num.sum(num.array(x_np), axis=axis))
+    assert result.dtype == np.float32
+    assert np.all(np.abs(result - expected) / expected < 1e-5)
+
+
 if __name__ == "__main__":
     import sys
 
@@ -198,6 +198,61 @@ def test_scan_nan(op, outtype, dt, n0):
     _run_tests(op, n0, shape, dt, axis, out0, outtype)
 
 
+@pytest.mark.parametrize("op", ops)
+@pytest.mark.parametrize("axis", (0, 1, 2))
+@pytest.mark.parametrize(
+    "view",
+    (
+        lambda x: x,
+        lambda x: x.transpose(2, 0, 1),
+        lambda x: x[:, ::2, 1:],
+    ),
+)
+def test_axis_views(op, axis, view):
+    # scans along every axis of views that are not in C order
+    np.random.seed(0)
+    in_np = view(np.random.random((8, 9, 10)) + 0.5)
+    in_np[1, 2, 3] = np.nan
+    in_num = view(num.array(np.random.random((8, 9, 10))))
+    in_num[...] = in_np
+    out_np = getattr(np, op)(in_np, axis=axis)
+    out_num = getattr(num, op)(in_num, axis=axis)
+    assert np.allclose(out_np, out_num, equal_nan=True)
+
+
+@pytest.mark.parametrize("op", ops)
+@pytest.mark.parametrize("shape", ((20000, 16), (3, 40000)))
+def test_row_counts(op, shape):
+    # many short rows and a few long ones along the last axis
+    np.random.seed(1)
+    in_np = np.random.random(shape) * 0.1 + 0.95
+    in_num = num.array(in_np)
+    out_np = getattr(np, op)(in_np, axis=-1)
+    out_num = getattr(num, op)(in_num, axis=-1)
+    assert np.allclose(out_np, out_num)
+
+
+@pytest.mark.parametrize("op", ops)
+@pytest.mark.parametrize(
+    "shape, axis, view",
+    (
+        ((40000, 2), 0, lambda x: x),
+        ((3, 80000), 1, lambda x: x[:, ::2]),
+        ((2, 40000), 1, lambda x: x.T.copy().T),
+    ),
+    ids=str,
+)
+def test_few_long_lines(op, shape, axis, view):
+    # fewer lines than threads, which are split along the scan axis
+    np.random.seed(2)
+    in_np = view(np.random.random(shape) * 0.1 + 0.95)
+    in_num = view(num.array(np.random.random(shape)))
+    in_num[...] = in_np
+    out_np = getattr(np, op)(in_np, axis=axis)
+    out_num = getattr(num, op)(in_num, axis=axis)
+    assert np.allclose(out_np, out_num)
+
+
 @pytest.mark.parametrize("op", ops)
 def test_empty_inputs(op):
     in_np = np.ones(10)
@@ -224,6 +279,52 @@ def test_scalar(op):
     assert np.array_equal(out_np, out_num)
 
 
+accumulate_ufuncs = {
+    "add": (np.int32, np.float64, np.complex128),
+    "multiply": (np.int32, np.float64),
+    "maximum": (np.bool_, np.int32, np.float32, np.float64),
+    "minimum": (np.int32, np.float64),
+    "logaddexp": (np.int32, np.float32, np.float64),
+    "bitwise_and": (np.bool_, np.int64, np.uint8),
+    "bitwise_or": (np.int32,),
+    "bitwise_xor": (np.int32,),
+    "logical_and": (np.bool_, np.float64),
+    "logical_or": (np.int32,),
+    "logical_xor": (np.bool_,),
+}
+
+
+@pytest.mark.parametrize(
+    "name, dt",
+    [(name, dt) for name, dts in accumulate_ufuncs.items() for dt in dts],
+)
+@pytest.mark.parametrize("axis", (0, 1, -1))
+def test_accumulate(name, dt, axis):
+    np.random.seed(0)
+    in_np = (np.random.random((7, 9, 5)) * 8).astype(dt)
+    out_np = getattr(np, name).accumulate(in_np, axis=axis)
+    out_num = getattr(num, name).accumulate(num.array(in_np), axis=axis)
+    assert out_np.dtype == out_num.dtype
+    assert np.allclose(out_np, out_num)
+
+
+@pytest.mark.parametrize("name", ("maximum", "minimum"))
+def test_accumulate_nan(name):
+    in_np = np.array([3.0, 1.0, np.nan, 5.0, 0.0])
+    out_np = getattr(np, name).accumulate(in_np)
+    out_num = getattr(num, name).accumulate(num.array(in_np))
+    assert np.array_equal(out_np, out_num, equal_nan=True)
+
+
+def test_accumulate_out():
+    in_np = np.random.random((10, 6))
+    out_np = np.zeros((10, 6))
+    out_num = num.zeros((10, 6))
+    np.maximum.accumulate(in_np, axis=1, out=out_np)
+    num.maximum.accumulate(num.array(in_np), axis=1, out=out_num)
+    assert np.array_equal(out_np, out_num)
+
+
 class TestScanErrors:
     @pytest.mark.parametrize("op", ("cumsum", "cumprod"))
     def test_array_with_nan(self, op):
@@ -234,6 +335,21 @@ class TestScanErrors:
         with pytest.raises(expected_exc):
             getattr(num, op)(A)
 
+    def test_accumulate_unsupported_type(self):
+        expected_exc = TypeError
+        A = np.ones(4)
+        with pytest.raises(expected_exc):
+            np.bitwise_and.accumulate(A)
+        with pytest.raises(expected_exc):
+            num.bitwise_and.accumulate(num.array(A))
+
+    def test_accumulate_scalar(self):
+        expected_exc = TypeError
+        with pytest.raises(expected_exc):
+            np.add.accumulate(np.array(1))
+        with pytest.raises(expected_exc):
+            num.add.accumulate(num.array(1))
+
     @pytest.mark.parametrize(
         "axis", (-2, 1), ids=lambda axis: f"(axis={axis})"
     )
@@ -18,6 +18,7 @@ import pytest
 from legate.core import LEGATE_MAX_DIM
 
 import cunumeric as num
+from cunumeric.settings import settings
 
 # cunumeric.searchsorted(a: ndarray, v: Union[int, float, ndarray],
 # side: Literal['left', 'right'] = 'left',
@@ -218,6 +219,34 @@ def test_ndim(ndim, side):
     check_api(a, None, v, side)
 
 
+@pytest.mark.parametrize("shape", ((1 << 20,), (1 << 10, 1 << 10)), ids=str)
+@pytest.mark.parametrize("side", SIDES)
+def test_many_needles(shape, side):
+    # Enough needles to be merged with the sorted array on multiple
+    # processors, with many of them equal to elements of the array
+    a = np.sort(np.random.randint(-1000, 1000, size=5000))
+    v = np.random.randint(-1100, 1100, size=shape)
+    res_np = np.searchsorted(a, v, side=side)
+    res_num = num.searchsorted(num.array(a), num.array(v), side=side)
+    assert np.array_equal(res_np, res_num)
+
+
+@pytest.mark.parametrize("side", SIDES)
+def test_merge_special_values(side):
+    # Lower the threshold so that the merged search runs on small inputs
+    # holding NaNs and signed zeros on both sides
+    settings.searchsorted_merge_min_needles = 1
+    try:
+        a = [-np.inf, -1.0, -0.0, 0.0, 0.0, 2.0, np.nan] * 50
+        a = np.sort(np.array(a))
+        v = np.array([np.nan, 0.0, -0.0, -np.inf, 1.0, np.inf, 2.0] * 30)
+        res_np = np.searchsorted(a, v, side=side)
+        res_num = num.searchsorted(num.array(a), num.array(v), side=side)
+        assert np.array_equal(res_np, res_num)
+    finally:
+        settings.searchsorted_merge_min_needles.unset_value()
+
+
 if __name__ == "__main__":
     import sys
 
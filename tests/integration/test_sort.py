@@ -177,6 +177,50 @@ class TestSort(object):
             res_num = num.sort(arr_num, axis=axis, kind=sort_type)
             assert np.array_equal(res_num, res_np)
 
+    @pytest.mark.parametrize(
+        "dtype", (np.int8, np.uint16, np.int64, np.float32, np.float64)
+    )
+    @pytest.mark.parametrize("axis", (0, -1))
+    def test_long_segments(self, dtype, axis):
+        # Segments long enough to be radix sorted, with negative values and
+        # both signs of zero for floats
+        arr_np = (np.random.random((3, 5000)) * 200 - 100).astype(dtype)
+        if np.issubdtype(dtype, np.floating):
+            arr_np[:, ::7] = -0.0
+            arr_np[:, 1::11] = -np.inf
+        arr_np = np.moveaxis(arr_np, 0, axis).copy()
+        arr_num = num.array(arr_np)
+        res_np = np.sort(arr_np, axis=axis)
+        res_num = num.sort(arr_num, axis=axis)
+        assert np.array_equal(res_num, res_np)
+
+    @pytest.mark.parametrize("size", ((1000, 3), (500, 64), (20, 5000)))
+    @pytest.mark.parametrize("dtype", (np.int32, np.float64, np.complex64))
+    def test_many_segments(self, size, dtype):
+        # Many segments, which are sorted in parallel across segments
+        arr_np = np.random.randint(-1000, 1000, size).astype(dtype)
+        arr_num = num.array(arr_np)
+        res_np = np.sort(arr_np)
+        res_num = num.sort(arr_num)
+        assert np.array_equal(res_num, res_np)
+
+    @pytest.mark.parametrize("oversampling", (1, 4))
+    @pytest.mark.parametrize("argsort", (False, True))
+    def test_duplicates(self, monkeypatch, oversampling, argsort):
+        # Heavily duplicated keys, which the splitters of a distributed sort
+        # have to cut in the middle of runs of equal values
+        monkeypatch.setenv("CUNUMERIC_SORT_OVERSAMPLING", str(oversampling))
+        arr_np = np.random.randint(0, 3, 10000)
+        arr_np[:7000] = 1
+        arr_num = num.array(arr_np)
+        if argsort:
+            res_np = np.argsort(arr_np, kind="stable")
+            res_num = num.argsort(arr_num, kind="stable")
+        else:
+            res_np = np.sort(arr_np)
+            res_num = num.sort(arr_num)
+        assert np.array_equal(res_num, res_np)
+
     @pytest.mark.skip
     @pytest.mark.parametrize("size", SIZES)
     @pytest.mark.parametrize("sort_type", SORT_TYPES)
@@ -191,6 +191,21 @@ def test_var_corners(dtype, ddof, axis, shape):
     check_op(op_np, op_num, np_in, dtype)
 
 
+@pytest.mark.parametrize("dtype", ("f", "d"))
+@pytest.mark.parametrize("axis", [None, 0, 1])
+@pytest.mark.parametrize("func", ["var", "std"])
+def test_var_large_offset(dtype, axis, func):
+    # A mean that is large relative to the spread of the values makes any
+    # formula based on <x^2> - <x>^2 lose most of its significant digits
+    offset = 1e4 if dtype == "f" else 1e8
+    np_in = get_op_input(shape=(40, 30), offset=offset, astype=dtype)
+
+    op_np = functools.partial(getattr(np, func), axis=axis)
+    op_num = functools.partial(getattr(num, func), axis=axis)
+
+    check_op(op_np, op_num, np_in, dtype, rtol=1e-3 if dtype == "f" else 1e-5)
+
+
 @pytest.mark.xfail
 @pytest.mark.parametrize("dtype", dtypes)
 @pytest.mark.parametrize("ddof", [0, 1])
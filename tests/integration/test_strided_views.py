@@ -0,0 +1,86 @@
+# Copyright 2023 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import numpy as np
+import pytest
+from utils.comparisons import allclose
+from utils.generators import mk_seq_array
+
+import cunumeric as num
+
+# Views that are not dense in row-major order, so the tasks operating on
+# them take the row-wise iteration path
+VIEWS = (
+    lambda x: x[::2],
+    lambda x: x[1:, ::3],
+    lambda x: x.T,
+    lambda x: x.swapaxes(0, 2)[:, 1:-1],
+    lambda x: x[..., 5],
+)
+
+
+def _make(lib, view):
+    return view(mk_seq_array(lib, (6, 7, 11)))
+
+
+@pytest.mark.parametrize("view", VIEWS)
+def test_unary(view):
+    x_np = _make(np, view)
+    x_num = _make(num, view)
+    assert allclose(np.sqrt(x_np), num.sqrt(x_num))
+    assert allclose(x_np.astype(np.float32), x_num.astype(np.float32))
+
+
+@pytest.mark.parametrize("view", VIEWS)
+def test_binary(view):
+    x_np = _make(np, view)
+    x_num = _make(num, view)
+    assert allclose(x_np * x_np + 1, x_num * x_num + 1)
+    assert num.array_equal(x_num, x_num.copy())
+
+
+@pytest.mark.parametrize("view", VIEWS)
+def test_where_nonzero(view):
+    x_np = _make(np, view) % 3
+    x_num = _make(num, view) % 3
+    assert allclose(np.where(x_np, x_np, -1), num.where(x_num, x_num, -1))
+    for res_np, res_num in zip(np.nonzero(x_np), num.nonzero(x_num)):
+        assert np.array_equal(res_np, res_num)
+
+
+@pytest.mark.parametrize("view", VIEWS)
+def test_fill_and_copy(view):
+    x_np = np.zeros((6, 7, 11))
+    x_num = num.zeros((6, 7, 11))
+    view(x_np).fill(3)
+    view(x_num).fill(3)
+    assert allclose(x_np, x_num)
+
+    view(x_np)[...] = view(mk_seq_array(np, (6, 7, 11)))
+    view(x_num)[...] = view(mk_seq_array(num, (6, 7, 11)))
+    assert allclose(x_np, x_num)
+
+
+@pytest.mark.parametrize("view", VIEWS)
+def test_boolean_indexing(view):
+    x_np = _make(np, view)
+    x_num = _make(num, view)
+    assert np.array_equal(x_np[x_np % 2 == 0], x_num[x_num % 2 == 0])
+
+
+if __name__ == "__main__":
+    import sys
+
+    sys.exit(pytest.main(sys.argv))
@@ -0,0 +1,87 @@
+# Copyright 2023 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import numpy as np
+import pytest
+from utils.comparisons import allclose
+from utils.generators import mk_seq_array
+
+import cunumeric as num
+
+SHAPES = ((1,), (100,), (13, 17), (4, 5, 6))
+
+
+def check(in_np, in_num):
+    stats = num.summary_stats(in_num)
+
+    assert stats.min == np.amin(in_np)
+    assert stats.max == np.amax(in_np)
+    assert allclose(stats.sum, np.sum(in_np))
+    assert stats.sum.dtype == np.sum(in_np).dtype
+    assert stats.count_nonzero == np.count_nonzero(in_np)
+    assert stats.nan_count == 0
+
+
+@pytest.mark.parametrize("shape", SHAPES, ids=str)
+@pytest.mark.parametrize(
+    "dtype", (np.bool_, np.int8, np.int32, np.uint16, np.float32, np.float64)
+)
+def test_basic(shape, dtype):
+    in_np = (mk_seq_array(np, shape) % 7 - 3).astype(dtype)
+    check(in_np, num.array(in_np))
+
+
+@pytest.mark.parametrize("shape", SHAPES[1:], ids=str)
+def test_non_dense(shape):
+    in_np = mk_seq_array(np, shape).astype(np.float64) % 5
+    in_num = num.array(in_np)
+    check(in_np.T, in_num.T)
+    check(in_np[::2], in_num[::2])
+
+
+def test_nan_count():
+    in_np = np.random.rand(10, 20)
+    in_np[in_np < 0.2] = np.nan
+    in_np[in_np > 0.9] = 0
+    in_num = num.array(in_np)
+
+    stats = num.summary_stats(in_num)
+    assert stats.nan_count == np.count_nonzero(np.isnan(in_np))
+    assert stats.count_nonzero == np.count_nonzero(in_np)
+
+
+def test_scalar():
+    stats = num.summary_stats(5.0)
+    assert stats.min == 5.0
+    assert stats.max == 5.0
+    assert stats.sum == 5.0
+    assert stats.count_nonzero == 1
+    assert stats.nan_count == 0
+
+
+def test_empty():
+    with pytest.raises(ValueError):
+        num.summary_stats(num.array([]))
+
+
+def test_complex():
+    with pytest.raises(NotImplementedError):
+        num.summary_stats(num.ones(3, dtype=np.complex64))
+
+
+if __name__ == "__main__":
+    import sys
+
+    sys.exit(pytest.main(sys.argv))
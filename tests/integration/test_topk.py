@@ -0,0 +1,106 @@
+# Copyright 2023 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import numpy as np
+import pytest
+
+import cunumeric as num
+
+# cunumeric.topk(a: ndarray, k: int, axis: Optional[int] = -1,
+# largest: bool = True) → tuple[ndarray, ndarray]
+
+
+def _reference(a, k, axis, largest):
+    # The first k elements of a sort along the axis, from the best one down
+    res = np.sort(a, axis=axis)
+    if largest:
+        res = np.flip(res, axis)
+    return np.take(res, range(k), axis=axis)
+
+
+def check_topk(a_np, k, axis=-1, largest=True):
+    a_num = num.array(a_np)
+    values, indices = num.topk(a_num, k, axis=axis, largest=largest)
+    ref = _reference(a_np, k, axis, largest)
+    assert np.array_equal(values, ref, equal_nan=True)
+    # Equal elements may be picked in any order, but the indices have to
+    # point at the returned values
+    if axis is None:
+        picked = a_np.ravel()[np.asarray(indices)]
+    else:
+        picked = np.take_along_axis(a_np, np.asarray(indices), axis)
+    assert np.array_equal(picked, values, equal_nan=True)
+
+
+@pytest.mark.parametrize("largest", (True, False))
+@pytest.mark.parametrize("k", (1, 5, 100, 1000))
+@pytest.mark.parametrize(
+    "dtype", (np.bool_, np.int8, np.uint16, np.int64, np.float32)
+)
+def test_1d(dtype, k, largest):
+    a_np = (np.random.rand(1000) * 50).astype(dtype)
+    check_topk(a_np, k, largest=largest)
+
+
+@pytest.mark.parametrize("largest", (True, False))
+def test_1d_large(largest):
+    a_np = np.random.rand(1 << 16)
+    check_topk(a_np, 1000, largest=largest)
+
+
+def test_1d_nan():
+    a_np = np.random.rand(100)
+    a_np[[3, 50]] = np.nan
+    check_topk(a_np, 5)
+    check_topk(a_np, 5, largest=False)
+
+
+def test_1d_complex():
+    a_np = np.random.rand(100) + 1j * np.random.rand(100)
+    check_topk(a_np, 10)
+
+
+@pytest.mark.parametrize("largest", (True, False))
+@pytest.mark.parametrize("axis", (0, 1, -1, None))
+def test_nd(axis, largest):
+    a_np = np.random.randint(0, 20, (8, 9, 10))
+    check_topk(a_np, 3, axis=axis, largest=largest)
+
+
+@pytest.mark.parametrize("k", (0, 1))
+def test_k_bounds(k):
+    a_np = np.random.rand(0 if k == 0 else 4, 3)
+    values, indices = num.topk(num.array(a_np), k, axis=0)
+    assert values.shape == (k, 3)
+    assert indices.shape == (k, 3)
+
+
+class TestTopkErrors:
+    @pytest.mark.parametrize("k", (-1, 11))
+    def test_k_out_of_bound(self, k):
+        msg = "out of bounds"
+        with pytest.raises(ValueError, match=msg):
+            num.topk(num.arange(10), k)
+
+    def test_axis_out_of_bound(self):
+        with pytest.raises(np.AxisError):
+            num.topk(num.arange(10), 1, axis=1)
+
+
+if __name__ == "__main__":
+    import sys
+
+    np.random.seed(12345)
+    sys.exit(pytest.main(sys.argv))
@@ -42,22 +42,20 @@ def test_ndim(ndim):
     assert np.array_equal(b, b_np)
 
 
-@pytest.mark.xfail
 @pytest.mark.parametrize("return_index", (True, False))
 @pytest.mark.parametrize("return_inverse", (True, False))
 @pytest.mark.parametrize("return_counts", (True, False))
-@pytest.mark.parametrize("axis", (0, 1))
+@pytest.mark.parametrize("axis", (None, 0, 1))
 def test_parameters(return_index, return_inverse, return_counts, axis):
-    arr_num = num.random.randint(0, 3, size=(3, 3))
+    arr_num = num.random.randint(0, 3, size=(30, 3))
     arr_np = np.array(arr_num)
     res_num = num.unique(
         arr_num,
         return_index=return_index,
         return_inverse=return_inverse,
         return_counts=return_counts,
+        axis=axis,
     )
-    # cuNumeric raises NotImplementedError: Keyword arguments
-    # for `unique` are not yet supported
     res_np = np.unique(
         arr_np,
         return_index=return_index,
@@ -65,7 +63,70 @@ def test_parameters(return_index, return_inverse, return_counts, axis):
         return_counts=return_counts,
         axis=axis,
     )
-    assert np.array_equal(res_np, res_num)
+    if not (return_index or return_inverse or return_counts):
+        res_num, res_np = (res_num,), (res_np,)
+    assert len(res_num) == len(res_np)
+    for out_num, out_np in zip(res_num, res_np):
+        assert out_num.shape == out_np.shape
+        assert np.array_equal(out_num, out_np)
+
+
+@pytest.mark.parametrize("ndim", range(1, LEGATE_MAX_DIM + 1))
+def test_inverse_reconstructs(ndim):
+    shape = (5,) * ndim
+    a_np = np.random.randint(0, 20, size=shape).astype(np.float32)
+    a = num.array(a_np)
+    values, index, inverse, counts = num.unique(
+        a, return_index=True, return_inverse=True, return_counts=True
+    )
+    values_np, index_np, inverse_np, counts_np = np.unique(
+        a_np, return_index=True, return_inverse=True, return_counts=True
+    )
+    assert np.array_equal(values, values_np)
+    assert np.array_equal(index, index_np)
+    assert np.array_equal(counts, counts_np)
+    assert inverse.shape == inverse_np.shape
+    assert np.array_equal(values[inverse], a_np)
+
+
+def test_nan():
+    a_np = np.array([3.0, np.nan, 1.0, np.nan, 3.0, -0.0, np.inf] * 50)
+    a = num.array(a_np)
+    res_num = num.unique(
+        a, return_index=True, return_inverse=True, return_counts=True
+    )
+    res_np = np.unique(
+        a_np, return_index=True, return_inverse=True, return_counts=True
+    )
+    assert np.array_equal(res_num[0], res_np[0], equal_nan=True)
+    for out_num, out_np in zip(res_num[1:], res_np[1:]):
+        assert out_num.shape == out_np.shape
+        assert np.array_equal(out_num, out_np)
+
+
+def test_axis_3d():
+    a_np = np.random.randint(0, 2, size=(4, 6, 2))
+    a = num.array(a_np)
+    for axis in range(-3, 3):
+        res_num = num.unique(a, axis=axis, return_counts=True)
+        res_np = np.unique(a_np, axis=axis, return_counts=True)
+        assert np.array_equal(res_num[0], res_np[0])
+        assert np.array_equal(res_num[1], res_np[1])
+
+
+# Few distinct values are deduplicated with hash sets, and many by sorting
+@pytest.mark.parametrize("high", (7, 1 << 40))
+@pytest.mark.parametrize("dtype", (np.int64, np.int16, np.float64))
+def test_cardinality(high, dtype):
+    high = min(high, np.iinfo(np.int16).max) if dtype == np.int16 else high
+    a_np = np.random.randint(0, high, 200000).astype(dtype)
+    a = num.array(a_np)
+    assert np.array_equal(num.unique(a), np.unique(a_np))
+    # Non-dense inputs
+    assert np.array_equal(num.unique(a[::3]), np.unique(a_np[::3]))
+    b_np = a_np.reshape(400, 500)
+    b = num.array(b_np)
+    assert np.array_equal(num.unique(b.T), np.unique(b_np.T))
 
 
 if __name__ == "__main__":
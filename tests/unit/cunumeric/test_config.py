@@ -127,37 +127,52 @@ def test_CuNumericOpCode() -> None:
         "CONVERT",
         "CONVOLVE",
         "DIAG",
+        "DIFF",
         "DOT",
         "EYE",
         "FFT",
         "FILL",
         "FLIP",
+        "FUSED_OP",
         "GEMM",
+        "GRADIENT",
         "HISTOGRAM",
+        "ISIN",
+        "LEXSORT",
         "LOAD_CUDALIBS",
         "MATMUL",
         "MATVECMUL",
         "NONZERO",
         "PACKBITS",
+        "PARTITION",
         "POTRF",
         "PUTMASK",
+        "QUANTILE_SKETCH",
+        "QUANTILE_SKETCH_REDUCE",
+        "RADIX_SELECT",
         "RAND",
         "READ",
         "REPEAT",
+        "SCALAR_STATS",
         "SCALAR_UNARY_RED",
         "SCAN_GLOBAL",
         "SCAN_LOCAL",
         "SOLVE",
         "SORT",
         "SEARCHSORTED",
+        "SEARCHSORTED_MERGE",
+        "SEGMENTED_RED",
+        "SEGMENTED_RED_GLOBAL",
         "SYRK",
         "TILE",
+        "TOPK",
         "TRANSPOSE_COPY_2D",
         "TRILU",
         "TRSM",
         "UNARY_OP",
         "UNARY_RED",
         "UNIQUE",
+        "UNIQUE_INVERSE",
         "UNIQUE_REDUCE",
         "UNLOAD_CUDALIBS",
         "UNPACKBITS",
@@ -192,6 +207,7 @@ def test_UnaryOpCode() -> None:
         "FLOOR",
         "FREXP",
         "GETARG",
+        "GETVAR",
         "IMAG",
         "INVERT",
         "ISFINITE",
@@ -234,7 +250,19 @@ def test_CuNumericTunable() -> None:
 
 
 def test_ScanCode() -> None:
-    assert (set(m.ScanCode.__members__)) == {"PROD", "SUM"}
+    assert (set(m.ScanCode.__members__)) == {
+        "BITWISE_AND",
+        "BITWISE_OR",
+        "BITWISE_XOR",
+        "LOGADDEXP",
+        "LOGICAL_AND",
+        "LOGICAL_OR",
+        "LOGICAL_XOR",
+        "MAX",
+        "MIN",
+        "PROD",
+        "SUM",
+    }
 
 
 if __name__ == "__main__":
@@ -29,6 +29,9 @@ _expected_settings = (
     "report_dump_callstack",
     "report_dump_csv",
     "numpy_compat",
+    "pairwise_sum",
+    "sort_oversampling",
+    "searchsorted_merge_min_needles",
     "fast_math",
     "min_gpu_chunk",
     "min_cpu_chunk",
@@ -71,6 +74,11 @@ class TestSettings:
         )
         assert m.settings.report_dump_csv.convert_type == "str"
         assert m.settings.numpy_compat.convert_type == 'bool ("0" or "1")'
+        assert m.settings.pairwise_sum.convert_type == 'bool ("0" or "1")'
+        assert m.settings.sort_oversampling.convert_type == "int"
+        assert (
+            m.settings.searchsorted_merge_min_needles.convert_type == "int"
+        )
 
 
 class TestDefaults:
@@ -92,6 +100,15 @@ class TestDefaults:
     def test_numpy_compat(self) -> None:
         assert m.settings.numpy_compat.default is False
 
+    def test_pairwise_sum(self) -> None:
+        assert m.settings.pairwise_sum.default is False
+
+    def test_sort_oversampling(self) -> None:
+        assert m.settings.sort_oversampling.default == 1
+
+    def test_searchsorted_merge_min_needles(self) -> None:
+        assert m.settings.searchsorted_merge_min_needles.default == 1 << 20
+
     @pytest.mark.skip(reason="Does not work in CI (path issue)")
     @pytest.mark.parametrize("name", _settings_with_test_defaults)
     def test_default(self, name: str) -> None: